@@ -6,6 +6,15 @@
 #include "gsdkConfig.h"
 #include "gsdkInfo.h"
 
+#ifdef GSDK_OPENSSL
+#include "gsdkCertificates.h"
+#endif
+
+#ifdef GSDK_LINUX
+#include "gsdkListeners.h"
+#include <unistd.h>
+#endif
+
 namespace Microsoft
 {
     namespace Azure
@@ -13,16 +22,30 @@ namespace Microsoft
         namespace Gaming
         {
             constexpr int c_minHeartbeatIntervalMs = 1000;
+            constexpr int c_customMetricsIntervalMs = 10000;
+            constexpr int c_resourceSampleIntervalMs = 5000;
+
+            // When the calling thread's frame started, see GSDK::frameBegin
+            static std::chrono::steady_clock::time_point &frameStartTime()
+            {
+                static thread_local std::chrono::steady_clock::time_point startTime;
+                return startTime;
+            }
             std::unique_ptr<GSDKInternal> GSDKInternal::m_instance = nullptr;
+            std::atomic<GSDKInternal *> GSDKInternal::m_instancePtr(nullptr);
             std::mutex GSDKInternal::m_gsdkInitMutex;
             volatile long long GSDKInternal::m_exitStatus = 0;
-            std::mutex GSDKInternal::m_logLock;
-            std::ofstream GSDKInternal::m_logFile;
+            // Never destroyed: the heartbeat thread can still log while statics are being torn down, and m_instance,
+            // whose destructor flushes the log, is itself only destroyed then
+            GSDKLogWriter &GSDKInternal::m_logWriter = *new GSDKLogWriter();
+            GSDKLogWriter::Options GSDKInternal::m_logOptions;
             bool GSDKInternal::m_debug = false;
             std::unique_ptr<Configuration> GSDKInternal::testConfiguration = nullptr;
 
-            GSDKInternal::GSDKInternal() : m_transitionToActiveEvent(), m_signalHeartbeatEvent(), m_initialPlayers()
+            GSDKInternal::GSDKInternal() : m_transitionToActiveEvent(), m_signalHeartbeatEvent(), m_initialPlayers(), m_initialPlayersPublished(false), m_metrics(), m_startTime(std::chrono::steady_clock::now())
             {
+                GSDKTraceSpan startupSpan("initialize");
+
                 // Need to setup the config first, as that tells us where to log
                 Configuration* config = nullptr;
 
@@ -88,13 +111,24 @@ namespace Microsoft
                 }
 
                 m_connectionInfo = config->getGameServerConnectionInfo();
+                m_sharedContent.setRoot(m_configSettings[GSDK::SHARED_CONTENT_FOLDER_KEY]);
 
                 // We don't want to write files in our UTs
                 if (config->shouldLog())
                 {
+                    GSDKTraceSpan startLogSpan("startLog");
                     startLog();
                 }
 
+#ifdef GSDK_OPENSSL
+                {
+                    GSDKTraceSpan certificatesSpan("loadCertificates");
+                    const std::string &certificateFolder = m_configSettings[GSDK::CERTIFICATE_FOLDER_KEY];
+                    size_t certificateCount = GSDKCertificateStore::load(certificateFolder);
+                    GSDK_LOG(Info, CertificatesLoaded, certificateCount, certificateFolder);
+                }
+#endif
+
                 // Use highest frequency permitted heartbeat interval until VMAgent tells an updated one.
                 m_nextHeartbeatIntervalMs = c_minHeartbeatIntervalMs;
 
@@ -104,8 +138,8 @@ namespace Microsoft
                     std::string gsmsBaseUrl = m_configSettings[GSDK::HEARTBEAT_ENDPOINT_KEY];
                     std::string instanceId = m_configSettings[GSDK::SERVER_ID_KEY];
 
-                    GSDK::logMessage("VM Agent Endpoint: " + gsmsBaseUrl);
-                    GSDK::logMessage("Instance Id: " + instanceId);
+                    GSDK_LOG(Info, AgentEndpoint, gsmsBaseUrl);
+                    GSDK_LOG(Info, InstanceId, instanceId);
 
                     m_heartbeatUrl.reserve(1024);
                     m_heartbeatUrl += "http://";
@@ -113,14 +147,19 @@ namespace Microsoft
                     m_heartbeatUrl += "/v1/sessionHosts/";
                     m_heartbeatUrl += instanceId;
 
+                    m_customMetricsUrl = "http://" + gsmsBaseUrl + "/v1/metrics/" + instanceId + "/custom";
+
                     m_cachedScheduledMaintenance = {};
 
-                    curl_global_init(CURL_GLOBAL_GSDK_INIT_FLAGS);
+                    {
+                        GSDKTraceSpan curlInitSpan("initCurl");
+                        curl_global_init(CURL_GLOBAL_GSDK_INIT_FLAGS);
 
-                    m_curlHttpHeaders = nullptr;
-                    m_curlHttpHeaders = curl_slist_append(m_curlHttpHeaders, "Accept: application/json");
-                    m_curlHttpHeaders = curl_slist_append(m_curlHttpHeaders, "Content-Type: application/json; charset=utf-8");
-                    m_curlHandle = curl_easy_init();
+                        m_curlHttpHeaders = nullptr;
+                        m_curlHttpHeaders = curl_slist_append(m_curlHttpHeaders, "Accept: application/json");
+                        m_curlHttpHeaders = curl_slist_append(m_curlHttpHeaders, "Content-Type: application/json; charset=utf-8");
+                        m_curlHandle = curl_easy_init();
+                    }
 
                     m_transitionToActiveEvent.Reset();
                     m_signalHeartbeatEvent.Reset();
@@ -142,17 +181,21 @@ namespace Microsoft
             {
                 m_keepHeartbeatRunning = false;
                 m_heartbeatThread.join();
+                writeTrace();
+                GSDKLogThrottle::flushAll(m_logWriter);
+                m_logWriter.flush();
             }
 
 			//Do not need to acquire lock for configuration becase startLog is only called from the constructor.
 			//If this changes lock will be needed.
             void GSDKInternal::startLog()
             {
-                if (m_logFile.is_open())
+                if (m_logWriter.isOpen())
                 {
                     return;
                 }
-                std::string logFile = "GSDK_output_" + std::to_string((unsigned long long)time(nullptr)) + ".txt";
+                std::string logTime = std::to_string((unsigned long long)time(nullptr));
+                std::string logBaseName = "GSDK_output_" + logTime;
                 std::string logFolder = m_configSettings[GSDK::LOG_FOLDER_KEY];
                 if (!logFolder.empty() && !cGSDKUtils::createDirectoryIfNotExists(logFolder)) // If we couldn't successfully create the path, just use the current directory
                 {
@@ -169,12 +212,84 @@ namespace Microsoft
                     logFolder.append("/");
                 }
 #endif
-                std::string logPath = logFolder + logFile;
-                m_logFile.open(logPath.c_str(), std::ofstream::out);
+                m_logWriter.open(logFolder, logBaseName, m_logOptions);
+                m_tracePath = logFolder + "GSDK_trace_" + logTime + ".json";
+                m_logFolder = logFolder;
+
+                // Overwritten by every run, a sidecar always finds the current server's page at the same path
+                m_metricsPage.open(logFolder + "GSDK_metrics.page");
+            }
+
+            void GSDKInternal::publishMetrics()
+            {
+                if (!m_metricsPage.isOpen())
+                {
+                    return;
+                }
+
+                if (m_metrics.m_processId == 0)
+                {
+#ifdef GSDK_LINUX
+                    m_metrics.m_processId = static_cast<uint64_t>(getpid());
+#else
+                    m_metrics.m_processId = static_cast<uint64_t>(GetCurrentProcessId());
+#endif
+                    auto sinceStart = std::chrono::steady_clock::now() - m_startTime;
+                    m_metrics.m_startTimeUnixMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch() - sinceStart).count());
+
+                    std::lock_guard<std::mutex> lock(m_configMutex);
+                    strncpy(m_metrics.m_instanceId, m_configSettings[GSDK::SERVER_ID_KEY].c_str(), sizeof(m_metrics.m_instanceId) - 1);
+                }
+
+                m_metrics.m_updateTimeUnixMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+                m_metrics.m_uptimeMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_startTime).count());
+                m_metrics.m_gameState = static_cast<uint32_t>(getState());
+                m_metrics.m_gameHealthy = m_heartbeatRequest.m_isGameHealthy && !m_heartbeatRequest.m_isOverFrameBudget && !m_heartbeatRequest.m_isStalled ? 1 : 0;
+                m_metrics.m_heartbeatIntervalMs = static_cast<uint32_t>(m_nextHeartbeatIntervalMs);
+                m_metrics.m_playFabRequests = GSDKMetricsPage::getPlayFabRequests();
+                m_metrics.m_playFabFailures = GSDKMetricsPage::getPlayFabFailures();
+                m_metrics.m_logMessagesDropped = m_logWriter.getDroppedCount();
+
+                m_metricsPage.publish(m_metrics);
+            }
+
+            void GSDKInternal::sampleResources()
+            {
+                m_lastResourceSample = std::chrono::steady_clock::now();
+                ProcessResourceUsage usage;
+                m_resourceSampler.sample(usage);
+
+                m_metrics.m_cpuUserMs = usage.m_cpuUserMs;
+                m_metrics.m_cpuSystemMs = usage.m_cpuSystemMs;
+                m_metrics.m_residentBytes = usage.m_residentBytes;
+                m_metrics.m_openFileDescriptors = usage.m_openFileDescriptors;
+                m_metrics.m_threadCount = usage.m_threadCount;
+                m_metrics.m_voluntaryContextSwitches = usage.m_voluntaryContextSwitches;
+                m_metrics.m_involuntaryContextSwitches = usage.m_involuntaryContextSwitches;
+                m_metrics.m_cgroupMemoryBytes = usage.m_cgroupMemoryBytes;
+                m_metrics.m_cgroupThrottledUs = usage.m_cgroupThrottledUs;
+
+                if (m_debug)
+                {
+                    GSDK_LOG(Debug, ResourceUsage, usage.m_cpuPercent, usage.m_cpuUserMs, usage.m_cpuSystemMs, usage.m_residentBytes,
+                             usage.m_openFileDescriptors, usage.m_threadCount, usage.m_voluntaryContextSwitches, usage.m_involuntaryContextSwitches);
+                }
+
+                std::lock_guard<std::mutex> lock(m_resourceUsageMutex);
+                m_resourceUsage = usage;
+            }
+
+            void GSDKInternal::writeTrace()
+            {
+                if (GSDKTrace::isEnabled() && !m_tracePath.empty())
+                {
+                    GSDKTrace::writeChromeTrace(m_tracePath);
+                }
             }
 
             void GSDKInternal::heartbeatThreadFunc(std::string infoUrl)
             {
+                GSDKTrace::setThreadName("GSDK heartbeat");
                 resetCurl();
                 curl_easy_setopt(m_curlHandle, CURLOPT_URL, infoUrl.c_str());
 
@@ -187,33 +302,82 @@ namespace Microsoft
 
                 std::string infoRequest = jsonInfoRequest.toStyledString();
                 curl_easy_setopt(m_curlHandle, CURLOPT_POSTFIELDS, infoRequest.c_str());
-                curl_easy_perform(m_curlHandle);
+                {
+                    GSDKTraceSpan infoSpan("sendGsdkInfo");
+                    curl_easy_perform(m_curlHandle);
+                }
 
                 long http_code = 0;
                 curl_easy_getinfo(m_curlHandle, CURLINFO_RESPONSE_CODE, &http_code);
                 if (http_code >= 300)
                 {
-                    GSDK::logMessage("Received non-success code from Agent when sending GSDK info.  Status Code: " + std::to_string(http_code) + " Response Body: " + m_receivedData);
+                    GSDK_LOG(Error, GsdkInfoNonSuccess, http_code, m_receivedData);
                 }
 
+                m_resourceSampler.open();
+                sampleResources();
+                m_lastCustomMetricsSend = std::chrono::steady_clock::now();
                 while (m_keepHeartbeatRunning)
                 {
                     if (m_signalHeartbeatEvent.Wait(m_nextHeartbeatIntervalMs))
                     {
-                        if (m_debug) GSDK::logMessage("State transition signaled an early heartbeat.");
+                        if (m_debug) GSDK_LOG(Debug, EarlyHeartbeat);
                         m_signalHeartbeatEvent.Reset(); // We've handled this signal, so reset the event
                     }
 
+                    GSDKTraceSpan heartbeatSpan("heartbeat");
                     sendHeartbeat();
                     receiveHeartbeatResponse();
+
+                    if (std::chrono::steady_clock::now() - m_lastResourceSample >= std::chrono::milliseconds(c_resourceSampleIntervalMs))
+                    {
+                        sampleResources();
+                    }
+                    publishMetrics();
+                    GSDKLogThrottle::flushExpired(m_logWriter);
+
+                    if (std::chrono::steady_clock::now() - m_lastCustomMetricsSend >= std::chrono::milliseconds(c_customMetricsIntervalMs))
+                    {
+                        sendCustomMetrics();
+                    }
+                }
+            }
+
+            void GSDKInternal::sendCustomMetrics()
+            {
+                auto now = std::chrono::steady_clock::now();
+                uint64_t intervalMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastCustomMetricsSend).count());
+                m_lastCustomMetricsSend = now;
+
+                std::string batch = GSDKCustomMetrics::collect(intervalMs);
+                if (batch.empty())
+                {
+                    return;
+                }
+
+                GSDKTraceSpan sendSpan("sendCustomMetrics");
+                resetCurl();
+                curl_easy_setopt(m_curlHandle, CURLOPT_URL, m_customMetricsUrl.c_str());
+                m_receivedData = "";
+                curl_easy_setopt(m_curlHandle, CURLOPT_CUSTOMREQUEST, "POST");
+                curl_easy_setopt(m_curlHandle, CURLOPT_POSTFIELDS, batch.c_str());
+                curl_easy_perform(m_curlHandle);
+
+                // A batch the agent didn't take is dropped, the next one only carries what was recorded since
+                long http_code = 0;
+                curl_easy_getinfo(m_curlHandle, CURLINFO_RESPONSE_CODE, &http_code);
+                if (http_code == 0 || http_code >= 300)
+                {
+                    GSDK_LOG_THROTTLED(Warning, CustomMetricsNonSuccess, http_code, m_receivedData);
                 }
             }
 
-            size_t GSDKInternal::curlReceiveData(char* buffer, size_t blockSize, size_t blockCount, void*)
+            size_t GSDKInternal::curlReceiveData(char* buffer, size_t blockSize, size_t blockCount, void* userData)
             {
-                std::lock_guard<std::mutex> lock(get().m_receivedDataMutex);
+                GSDKInternal* gsdk = static_cast<GSDKInternal*>(userData);
+                std::lock_guard<std::mutex> lock(gsdk->m_receivedDataMutex);
 
-                get().m_receivedData.append(buffer, blockSize * blockCount);
+                gsdk->m_receivedData.append(buffer, blockSize * blockCount);
                 return (blockSize * blockCount);
             }
 
@@ -223,6 +387,7 @@ namespace Microsoft
                 curl_easy_setopt(m_curlHandle, CURLOPT_URL, m_heartbeatUrl.c_str());
                 curl_easy_setopt(m_curlHandle, CURLOPT_HTTPHEADER, m_curlHttpHeaders);
                 curl_easy_setopt(m_curlHandle, CURLOPT_WRITEFUNCTION, curlReceiveData);
+                curl_easy_setopt(m_curlHandle, CURLOPT_WRITEDATA, this);
             }
 
             void GSDKInternal::sendHeartbeat()
@@ -232,24 +397,54 @@ namespace Microsoft
                 curl_easy_setopt(m_curlHandle, CURLOPT_CUSTOMREQUEST, "PATCH");
                 std::string request = encodeHeartbeatRequest();
                 curl_easy_setopt(m_curlHandle, CURLOPT_POSTFIELDS, request.c_str());
+
+                GSDKTraceSpan sendSpan("sendHeartbeat");
+                auto sendTime = std::chrono::steady_clock::now();
                 curl_easy_perform(m_curlHandle);
+
+                uint64_t latencyUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sendTime).count());
+                m_metrics.m_heartbeatsSent++;
+                m_metrics.m_lastHeartbeatLatencyUs = latencyUs;
+                m_metrics.m_maxHeartbeatLatencyUs = std::max(m_metrics.m_maxHeartbeatLatencyUs, latencyUs);
             }
 
             std::string GSDKInternal::encodeHeartbeatRequest()
             {
+                GSDKTraceSpan encodeSpan("encodeHeartbeatRequest");
                 Json::Value jsonHeartbeatRequest;
 
-                jsonHeartbeatRequest["CurrentGameState"] = GameStateNames[static_cast<int>(m_heartbeatRequest.m_currentGameState)];
+                jsonHeartbeatRequest["CurrentGameState"] = GameStateNames[static_cast<int>(getState())];
 
                 auto healthCallback = m_healthCallback;
                 if (healthCallback != nullptr)
                 {
+                    GSDKTraceSpan callbackSpan("healthCallback", "callback");
                     m_heartbeatRequest.m_isGameHealthy = healthCallback();
                 }
-                jsonHeartbeatRequest["CurrentGameHealth"] = m_heartbeatRequest.m_isGameHealthy ? "Healthy" : "Unhealthy";
+
+                double p99Ms = 0;
+                double budgetMs = 0;
+                unsigned int sustainedSeconds = 0;
+                m_heartbeatRequest.m_isOverFrameBudget = GSDKFrameMonitor::isOverBudget(p99Ms, budgetMs, sustainedSeconds);
+                if (m_heartbeatRequest.m_isOverFrameBudget)
+                {
+                    GSDK_LOG_THROTTLED(Warning, FrameBudgetExceeded, p99Ms, budgetMs, sustainedSeconds);
+                }
+
+                checkWatchdog();
+
+                bool isHealthy = m_heartbeatRequest.m_isGameHealthy && !m_heartbeatRequest.m_isOverFrameBudget && !m_heartbeatRequest.m_isStalled;
+                jsonHeartbeatRequest["CurrentGameHealth"] = isHealthy ? "Healthy" : "Unhealthy";
+
+                std::vector<ConnectedPlayer> connectedPlayers;
+                {
+                    std::lock_guard<std::mutex> lock(m_playersMutex);
+                    connectedPlayers = m_heartbeatRequest.m_connectedPlayers;
+                }
+                m_metrics.m_connectedPlayers = static_cast<uint32_t>(connectedPlayers.size());
 
                 Json::Value jsonConnectedPlayerInfo;
-                for (ConnectedPlayer connectedPlayer : m_heartbeatRequest.m_connectedPlayers)
+                for (const ConnectedPlayer& connectedPlayer : connectedPlayers)
                 {
                     Json::Value playerInfo;
                     playerInfo["PlayerId"] = connectedPlayer.m_playerId;
@@ -260,6 +455,37 @@ namespace Microsoft
                 return jsonHeartbeatRequest.toStyledString();
             }
 
+            void GSDKInternal::checkWatchdog()
+            {
+                uint64_t stalledMs = 0;
+                bool isStalled = GSDKWatchdog::isStalled(stalledMs);
+                if (isStalled == m_heartbeatRequest.m_isStalled)
+                {
+                    return;
+                }
+                m_heartbeatRequest.m_isStalled = isStalled;
+
+                if (!isStalled)
+                {
+                    GSDK_LOG(Info, WatchdogRecovered);
+                    return;
+                }
+
+                GSDK_LOG(Error, WatchdogStalled, stalledMs, GSDKWatchdog::getTimeoutMs());
+
+                // Once per stall: the stacks show where the game is stuck before the agent recycles the server
+                if (!m_tracePath.empty())
+                {
+                    GSDKTraceSpan captureSpan("captureStacks");
+                    std::string stacksPath = m_logFolder + "GSDK_stacks_" + std::to_string((unsigned long long)time(nullptr)) + GSDKWatchdog::c_stacksFileExtension;
+                    if (GSDKWatchdog::captureStacks(stacksPath))
+                    {
+                        GSDK_LOG(Error, WatchdogStacksWritten, stacksPath);
+                    }
+                }
+                m_logWriter.flush();
+            }
+
             std::tm GSDKInternal::parseDate(const std::string& dateStr) // note: this code only supports ISO 8601 UTC date-times in the format yyyy-mm-ddThh:mm:ssZ
             {
                 std::tm ret = {};
@@ -285,13 +511,15 @@ namespace Microsoft
                 return ret;
             }
 
-            void GSDKInternal::setState(GameState state)
+            GameState GSDKInternal::getState() const
             {
-                std::lock_guard<std::mutex> lock(m_stateMutex);
+                return m_heartbeatRequest.m_currentGameState.load(std::memory_order_acquire);
+            }
 
-                if (m_heartbeatRequest.m_currentGameState != state)
+            void GSDKInternal::setState(GameState state)
+            {
+                if (m_heartbeatRequest.m_currentGameState.exchange(state, std::memory_order_acq_rel) != state)
                 {
-                    m_heartbeatRequest.m_currentGameState = state;
                     m_signalHeartbeatEvent.Signal();
                 }
             }
@@ -304,16 +532,25 @@ namespace Microsoft
 
             void GSDKInternal::runShutdownCallback()
             {
-                std::function<void()> shutdownCallback = get().m_shutdownCallback;
+                GSDKTrace::setThreadName("GSDK shutdown");
+                std::function<void()> shutdownCallback = m_shutdownCallback;
+
+                // Games commonly exit from inside the callback, make sure the log and trace are on disk first
+                writeTrace();
+                GSDKLogThrottle::flushAll(m_logWriter);
+                m_logWriter.flush();
+
                 if (shutdownCallback != nullptr)
                 {
+                    GSDKTraceSpan callbackSpan("shutdownCallback", "callback");
                     shutdownCallback();
                 }
-                get().m_keepHeartbeatRunning = false;
+                m_keepHeartbeatRunning = false;
             }
 
             void GSDKInternal::decodeHeartbeatResponse(const std::string& responseJson)
             {
+                GSDKTraceSpan decodeSpan("decodeHeartbeatResponse");
                 Json::CharReaderBuilder jsonReaderFactory;
                 std::unique_ptr<Json::CharReader> jsonReader(jsonReaderFactory.newCharReader());
                 Json::Value heartbeatResponse;
@@ -321,9 +558,9 @@ namespace Microsoft
                 bool parsedSuccessfully = jsonReader->parse(responseJson.c_str(), responseJson.c_str() + responseJson.length(), &heartbeatResponse, &jsonParseErrors);
 
                 if (!parsedSuccessfully) {
-                    GSDK::logMessage("Failed to parse heartbeat");
-                    GSDK::logMessage(jsonParseErrors);
-                    GSDK::logMessage("Message: " + responseJson);
+                    GSDK_LOG_THROTTLED(Error, HeartbeatParseFailed);
+                    GSDK_LOG_THROTTLED(Error, Text, jsonParseErrors);
+                    GSDK_LOG_THROTTLED(Error, HeartbeatMessage, responseJson);
                     return;
                 }
 
@@ -341,7 +578,7 @@ namespace Microsoft
                         }
 
                         // Update initial players only if this is the first time populating it.
-                        if (m_initialPlayers.empty() && sessionConfig.isMember("initialPlayers"))
+                        if (!m_initialPlayersPublished.load(std::memory_order_relaxed) && sessionConfig.isMember("initialPlayers"))
                         {
                             Json::Value players = sessionConfig["initialPlayers"];
 
@@ -349,6 +586,11 @@ namespace Microsoft
                             {
                                 m_initialPlayers.push_back(players[i].asCString());
                             }
+
+                            if (!m_initialPlayers.empty())
+                            {
+                                m_initialPlayersPublished.store(true, std::memory_order_release);
+                            }
                         }
 
                         if (sessionConfig.isMember("metadata"))
@@ -375,6 +617,7 @@ namespace Microsoft
                         // If the cached time converted to -1, it means we haven't cached anything yet
                         if (maintCallback != nullptr && (static_cast<int>(diff) != 0 || cachedMaintenanceTime == -1))
                         {
+                            GSDKTraceSpan callbackSpan("maintenanceCallback", "callback");
                             maintCallback(nextMaintenance);
                             m_cachedScheduledMaintenance = nextMaintenance; // cache it so we only notify once
                         }
@@ -411,6 +654,7 @@ namespace Microsoft
 
                         if (maintV2Callback != nullptr)
                         {
+                            GSDKTraceSpan callbackSpan("maintenanceV2Callback", "callback");
                             maintV2Callback(schedule);
                         }
                     }
@@ -420,8 +664,7 @@ namespace Microsoft
                         try
                         {
                             if (m_debug) {
-                                GSDK::logMessage("Heartbeat request: { state = " + std::string(GameStateNames[static_cast<int>(m_heartbeatRequest.m_currentGameState)]) + "}"
-                                    + " response: { operation = " + heartbeatResponse["operation"].asString() + "}");
+                                GSDK_LOG(Debug, HeartbeatExchange, GameStateNames[static_cast<int>(getState())], heartbeatResponse["operation"].asCString());
                             }
 
                             Operation nextOperation = OperationMap.at(heartbeatResponse["operation"].asCString());
@@ -432,27 +675,27 @@ namespace Microsoft
                                 // No action required
                                 break;
                             case Operation::Active:
-                                if (m_heartbeatRequest.m_currentGameState != GameState::Active)
+                                if (getState() != GameState::Active)
                                 {
                                     setState(GameState::Active);
                                     m_transitionToActiveEvent.Signal();
                                 }
                                 break;
                             case Operation::Terminate:
-                                if (m_heartbeatRequest.m_currentGameState != GameState::Terminating)
+                                if (getState() != GameState::Terminating)
                                 {
                                     setState(GameState::Terminating);
                                     m_transitionToActiveEvent.Signal();
-                                    m_shutdownThread = std::async(std::launch::async, &runShutdownCallback);
+                                    m_shutdownThread = std::async(std::launch::async, &GSDKInternal::runShutdownCallback, this);
                                 }
                                 break;
                             default:
-                                GSDK::logMessage("Unhandled operation received: " + std::string(OperationNames[static_cast<int>(nextOperation)]));
+                                GSDK_LOG(Warning, UnhandledOperation, OperationNames[static_cast<int>(nextOperation)]);
                             }
                         }
                         catch (std::out_of_range&)
                         {
-                            GSDK::logMessage("Unknown operation received: " + heartbeatResponse["operation"].asString());
+                            GSDK_LOG_THROTTLED(Warning, UnknownOperation, heartbeatResponse["operation"].asCString());
                         }
                     }
 
@@ -474,19 +717,29 @@ namespace Microsoft
                 }
                 catch (Json::Exception& ex) {
                     // we caught an exception - log it out
-                    GSDK::logMessage("An error occured while processing heartbeat.");
-                    GSDK::logMessage(ex.what());
-                    GSDK::logMessage("Message: " + responseJson);
+                    GSDK_LOG_THROTTLED(Error, HeartbeatProcessingFailed);
+                    GSDK_LOG_THROTTLED(Error, Text, ex.what());
+                    GSDK_LOG_THROTTLED(Error, HeartbeatMessage, responseJson);
                 }
             }
 
             void GSDKInternal::receiveHeartbeatResponse()
             {
+                GSDKTraceSpan receiveSpan("receiveHeartbeatResponse");
                 long http_code = 0;
                 curl_easy_getinfo(m_curlHandle, CURLINFO_RESPONSE_CODE, &http_code);
+                if (http_code == 0 || http_code >= 300)
+                {
+                    m_metrics.m_heartbeatFailures++;
+                }
+                else
+                {
+                    m_metrics.m_lastHeartbeatUnixMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+                }
+
                 if (http_code >= 300)
                 {
-                    GSDK::logMessage("Received non-success code from Agent.  Status Code: " + std::to_string(http_code) + " Response Body: " + m_receivedData);
+                    GSDK_LOG_THROTTLED(Error, AgentNonSuccess, http_code, m_receivedData);
                     return;
                 }
 
@@ -495,12 +748,20 @@ namespace Microsoft
 
             Microsoft::Azure::Gaming::GSDKInternal& GSDKInternal::get()
             {
+                // Fast path: once published, the instance lives until process exit (or until a unit test resets it)
+                GSDKInternal* instance = m_instancePtr.load(std::memory_order_acquire);
+                if (instance != nullptr)
+                {
+                    return *instance;
+                }
+
                 std::unique_lock<std::mutex> lock(m_gsdkInitMutex);
 
                 if (!m_instance)
                 {
                     m_instance = std::make_unique<GSDKInternal>();
                 }
+                m_instancePtr.store(m_instance.get(), std::memory_order_release);
                 return *m_instance;
             }
 
@@ -512,13 +773,20 @@ namespace Microsoft
 
             bool GSDK::readyForPlayers()
             {
-                if (GSDKInternal::get().m_heartbeatRequest.m_currentGameState != GameState::Active)
+                GSDKInternal& gsdk = GSDKInternal::get();
+                if (gsdk.getState() != GameState::Active)
                 {
-                    GSDKInternal::get().setState(GameState::StandingBy);
-                    GSDKInternal::get().m_transitionToActiveEvent.Wait();
+                    gsdk.m_contentWarmup.waitUntilReady();
+                    gsdk.setState(GameState::StandingBy);
+                    gsdk.m_transitionToActiveEvent.Wait();
                 }
 
-                return GSDKInternal::get().m_heartbeatRequest.m_currentGameState == GameState::Active;
+                return gsdk.getState() == GameState::Active;
+            }
+
+            GameState GSDK::getState()
+            {
+                return GSDKInternal::get().getState();
             }
 
             const Microsoft::Azure::Gaming::GameServerConnectionInfo &GSDK::getGameServerConnectionInfo()
@@ -528,8 +796,9 @@ namespace Microsoft
 
             std::unordered_map<std::string, std::string> GSDK::getConfigSettings()
             {
-				std::lock_guard<std::mutex> lock(GSDKInternal::get().m_configMutex);
-                return GSDKInternal::get().m_configSettings;
+                GSDKInternal& gsdk = GSDKInternal::get();
+				std::lock_guard<std::mutex> lock(gsdk.m_configMutex);
+                return gsdk.m_configSettings;
             }
 
             void GSDK::updateConnectedPlayers(const std::vector<ConnectedPlayer>& currentlyConnectedPlayers)
@@ -559,12 +828,97 @@ namespace Microsoft
 
             unsigned int GSDK::logMessage(const std::string& message)
             {
-                std::unique_lock<std::mutex> lock(GSDKInternal::m_logLock);
-                GSDKInternal::m_logFile << message.c_str() << std::endl;
-                GSDKInternal::m_logFile.flush();
+                GSDKInternal::m_logWriter.write(message);
                 return 0;
             }
 
+            void GSDK::setLogBufferOptions(unsigned int capacity, bool blockWhenFull)
+            {
+                GSDKInternal::m_logOptions.m_capacity = capacity;
+                GSDKInternal::m_logOptions.m_policy = blockWhenFull ? GSDKLogWriter::OverflowPolicy::Block : GSDKLogWriter::OverflowPolicy::Drop;
+            }
+
+            void GSDK::setLogRotation(unsigned long long maxSegmentBytes, unsigned int maxSegmentCount)
+            {
+                GSDKInternal::m_logOptions.m_maxSegmentBytes = maxSegmentBytes;
+                GSDKInternal::m_logOptions.m_maxSegmentCount = maxSegmentCount;
+            }
+
+            void GSDK::setBinaryLogging(bool enabled)
+            {
+                GSDKInternal::m_logOptions.m_binary = enabled;
+            }
+
+            void GSDK::setTracing(bool enabled)
+            {
+                GSDKTrace::setEnabled(enabled);
+            }
+
+            void GSDK::recordMetric(const std::string& name, double value)
+            {
+                GSDKCustomMetrics::record(name, GSDKCustomMetrics::Kind::Gauge, value);
+            }
+
+            void GSDK::incrementCounter(const std::string& name, double delta)
+            {
+                GSDKCustomMetrics::record(name, GSDKCustomMetrics::Kind::Counter, delta);
+            }
+
+            void GSDK::recordHistogram(const std::string& name, double value)
+            {
+                GSDKCustomMetrics::record(name, GSDKCustomMetrics::Kind::Histogram, value);
+            }
+
+            void GSDK::frameBegin()
+            {
+                frameStartTime() = std::chrono::steady_clock::now();
+            }
+
+            void GSDK::frameEnd()
+            {
+                auto duration = std::chrono::steady_clock::now() - frameStartTime();
+                GSDKFrameMonitor::record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+            }
+
+            void GSDK::recordFrame(double durationMs)
+            {
+                GSDKFrameMonitor::record(durationMs > 0 ? static_cast<uint64_t>(durationMs * 1000.0) : 0);
+            }
+
+            void GSDK::setFrameBudget(double budgetMs, unsigned int sustainedSeconds)
+            {
+                GSDKFrameMonitor::setBudget(budgetMs > 0 ? static_cast<uint64_t>(budgetMs * 1000.0) : 0, sustainedSeconds);
+            }
+
+            FrameTimeStats GSDK::getFrameTimeStats(unsigned int seconds)
+            {
+                return GSDKFrameMonitor::getStats(seconds);
+            }
+
+            void GSDK::setWatchdogTimeout(unsigned int stallTimeoutMs)
+            {
+                GSDKWatchdog::setTimeout(stallTimeoutMs);
+            }
+
+            void GSDK::petWatchdog()
+            {
+                GSDKWatchdog::pet();
+            }
+
+            ProcessResourceUsage GSDK::getResourceUsage()
+            {
+                GSDKInternal& gsdk = GSDKInternal::get();
+                std::lock_guard<std::mutex> lock(gsdk.m_resourceUsageMutex);
+                return gsdk.m_resourceUsage;
+            }
+
+#ifdef GSDK_LINUX
+            std::unordered_map<std::string, std::vector<int>> GSDK::openListeners(const ListenerOptions &options)
+            {
+                return GSDKListeners::open(GSDKInternal::get().m_connectionInfo.m_gamePortsConfiguration, options);
+            }
+#endif
+
             std::string GSDK::getLogsDirectory()
             {
 				std::lock_guard<std::mutex> lock(GSDKInternal::get().m_configMutex);
@@ -600,9 +954,47 @@ namespace Microsoft
                 }
             }
 
+            SharedContentView GSDK::mapSharedContent(const std::string &relativePath)
+            {
+                return GSDKInternal::get().m_sharedContent.map(relativePath);
+            }
+
+            bool GSDK::prefetchSharedContent(const std::string &relativePath, unsigned long long offset, unsigned long long length)
+            {
+                return GSDKInternal::get().m_sharedContent.prefetch(relativePath, offset, length);
+            }
+
+            std::vector<std::string> GSDK::getSharedContentFiles()
+            {
+                return GSDKInternal::get().m_sharedContent.getFiles();
+            }
+
+            void GSDK::warmSharedContent(const std::vector<std::string> &directories, unsigned int threadCount, double readyFraction)
+            {
+                GSDKInternal &gsdk = GSDKInternal::get();
+                gsdk.m_contentWarmup.start(gsdk.m_sharedContent, directories, threadCount, readyFraction);
+            }
+
+            SharedContentWarmupProgress GSDK::getSharedContentWarmupProgress()
+            {
+                return GSDKInternal::get().m_contentWarmup.getProgress();
+            }
+
+            SharedContentManifest GSDK::getSharedContentManifest(unsigned int threadCount)
+            {
+                return GSDKContentManifest::build(GSDKInternal::get().m_sharedContent, threadCount);
+            }
+
             const std::vector<std::string>& GSDK::getInitialPlayers()
             {
-                return GSDKInternal::get().m_initialPlayers;
+                static const std::vector<std::string> noInitialPlayers;
+
+                GSDKInternal& gsdk = GSDKInternal::get();
+                if (!gsdk.m_initialPlayersPublished.load(std::memory_order_acquire))
+                {
+                    return noInitialPlayers;
+                }
+                return gsdk.m_initialPlayers;
             }
         }
     }
@@ -108,6 +108,151 @@ namespace Microsoft
                 using std::runtime_error::runtime_error;
             };
 
+            /// <summary>
+            /// The state of the game server, as reported to the agent on every heartbeat.
+            /// </summary>
+            enum class GameState
+            {
+                Invalid,
+                Initializing,
+                StandingBy,
+                Active,
+                Terminating,
+                Terminated,
+                Quarantined
+            };
+
+            /// <summary>
+            /// Frame time distribution over the last few seconds, see GSDK::getFrameTimeStats.
+            /// Percentiles are rounded up to the histogram bucket they fall in (within 12.5%).
+            /// </summary>
+            class FrameTimeStats
+            {
+                public:
+                    unsigned long long m_frameCount;
+                    double m_averageMs;
+                    double m_p50Ms;
+                    double m_p90Ms;
+                    double m_p99Ms;
+                    double m_maxMs;
+
+                    FrameTimeStats() : m_frameCount(0), m_averageMs(0), m_p50Ms(0), m_p90Ms(0), m_p99Ms(0), m_maxMs(0) {}
+            };
+
+            /// <summary>
+            /// Resource usage of the game server process, sampled every 5 seconds by the heartbeat thread, see GSDK::getResourceUsage.
+            /// Fields a platform doesn't provide are 0: context switch and thread counts are Linux only, on Windows
+            /// m_openFileDescriptors is the handle count, and the cgroup fields are only set inside a Linux cgroup.
+            /// </summary>
+            class ProcessResourceUsage
+            {
+                public:
+                    unsigned long long m_sampleTimeUnixMs;
+                    double m_cpuPercent;                        // since the previous sample, 100 per fully used core
+                    unsigned long long m_cpuUserMs;
+                    unsigned long long m_cpuSystemMs;
+                    unsigned long long m_residentBytes;
+                    unsigned int m_openFileDescriptors;
+                    unsigned int m_threadCount;
+                    unsigned long long m_voluntaryContextSwitches;
+                    unsigned long long m_involuntaryContextSwitches;
+                    unsigned long long m_cgroupMemoryBytes;
+                    unsigned long long m_cgroupMemoryLimitBytes; // 0 if unlimited
+                    unsigned long long m_cgroupThrottledUs;      // time the cgroup's CPU quota held the process back
+
+                    ProcessResourceUsage() :
+                        m_sampleTimeUnixMs(0), m_cpuPercent(0), m_cpuUserMs(0), m_cpuSystemMs(0), m_residentBytes(0),
+                        m_openFileDescriptors(0), m_threadCount(0), m_voluntaryContextSwitches(0), m_involuntaryContextSwitches(0),
+                        m_cgroupMemoryBytes(0), m_cgroupMemoryLimitBytes(0), m_cgroupThrottledUs(0) {}
+            };
+
+            /// <summary>
+            /// A read-only view of a file in the shared content directory, see GSDK::mapSharedContent.
+            /// The memory is shared with every other server on the VM that maps the same file and stays valid until the process exits.
+            /// </summary>
+            class SharedContentView
+            {
+                public:
+                    const unsigned char *m_data; // nullptr if the file doesn't exist or couldn't be mapped
+                    unsigned long long m_size;
+
+                    SharedContentView() : m_data(nullptr), m_size(0) {}
+            };
+
+            /// <summary>
+            /// Progress of GSDK::warmSharedContent. The totals are 0 until the files have been listed.
+            /// </summary>
+            class SharedContentWarmupProgress
+            {
+                public:
+                    unsigned int m_filesTotal;
+                    unsigned int m_filesDone;
+                    unsigned long long m_bytesTotal;
+                    unsigned long long m_bytesWarm;     // read into memory so far
+                    unsigned long long m_elapsedMs;
+                    double m_megabytesPerSecond;
+                    bool m_finished;
+
+                    SharedContentWarmupProgress() :
+                        m_filesTotal(0), m_filesDone(0), m_bytesTotal(0), m_bytesWarm(0), m_elapsedMs(0), m_megabytesPerSecond(0), m_finished(false) {}
+            };
+
+            /// <summary>
+            /// One file in the shared content manifest, see GSDK::getSharedContentManifest.
+            /// </summary>
+            class SharedContentFileInfo
+            {
+                public:
+                    std::string m_path;                 // relative, '/' separated
+                    unsigned long long m_size;
+                    unsigned long long m_modifiedTime;  // as the OS reports it, only compared for equality
+                    unsigned long long m_hash;          // XXH64 of the XXH64s of each 8 MB chunk of the file
+
+                    SharedContentFileInfo() : m_size(0), m_modifiedTime(0), m_hash(0) {}
+            };
+
+            /// <summary>
+            /// The files in the shared content directory with their hashes, and how much hashing it took to get them.
+            /// </summary>
+            class SharedContentManifest
+            {
+                public:
+                    std::vector<SharedContentFileInfo> m_files;    // sorted by path
+                    unsigned int m_filesHashed;                     // the rest were taken from the manifest on disk
+                    unsigned long long m_bytesHashed;
+                    unsigned long long m_elapsedMs;
+                    double m_gigabytesPerSecond;                    // of the hashing, 0 if nothing was hashed
+
+                    SharedContentManifest() : m_filesHashed(0), m_bytesHashed(0), m_elapsedMs(0), m_gigabytesPerSecond(0) {}
+            };
+
+#ifdef __linux__
+            /// <summary>
+            /// How GSDK::openListeners sets up the sockets of each game port.
+            /// </summary>
+            class ListenerOptions
+            {
+                public:
+                    enum class Protocol
+                    {
+                        Udp,
+                        Tcp
+                    };
+
+                    Protocol m_protocol;
+                    unsigned int m_socketsPerPort;      // 0 for one per CPU the process may run on
+                    int m_receiveBufferBytes;           // SO_RCVBUF, 0 keeps the system default
+                    int m_sendBufferBytes;              // SO_SNDBUF, 0 keeps the system default
+                    int m_busyPollMicroseconds;         // SO_BUSY_POLL, 0 for off; raising it may need CAP_NET_ADMIN
+                    int m_listenBacklog;                // TCP only
+                    bool m_nonBlocking;
+
+                    ListenerOptions() :
+                        m_protocol(Protocol::Udp), m_socketsPerPort(0), m_receiveBufferBytes(0), m_sendBufferBytes(0), m_busyPollMicroseconds(0),
+                        m_listenBacklog(128), m_nonBlocking(true) {}
+            };
+#endif
+
             class GSDK
             {
             public:
@@ -123,6 +268,10 @@ namespace Microsoft
                 /// <returns></returns>
                 static const GameServerConnectionInfo &getGameServerConnectionInfo();
 
+                /// <summary>Returns the current state of the game server (e.g. StandingBy, Active, Terminating).</summary>
+                /// <remarks>Lock-free, safe to call every frame from the game thread.</remarks>
+                static GameState getState();
+
                 /// <summary>Returns all configuration settings</summary>
                 /// <returns>unordered map of string key:value configuration setting values</returns>
                 static std::unordered_map<std::string, std::string> getConfigSettings();
@@ -154,14 +303,153 @@ namespace Microsoft
                 static void registerMaintenanceV2Callback(std::function<void(const MaintenanceSchedule&)> callback);
 
                 /// <summary>outputs a message to the log</summary>
+                /// <remarks>The message is queued and written to disk by a background thread, this never blocks on file I/O.</remarks>
                 static unsigned int logMessage(const std::string &message);
 
+                /// <summary>Sizes the in-memory buffer that log messages wait in before being written to disk.</summary>
+                /// <remarks>Must be called before start(). By default 4096 messages are buffered and messages logged while the buffer is full are dropped.</remarks>
+                /// <param name="capacity">Maximum number of queued messages (rounded up to a power of two).</param>
+                /// <param name="blockWhenFull">Wait for space instead of dropping messages when the buffer is full.</param>
+                static void setLogBufferOptions(unsigned int capacity, bool blockWhenFull = false);
+
+                /// <summary>Bounds the disk space used by the GSDK log.</summary>
+                /// <remarks>
+                /// Must be called before start(). The log is split into segments of at most maxSegmentBytes (minimum 1 MB) and only
+                /// the newest maxSegmentCount segments are kept. Defaults to 8 segments of 16 MB.
+                /// GSDK_output_&lt;time&gt;.index in the log folder lists the segments on disk, oldest first.
+                /// </remarks>
+                static void setLogRotation(unsigned long long maxSegmentBytes, unsigned int maxSegmentCount);
+
+                /// <summary>Writes the GSDK log as compact binary records instead of text.</summary>
+                /// <remarks>
+                /// Must be called before start(). Segments are then named GSDK_output_&lt;time&gt;.bin, .1.bin, ... and are
+                /// turned back into text or JSON lines offline with the GSDK_LogDecoder tool.
+                /// </remarks>
+                static void setBinaryLogging(bool enabled);
+
+                /// <summary>Records timed spans for GSDK startup, heartbeats, callbacks and PlayFab requests.</summary>
+                /// <remarks>
+                /// Call before start() to include startup. The spans are written to GSDK_trace_&lt;time&gt;.json in the log folder
+                /// when the server is shut down, in Chrome trace format (open it in ui.perfetto.dev or chrome://tracing).
+                /// </remarks>
+                static void setTracing(bool enabled);
+
+                /// <summary>Sets a game-defined gauge, e.g. the number of active entities.</summary>
+                /// <remarks>
+                /// Game metrics are aggregated on the recording thread without locks and sent to the agent in one batch
+                /// every 10 seconds by the heartbeat thread. A gauge is only in the batches after it was set, with the last value set.
+                /// A name keeps the kind it was first recorded with, and at most 256 names are tracked.
+                /// </remarks>
+                static void recordMetric(const std::string &name, double value);
+
+                /// <summary>Adds to a game-defined counter, e.g. bytes sent. Each batch reports the total added since the previous one.</summary>
+                static void incrementCounter(const std::string &name, double delta = 1);
+
+                /// <summary>Records one sample of a game-defined distribution, e.g. tick time.</summary>
+                /// <remarks>Each batch reports the sample count, sum and counts per power of two bucket since the previous batch.</remarks>
+                static void recordHistogram(const std::string &name, double value);
+
+                /// <summary>Marks the start of a simulation frame on the calling thread, see frameEnd.</summary>
+                static void frameBegin();
+
+                /// <summary>Records the time since the calling thread's last frameBegin as one frame.</summary>
+                static void frameEnd();
+
+                /// <summary>Records one frame that took durationMs, for games that time their frames themselves.</summary>
+                /// <remarks>Recording is lock free and does not allocate, frames from any thread go into one rolling histogram.</remarks>
+                static void recordFrame(double durationMs);
+
+                /// <summary>Reports the server as Unhealthy while its frames are too slow.</summary>
+                /// <remarks>
+                /// Once the 99th percentile frame time has been above budgetMs in each of the last sustainedSeconds seconds
+                /// (at most 60), heartbeats report Unhealthy regardless of the health callback. Seconds without any frame
+                /// don't count as over budget. A budget of 0 (the default) turns this off.
+                /// </remarks>
+                static void setFrameBudget(double budgetMs, unsigned int sustainedSeconds = 10);
+
+                /// <summary>Returns the frame time distribution over the last seconds seconds (at most 60), including the current one.</summary>
+                static FrameTimeStats getFrameTimeStats(unsigned int seconds = 10);
+
+                /// <summary>Reports the server as Unhealthy when the game stops calling petWatchdog for stallTimeoutMs.</summary>
+                /// <remarks>
+                /// The timer starts when this is called, 0 (the default) turns the watchdog off. When a stall is first detected
+                /// the stacks of all threads are written to the log folder: GSDK_stacks_&lt;time&gt;.txt on Linux (symbol names need
+                /// the game linked with -rdynamic), GSDK_stacks_&lt;time&gt;.dmp, a minidump, on Windows. Heartbeats report Healthy
+                /// again as soon as the game pets the watchdog.
+                /// On Linux the stacks are collected with signal SIGRTMIN+4: the first call with a non-zero timeout installs a
+                /// process-wide handler for it, which stays installed. Games that use that signal themselves shouldn't enable the
+                /// watchdog; without this call the GSDK doesn't touch the signal.
+                /// </remarks>
+                static void setWatchdogTimeout(unsigned int stallTimeoutMs);
+
+                /// <summary>Tells the watchdog the game loop is still making progress, call it once per tick. Lock free.</summary>
+                static void petWatchdog();
+
+                /// <summary>Returns the latest resource usage sample of this process (all zeros before the first heartbeat).</summary>
+                /// <remarks>The same values are published in GSDK_metrics.page and, with debug logs on, written to the log with every sample.</remarks>
+                static ProcessResourceUsage getResourceUsage();
+
+#ifdef __linux__
+                /// <summary>Opens sockets bound to every game port of getGameServerConnectionInfo(), for servers that receive on several threads.</summary>
+                /// <remarks>
+                /// Each port gets m_socketsPerPort sockets bound to 0.0.0.0 with SO_REUSEPORT, so the kernel spreads connections (TCP,
+                /// already listening) or packets (UDP, by flow) over them; give each worker thread one socket. A port whose sockets can't
+                /// all be bound is left out and the error is logged; failing to apply the buffer sizes or busy polling is only logged.
+                /// The caller owns the file descriptors. Linux only, Windows has no load balancing equivalent of SO_REUSEPORT.
+                /// </remarks>
+                /// <returns>The file descriptors for each port, keyed by GamePort::m_name.</returns>
+                static std::unordered_map<std::string, std::vector<int>> openListeners(const ListenerOptions &options = ListenerOptions());
+#endif
+
                 /// <summary>Returns a path to the directory where logs will be mapped to the VM host</summary>
                 static std::string getLogsDirectory();
 
                 /// <summary>Returns a path to the directory shared by all game servers to cache data.</summary>
                 static std::string getSharedContentDirectory();
 
+                /// <summary>Maps a file in the shared content directory into memory, read-only.</summary>
+                /// <remarks>
+                /// Use this instead of reading assets into memory: every server on the VM that maps a file shares the one copy in
+                /// the OS file cache, so it doesn't count against each server's private memory. The file is mapped on first use and
+                /// the same view is returned afterwards; pages are read from disk when first touched unless prefetched.
+                /// Thread safe, but takes a lock, so keep the view rather than calling this per access.
+                /// </remarks>
+                /// <param name="relativePath">Path relative to getSharedContentDirectory(), '/' separated, without "..".</param>
+                static SharedContentView mapSharedContent(const std::string &relativePath);
+
+                /// <summary>Asks the OS to start reading part of a shared content file into memory in the background, mapping it if needed.</summary>
+                /// <remarks>Advisory and non-blocking (madvise MADV_WILLNEED, PrefetchVirtualMemory on Windows). A length of 0 means to the end of the file.</remarks>
+                /// <returns>False if the file can't be mapped or the OS doesn't support prefetching.</returns>
+                static bool prefetchSharedContent(const std::string &relativePath, unsigned long long offset = 0, unsigned long long length = 0);
+
+                /// <summary>Lists the files in the shared content directory (relative, '/' separated), as indexed on first use.</summary>
+                static std::vector<std::string> getSharedContentFiles();
+
+                /// <summary>Reads shared content into the OS file cache on background threads, so the first match doesn't wait on a cold disk.</summary>
+                /// <remarks>
+                /// Call between start() and readyForPlayers(); only the first call does anything. The files are mapped as with
+                /// mapSharedContent and read in 8 MB chunks, each prefetched and then touched page by page by one of threadCount
+                /// threads (at most 16). Progress and throughput are reported by getSharedContentWarmupProgress and logged when done.
+                /// </remarks>
+                /// <param name="directories">Directories relative to getSharedContentDirectory() to warm up, all of it if empty.</param>
+                /// <param name="readyFraction">
+                /// If above 0, readyForPlayers() doesn't report the server as StandingBy until this fraction (up to 1) of the bytes is warm.
+                /// </param>
+                static void warmSharedContent(const std::vector<std::string> &directories = std::vector<std::string>(), unsigned int threadCount = 4, double readyFraction = 0);
+
+                /// <summary>Returns how far warmSharedContent has got.</summary>
+                static SharedContentWarmupProgress getSharedContentWarmupProgress();
+
+                /// <summary>Hashes the files in the shared content directory, so the game can check their integrity.</summary>
+                /// <remarks>
+                /// Files are hashed with XXH64 (fast, not cryptographic) in 8 MB chunks on threadCount threads (at most 16); a file's hash
+                /// is the XXH64 of its chunk hashes, so it differs from the XXH64 of the whole file. The result is
+                /// saved in GSDK_content.manifest in the shared content directory, under a lock so that servers starting together hash
+                /// only once: a later call, from any server on the VM, re-hashes only the files whose size or modification time has
+                /// changed. Blocks until done; the files hashed and the throughput are logged.
+                /// </remarks>
+                static SharedContentManifest getSharedContentManifest(unsigned int threadCount = 4);
+
                 /// <summary>After allocation, returns a list of the initial players that have access to this game server, used by PlayFab's Matchmaking offering</summary>
                 static const std::vector<std::string> &getInitialPlayers();
 
@@ -0,0 +1,327 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+
+#ifdef GSDK_OPENSSL
+
+#include "gsdkCertificates.h"
+#include "gsdkInternal.h"
+#include <dirent.h>
+#include <memory>
+#include <mutex>
+#include <sys/stat.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/pkcs12.h>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            namespace
+            {
+                struct PrivateKey
+                {
+                    std::string m_name; // of the file it came from
+                    EVP_PKEY *m_key;
+                };
+
+                // Deliberately never destroyed: games hold on to the X509, EVP_PKEY and SSL_CTX pointers
+                struct Store
+                {
+                    std::mutex m_mutex; // only guards m_serverContexts, everything else is written once by load()
+                    bool m_loaded = false;
+                    std::vector<std::unique_ptr<GSDKCertificateStore::Certificate>> m_certificates;
+                    std::unordered_map<std::string, const GSDKCertificateStore::Certificate *> m_byKey; // upper case thumbprint and name
+                    std::unordered_map<const GSDKCertificateStore::Certificate *, SSL_CTX *> m_serverContexts;
+                };
+
+                Store &getStore()
+                {
+                    static Store *store = new Store();
+                    return *store;
+                }
+
+                std::string toUpper(std::string value)
+                {
+                    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) { return static_cast<char>(toupper(c)); });
+                    return value;
+                }
+
+                std::string getThumbprint(X509 *certificate)
+                {
+                    unsigned char digest[EVP_MAX_MD_SIZE];
+                    unsigned int length = 0;
+                    if (X509_digest(certificate, EVP_sha1(), digest, &length) == 0)
+                    {
+                        return std::string();
+                    }
+
+                    static const char hexDigits[] = "0123456789ABCDEF";
+                    std::string thumbprint;
+                    for (unsigned int i = 0; i < length; ++i)
+                    {
+                        thumbprint.push_back(hexDigits[digest[i] >> 4]);
+                        thumbprint.push_back(hexDigits[digest[i] & 0xf]);
+                    }
+                    return thumbprint;
+                }
+
+                // Reads every certificate and key in a PEM file; PEM_read_bio_* skip the blocks of other types
+                void readPem(BIO *file, std::vector<X509 *> &certificates, std::vector<EVP_PKEY *> &keys)
+                {
+                    while (X509 *certificate = PEM_read_bio_X509(file, nullptr, nullptr, nullptr))
+                    {
+                        certificates.push_back(certificate);
+                    }
+
+                    (void)BIO_reset(file);
+                    while (EVP_PKEY *key = PEM_read_bio_PrivateKey(file, nullptr, nullptr, nullptr))
+                    {
+                        keys.push_back(key);
+                    }
+
+                    // Not a PEM certificate, maybe a DER encoded one
+                    if (certificates.empty() && keys.empty())
+                    {
+                        (void)BIO_reset(file);
+                        if (X509 *certificate = d2i_X509_bio(file, nullptr))
+                        {
+                            certificates.push_back(certificate);
+                        }
+                    }
+                }
+
+                void readPkcs12(BIO *file, std::vector<X509 *> &certificates, std::vector<EVP_PKEY *> &keys)
+                {
+                    PKCS12 *pkcs12 = d2i_PKCS12_bio(file, nullptr);
+                    if (pkcs12 == nullptr)
+                    {
+                        return;
+                    }
+
+                    EVP_PKEY *key = nullptr;
+                    X509 *certificate = nullptr;
+                    STACK_OF(X509) *chain = nullptr;
+                    if (PKCS12_parse(pkcs12, "", &key, &certificate, &chain) != 0)
+                    {
+                        if (certificate != nullptr)
+                        {
+                            certificates.push_back(certificate);
+                        }
+                        if (key != nullptr)
+                        {
+                            keys.push_back(key);
+                        }
+                        for (int i = 0; chain != nullptr && i < sk_X509_num(chain); ++i)
+                        {
+                            certificates.push_back(sk_X509_value(chain, i));
+                        }
+                        sk_X509_free(chain); // the certificates now belong to the store
+                    }
+                    PKCS12_free(pkcs12);
+                }
+
+                void addCertificate(Store &store, std::unique_ptr<GSDKCertificateStore::Certificate> certificate)
+                {
+                    // The first file wins a name, thumbprints are unique anyway
+                    store.m_byKey.emplace(certificate->m_thumbprint, certificate.get());
+                    store.m_byKey.emplace(toUpper(certificate->m_name), certificate.get());
+                    store.m_certificates.push_back(std::move(certificate));
+                }
+            }
+
+            size_t GSDKCertificateStore::load(const std::string &folder)
+            {
+                Store &store = getStore();
+                if (store.m_loaded)
+                {
+                    return store.m_certificates.size();
+                }
+                store.m_loaded = true;
+
+                DIR *directory = folder.empty() ? nullptr : opendir(folder.c_str());
+                if (directory == nullptr)
+                {
+                    return 0;
+                }
+
+                std::vector<std::string> fileNames;
+                while (dirent *entry = readdir(directory))
+                {
+                    if (entry->d_name[0] != '.')
+                    {
+                        fileNames.push_back(entry->d_name);
+                    }
+                }
+                closedir(directory);
+                std::sort(fileNames.begin(), fileNames.end());
+
+                std::string folderPrefix = folder.back() == '/' ? folder : folder + "/";
+                std::vector<PrivateKey> unmatchedKeys;
+                for (const std::string &fileName : fileNames)
+                {
+                    std::string path = folderPrefix + fileName;
+                    struct stat fileInfo;
+                    if (stat(path.c_str(), &fileInfo) != 0 || !S_ISREG(fileInfo.st_mode))
+                    {
+                        continue;
+                    }
+
+                    size_t dot = fileName.find_last_of('.');
+                    std::string name = fileName.substr(0, dot);
+                    std::string extension = dot == std::string::npos ? "" : toUpper(fileName.substr(dot + 1));
+
+                    BIO *file = BIO_new_file(path.c_str(), "rb");
+                    if (file == nullptr)
+                    {
+                        GSDK_LOG(Warning, CertificateFileUnreadable, path);
+                        continue;
+                    }
+
+                    std::vector<X509 *> certificates;
+                    std::vector<EVP_PKEY *> keys;
+                    if (extension == "PFX" || extension == "P12")
+                    {
+                        readPkcs12(file, certificates, keys);
+                    }
+                    else
+                    {
+                        readPem(file, certificates, keys);
+                    }
+                    BIO_free(file);
+                    ERR_clear_error(); // running out of PEM blocks leaves an error behind
+
+                    if (certificates.empty() && keys.empty())
+                    {
+                        GSDK_LOG(Warning, CertificateFileUnreadable, path);
+                        continue;
+                    }
+
+                    if (!certificates.empty())
+                    {
+                        std::unique_ptr<Certificate> certificate(new Certificate());
+                        certificate->m_name = name;
+                        certificate->m_path = path;
+                        certificate->m_certificate = certificates[0];
+                        certificate->m_thumbprint = getThumbprint(certificates[0]);
+                        certificate->m_privateKey = nullptr;
+                        certificate->m_chain.assign(certificates.begin() + 1, certificates.end());
+                        for (EVP_PKEY *key : keys)
+                        {
+                            if (certificate->m_privateKey == nullptr && X509_check_private_key(certificate->m_certificate, key) == 1)
+                            {
+                                certificate->m_privateKey = key;
+                            }
+                            else
+                            {
+                                unmatchedKeys.push_back({ name, key });
+                            }
+                        }
+                        addCertificate(store, std::move(certificate));
+                    }
+                    else
+                    {
+                        for (EVP_PKEY *key : keys)
+                        {
+                            unmatchedKeys.push_back({ name, key });
+                        }
+                    }
+                }
+
+                // Keys in their own files, e.g. server.crt and server.key: same name first, then whatever matches
+                for (const std::unique_ptr<Certificate> &certificate : store.m_certificates)
+                {
+                    for (int pass = 0; pass < 2 && certificate->m_privateKey == nullptr; ++pass)
+                    {
+                        for (const PrivateKey &key : unmatchedKeys)
+                        {
+                            if ((pass == 1 || key.m_name == certificate->m_name) && X509_check_private_key(certificate->m_certificate, key.m_key) == 1)
+                            {
+                                certificate->m_privateKey = key.m_key;
+                                break;
+                            }
+                        }
+                    }
+                }
+                ERR_clear_error();
+
+                return store.m_certificates.size();
+            }
+
+            const GSDKCertificateStore::Certificate *GSDKCertificateStore::find(const std::string &thumbprintOrName)
+            {
+                Store &store = getStore();
+                auto it = store.m_byKey.find(toUpper(thumbprintOrName));
+                return it == store.m_byKey.end() ? nullptr : it->second;
+            }
+
+            std::vector<const GSDKCertificateStore::Certificate *> GSDKCertificateStore::getAll()
+            {
+                Store &store = getStore();
+                std::vector<const Certificate *> certificates;
+                for (const std::unique_ptr<Certificate> &certificate : store.m_certificates)
+                {
+                    certificates.push_back(certificate.get());
+                }
+                return certificates;
+            }
+
+            SSL_CTX *GSDKCertificateStore::getServerContext(const std::string &thumbprintOrName)
+            {
+                const Certificate *certificate = find(thumbprintOrName);
+                if (certificate == nullptr || certificate->m_privateKey == nullptr)
+                {
+                    return nullptr;
+                }
+
+                Store &store = getStore();
+                std::lock_guard<std::mutex> lock(store.m_mutex);
+                auto cached = store.m_serverContexts.find(certificate);
+                if (cached != store.m_serverContexts.end())
+                {
+                    return cached->second;
+                }
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+                SSL_library_init();
+                SSL_CTX *context = SSL_CTX_new(SSLv23_server_method());
+#else
+                SSL_CTX *context = SSL_CTX_new(TLS_server_method());
+#endif
+                if (context == nullptr)
+                {
+                    return nullptr;
+                }
+
+                bool succeeded = SSL_CTX_use_certificate(context, certificate->m_certificate) == 1 &&
+                                 SSL_CTX_use_PrivateKey(context, certificate->m_privateKey) == 1;
+                for (X509 *chainCertificate : certificate->m_chain)
+                {
+                    // The context takes ownership of extra chain certificates, give it its own copy
+                    X509 *copy = X509_dup(chainCertificate);
+                    if (copy == nullptr || SSL_CTX_add_extra_chain_cert(context, copy) != 1)
+                    {
+                        X509_free(copy);
+                        succeeded = false;
+                    }
+                }
+
+                if (!succeeded)
+                {
+                    ERR_clear_error();
+                    SSL_CTX_free(context);
+                    return nullptr;
+                }
+
+                store.m_serverContexts[certificate] = context;
+                return context;
+            }
+        }
+    }
+}
+
+#endif
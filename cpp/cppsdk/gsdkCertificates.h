@@ -0,0 +1,56 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            /// <summary>
+            /// The certificates and private keys in the certificate folder (GSDK::CERTIFICATE_FOLDER_KEY), parsed once by GSDK::start().
+            /// </summary>
+            /// <remarks>
+            /// Only available when the GSDK is built with OpenSSL (CMake defines GSDK_OPENSSL when it finds it, Linux only);
+            /// link the game against ssl and crypto. PEM files (.pem, .crt, .cer, .key, any number of certificates and keys
+            /// each, the first certificate being the leaf and the rest its chain) and PKCS#12 files without a password
+            /// (.pfx, .p12) are read. Every pointer handed out is owned by the store and lives until the process exits.
+            /// </remarks>
+            class GSDKCertificateStore
+            {
+            public:
+                struct Certificate
+                {
+                    std::string m_name;        // file name without the extension
+                    std::string m_thumbprint;  // SHA-1, upper case hex, as in the build's certificate configuration
+                    std::string m_path;
+                    X509 *m_certificate;
+                    EVP_PKEY *m_privateKey;    // nullptr if no key in the folder matches the certificate
+                    std::vector<X509 *> m_chain;
+                };
+
+                /// <summary>Finds a certificate by thumbprint (case insensitive) or by name. Returns nullptr if there is none.</summary>
+                static const Certificate *find(const std::string &thumbprintOrName);
+
+                /// <summary>Every certificate that was loaded, in file name order.</summary>
+                static std::vector<const Certificate *> getAll();
+
+                /// <summary>
+                /// A server SSL_CTX with the certificate, its chain and its private key, created on first use and shared by every
+                /// caller. Returns nullptr if there is no such certificate or no key for it. Callers may adjust options, ciphers etc.
+                /// </summary>
+                static SSL_CTX *getServerContext(const std::string &thumbprintOrName);
+
+                /// <summary>Parses every file in folder. Called by GSDK::start(); only the first call loads anything.</summary>
+                /// <returns>The number of certificates loaded.</returns>
+                static size_t load(const std::string &folder);
+            };
+        }
+    }
+}
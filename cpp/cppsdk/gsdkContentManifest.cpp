@@ -0,0 +1,376 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkContentManifest.h"
+#include "gsdkInternal.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+
+#ifdef GSDK_LINUX
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            constexpr const char *GSDKContentManifest::c_manifestFileName;
+            constexpr const char *GSDKContentManifest::c_lockFileName;
+            constexpr uint64_t GSDKContentManifest::c_chunkBytes;
+            constexpr unsigned int GSDKContentManifest::c_maxThreads;
+
+            namespace
+            {
+                constexpr uint64_t c_prime1 = 11400714785074694791ULL;
+                constexpr uint64_t c_prime2 = 14029467366897019727ULL;
+                constexpr uint64_t c_prime3 = 1609587929392839161ULL;
+                constexpr uint64_t c_prime4 = 9650029242287828579ULL;
+                constexpr uint64_t c_prime5 = 2870177450012600261ULL;
+
+                inline uint64_t rotateLeft(uint64_t value, int bits)
+                {
+                    return (value << bits) | (value >> (64 - bits));
+                }
+
+                inline uint64_t read64(const unsigned char *data)
+                {
+                    uint64_t value;
+                    memcpy(&value, data, sizeof(value));
+                    return value;
+                }
+
+                inline uint32_t read32(const unsigned char *data)
+                {
+                    uint32_t value;
+                    memcpy(&value, data, sizeof(value));
+                    return value;
+                }
+
+                inline uint64_t hashRound(uint64_t accumulator, uint64_t input)
+                {
+                    accumulator += input * c_prime2;
+                    accumulator = rotateLeft(accumulator, 31);
+                    return accumulator * c_prime1;
+                }
+
+                inline uint64_t mergeRound(uint64_t accumulator, uint64_t value)
+                {
+                    accumulator ^= hashRound(0, value);
+                    return accumulator * c_prime1 + c_prime4;
+                }
+
+                // Holds the manifest lock for as long as it exists; not locked if the lock file can't be created
+                class ManifestLock
+                {
+                public:
+                    explicit ManifestLock(const std::string &path)
+                    {
+#ifdef GSDK_LINUX
+                        m_file = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+                        m_locked = m_file >= 0 && flock(m_file, LOCK_EX) == 0;
+#else
+                        m_file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+                        OVERLAPPED overlapped = {};
+                        m_locked = m_file != INVALID_HANDLE_VALUE && LockFileEx(m_file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped);
+#endif
+                    }
+
+                    ~ManifestLock()
+                    {
+                        // Closing the file releases the lock
+#ifdef GSDK_LINUX
+                        if (m_file >= 0)
+                        {
+                            close(m_file);
+                        }
+#else
+                        if (m_file != INVALID_HANDLE_VALUE)
+                        {
+                            CloseHandle(m_file);
+                        }
+#endif
+                    }
+
+                    bool isLocked() const
+                    {
+                        return m_locked;
+                    }
+
+                private:
+#ifdef GSDK_LINUX
+                    int m_file;
+#else
+                    HANDLE m_file;
+#endif
+                    bool m_locked;
+                };
+
+                struct PendingFile
+                {
+                    size_t m_index; // in SharedContentManifest::m_files
+                    SharedContentView m_view;
+                    std::vector<uint64_t> m_chunkHashes;
+                };
+
+                struct HashJob
+                {
+                    const unsigned char *m_data;
+                    uint64_t m_length;
+                    uint64_t *m_result;
+                };
+            }
+
+            uint64_t GSDKContentManifest::hash(const void *data, size_t length, uint64_t seed)
+            {
+                const unsigned char *input = static_cast<const unsigned char *>(data);
+                const unsigned char *end = input + length;
+                uint64_t result;
+
+                if (length >= 32)
+                {
+                    uint64_t accumulators[4] = { seed + c_prime1 + c_prime2, seed + c_prime2, seed, seed - c_prime1 };
+                    const unsigned char *lastStripe = end - 32;
+                    do
+                    {
+                        accumulators[0] = hashRound(accumulators[0], read64(input));
+                        accumulators[1] = hashRound(accumulators[1], read64(input + 8));
+                        accumulators[2] = hashRound(accumulators[2], read64(input + 16));
+                        accumulators[3] = hashRound(accumulators[3], read64(input + 24));
+                        input += 32;
+                    } while (input <= lastStripe);
+
+                    result = rotateLeft(accumulators[0], 1) + rotateLeft(accumulators[1], 7) + rotateLeft(accumulators[2], 12) + rotateLeft(accumulators[3], 18);
+                    for (uint64_t accumulator : accumulators)
+                    {
+                        result = mergeRound(result, accumulator);
+                    }
+                }
+                else
+                {
+                    result = seed + c_prime5;
+                }
+
+                result += static_cast<uint64_t>(length);
+
+                for (; input + 8 <= end; input += 8)
+                {
+                    result ^= hashRound(0, read64(input));
+                    result = rotateLeft(result, 27) * c_prime1 + c_prime4;
+                }
+                if (input + 4 <= end)
+                {
+                    result ^= static_cast<uint64_t>(read32(input)) * c_prime1;
+                    result = rotateLeft(result, 23) * c_prime2 + c_prime3;
+                    input += 4;
+                }
+                for (; input < end; ++input)
+                {
+                    result ^= (*input) * c_prime5;
+                    result = rotateLeft(result, 11) * c_prime1;
+                }
+
+                result ^= result >> 33;
+                result *= c_prime2;
+                result ^= result >> 29;
+                result *= c_prime3;
+                result ^= result >> 32;
+                return result;
+            }
+
+#ifdef GSDK_LINUX
+            bool GSDKContentManifest::getFileInfo(const std::string &path, SharedContentFileInfo &file)
+            {
+                struct stat fileInfo;
+                if (stat(path.c_str(), &fileInfo) != 0)
+                {
+                    return false;
+                }
+                file.m_size = static_cast<unsigned long long>(fileInfo.st_size);
+                file.m_modifiedTime = static_cast<unsigned long long>(fileInfo.st_mtim.tv_sec) * 1000000000ULL + static_cast<unsigned long long>(fileInfo.st_mtim.tv_nsec);
+                return true;
+            }
+#else
+            bool GSDKContentManifest::getFileInfo(const std::string &path, SharedContentFileInfo &file)
+            {
+                WIN32_FILE_ATTRIBUTE_DATA fileInfo;
+                if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &fileInfo))
+                {
+                    return false;
+                }
+                file.m_size = (static_cast<unsigned long long>(fileInfo.nFileSizeHigh) << 32) | fileInfo.nFileSizeLow;
+                file.m_modifiedTime = (static_cast<unsigned long long>(fileInfo.ftLastWriteTime.dwHighDateTime) << 32) | fileInfo.ftLastWriteTime.dwLowDateTime;
+                return true;
+            }
+#endif
+
+            bool GSDKContentManifest::readManifest(const std::string &path, std::vector<SharedContentFileInfo> &files)
+            {
+                std::ifstream manifest(path);
+                if (!manifest)
+                {
+                    return false;
+                }
+
+                std::string line;
+                while (std::getline(manifest, line))
+                {
+                    std::istringstream fields(line);
+                    SharedContentFileInfo file;
+                    fields >> std::hex >> file.m_hash >> std::dec >> file.m_size >> file.m_modifiedTime;
+                    fields.get(); // the space before the path, which may contain spaces itself
+                    if (fields && std::getline(fields, file.m_path) && !file.m_path.empty())
+                    {
+                        files.push_back(file);
+                    }
+                }
+                return true;
+            }
+
+            bool GSDKContentManifest::writeManifest(const std::string &path, const std::vector<SharedContentFileInfo> &files)
+            {
+                // Replaced in one rename, so servers that read the manifest without the lock never see half of it
+                std::string temporaryPath = path + ".tmp";
+                {
+                    std::ofstream manifest(temporaryPath, std::ios::trunc);
+                    char hash[17];
+                    for (const SharedContentFileInfo &file : files)
+                    {
+                        snprintf(hash, sizeof(hash), "%016llx", file.m_hash);
+                        manifest << hash << ' ' << file.m_size << ' ' << file.m_modifiedTime << ' ' << file.m_path << '\n';
+                    }
+                    if (!manifest.flush())
+                    {
+                        return false;
+                    }
+                }
+#ifdef GSDK_LINUX
+                return rename(temporaryPath.c_str(), path.c_str()) == 0;
+#else
+                return MoveFileExA(temporaryPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+#endif
+            }
+
+            SharedContentManifest GSDKContentManifest::build(GSDKSharedContent &content, unsigned int threadCount)
+            {
+                SharedContentManifest result;
+                std::string root = content.getRoot();
+                if (root.empty())
+                {
+                    return result;
+                }
+
+                auto startTime = std::chrono::steady_clock::now();
+                std::string manifestPath = root + c_manifestFileName;
+                ManifestLock lock(root + c_lockFileName);
+
+                std::vector<SharedContentFileInfo> previous;
+                readManifest(manifestPath, previous);
+                std::unordered_map<std::string, const SharedContentFileInfo *> previousByPath;
+                for (const SharedContentFileInfo &file : previous)
+                {
+                    previousByPath[file.m_path] = &file;
+                }
+
+                // Revalidate by size and modification time, map everything else for hashing
+                std::vector<PendingFile> pending;
+                for (const std::string &path : content.getFiles())
+                {
+                    if (path.compare(0, strlen(c_manifestFileName), c_manifestFileName) == 0)
+                    {
+                        continue; // the manifest, its lock and its temporary file
+                    }
+
+                    SharedContentFileInfo file;
+                    file.m_path = path;
+                    if (!getFileInfo(root + path, file))
+                    {
+                        continue; // deleted since the index was built
+                    }
+
+                    auto it = previousByPath.find(path);
+                    if (it != previousByPath.end() && it->second->m_size == file.m_size && it->second->m_modifiedTime == file.m_modifiedTime)
+                    {
+                        file.m_hash = it->second->m_hash;
+                        result.m_files.push_back(file);
+                        continue;
+                    }
+
+                    SharedContentView view = content.map(path);
+                    if (view.m_data == nullptr)
+                    {
+                        continue;
+                    }
+
+                    file.m_size = view.m_size;
+                    pending.push_back({ result.m_files.size(), view, std::vector<uint64_t>(static_cast<size_t>((view.m_size + c_chunkBytes - 1) / c_chunkBytes)) });
+                    result.m_files.push_back(file);
+                    result.m_bytesHashed += view.m_size;
+                }
+
+                std::vector<HashJob> jobs;
+                for (PendingFile &file : pending)
+                {
+                    for (size_t chunk = 0; chunk < file.m_chunkHashes.size(); ++chunk)
+                    {
+                        uint64_t offset = chunk * c_chunkBytes;
+                        jobs.push_back({ file.m_view.m_data + offset, std::min<uint64_t>(c_chunkBytes, file.m_view.m_size - offset), &file.m_chunkHashes[chunk] });
+                    }
+                }
+
+                // The calling thread works too
+                auto hashStartTime = std::chrono::steady_clock::now();
+                std::atomic<size_t> nextJob(0);
+                auto worker = [&jobs, &nextJob]()
+                {
+                    size_t job;
+                    while ((job = nextJob++) < jobs.size())
+                    {
+                        *jobs[job].m_result = hash(jobs[job].m_data, static_cast<size_t>(jobs[job].m_length));
+                    }
+                };
+                threadCount = std::min(std::max(threadCount, 1u), c_maxThreads);
+                std::vector<std::thread> threads;
+                for (unsigned int i = 1; i < threadCount && i < jobs.size(); ++i)
+                {
+                    threads.emplace_back(worker);
+                }
+                worker();
+                for (std::thread &thread : threads)
+                {
+                    thread.join();
+                }
+                double hashSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - hashStartTime).count();
+
+                for (const PendingFile &file : pending)
+                {
+                    result.m_files[file.m_index].m_hash = hash(file.m_chunkHashes.data(), file.m_chunkHashes.size() * sizeof(uint64_t));
+                }
+                result.m_filesHashed = static_cast<unsigned int>(pending.size());
+
+                std::sort(result.m_files.begin(), result.m_files.end(),
+                    [](const SharedContentFileInfo &left, const SharedContentFileInfo &right) { return left.m_path < right.m_path; });
+                bool changed = result.m_filesHashed > 0 || result.m_files.size() != previous.size();
+                if (changed && !(lock.isLocked() && writeManifest(manifestPath, result.m_files)))
+                {
+                    GSDK_LOG(Warning, ContentManifestNotSaved, manifestPath);
+                }
+
+                result.m_elapsedMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count());
+                if (result.m_bytesHashed > 0 && hashSeconds > 0)
+                {
+                    result.m_gigabytesPerSecond = result.m_bytesHashed / (1024.0 * 1024.0 * 1024.0) / hashSeconds;
+                }
+                GSDK_LOG(Info, ContentManifestBuilt, static_cast<unsigned int>(result.m_files.size()), result.m_filesHashed, result.m_bytesHashed,
+                    result.m_elapsedMs, result.m_gigabytesPerSecond);
+                return result;
+            }
+        }
+    }
+}
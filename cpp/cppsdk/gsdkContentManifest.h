@@ -0,0 +1,47 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "gsdk.h"
+#include "gsdkSharedContent.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // The shared content manifest behind GSDK::getSharedContentManifest.
+            //
+            // GSDK_content.manifest holds one line per file: hash (16 hex digits), size, modification time and path.
+            // The hash is a chunked tree hash, not the XXH64 of the file: the file is split into c_chunkBytes (8 MB)
+            // chunks, each chunk is hashed with XXH64, and the file's hash is XXH64 over the array of chunk hashes
+            // (64-bit each, in file order). Only tools that hash the same way will reproduce it.
+            // build() takes an exclusive lock on GSDK_content.manifest.lock (flock / LockFileEx), reuses the hash of
+            // every file whose size and modification time match the manifest, hashes the rest from their shared
+            // content mappings in parallel, and replaces the manifest if anything changed.
+            class GSDKContentManifest
+            {
+            public:
+                static SharedContentManifest build(GSDKSharedContent &content, unsigned int threadCount);
+
+                // XXH64 of one buffer; build() applies it per chunk and then to the chunk hashes
+                static uint64_t hash(const void *data, size_t length, uint64_t seed = 0);
+
+                static constexpr const char *c_manifestFileName = "GSDK_content.manifest";
+                static constexpr const char *c_lockFileName = "GSDK_content.manifest.lock";
+                static constexpr uint64_t c_chunkBytes = 8 * 1024 * 1024;
+                static constexpr unsigned int c_maxThreads = 16;
+
+            private:
+                static bool readManifest(const std::string &path, std::vector<SharedContentFileInfo> &files);
+                static bool writeManifest(const std::string &path, const std::vector<SharedContentFileInfo> &files);
+                static bool getFileInfo(const std::string &path, SharedContentFileInfo &file); // size and modification time
+            };
+        }
+    }
+}
@@ -0,0 +1,213 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkContentWarmup.h"
+#include "gsdkInternal.h"
+
+#ifdef GSDK_LINUX
+#include <unistd.h>
+#endif
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            constexpr uint64_t GSDKContentWarmup::c_chunkBytes;
+            constexpr unsigned int GSDKContentWarmup::c_maxThreads;
+
+            namespace
+            {
+                size_t getPageSize()
+                {
+#ifdef GSDK_LINUX
+                    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+                    SYSTEM_INFO systemInfo;
+                    GetSystemInfo(&systemInfo);
+                    return systemInfo.dwPageSize;
+#endif
+                }
+            }
+
+            GSDKContentWarmup::GSDKContentWarmup() :
+                m_content(nullptr), m_readyFraction(0), m_started(false), m_planned(false), m_filesTotal(0), m_bytesTotal(0),
+                m_stop(false), m_nextChunk(0), m_bytesWarm(0), m_filesDone(0), m_threadsRunning(0), m_elapsedMs(0)
+            {
+            }
+
+            GSDKContentWarmup::~GSDKContentWarmup()
+            {
+                m_stop = true;
+                for (std::thread &thread : m_threads)
+                {
+                    thread.join();
+                }
+            }
+
+            bool GSDKContentWarmup::start(GSDKSharedContent &content, const std::vector<std::string> &directories, unsigned int threadCount, double readyFraction)
+            {
+                bool first = false;
+                std::call_once(m_startOnce, [&first]() { first = true; });
+                if (!first)
+                {
+                    return false;
+                }
+
+                m_content = &content;
+                for (std::string directory : directories)
+                {
+                    std::replace(directory.begin(), directory.end(), '\\', '/');
+                    if (!directory.empty() && directory.back() != '/')
+                    {
+                        directory += '/';
+                    }
+                    m_directories.push_back(directory);
+                }
+                m_readyFraction = std::min(std::max(readyFraction, 0.0), 1.0);
+                m_startTime = std::chrono::steady_clock::now();
+
+                threadCount = std::min(std::max(threadCount, 1u), c_maxThreads);
+                m_threadsRunning = threadCount;
+                m_started = true;
+                for (unsigned int i = 0; i < threadCount; ++i)
+                {
+                    m_threads.emplace_back(&GSDKContentWarmup::workerThreadFunc, this);
+                }
+                return true;
+            }
+
+            void GSDKContentWarmup::plan()
+            {
+                uint64_t bytesTotal = 0;
+                for (const std::string &path : m_content->getFiles())
+                {
+                    bool selected = m_directories.empty();
+                    for (const std::string &directory : m_directories)
+                    {
+                        selected = selected || directory.empty() || directory == "./" || path.compare(0, directory.size(), directory) == 0;
+                    }
+                    if (!selected)
+                    {
+                        continue;
+                    }
+
+                    SharedContentView view = m_content->map(path);
+                    if (view.m_data == nullptr || view.m_size == 0)
+                    {
+                        continue;
+                    }
+
+                    std::unique_ptr<File> file(new File());
+                    file->m_path = path;
+                    file->m_view = view;
+                    file->m_chunksLeft = static_cast<size_t>((view.m_size + c_chunkBytes - 1) / c_chunkBytes);
+                    for (uint64_t offset = 0; offset < view.m_size; offset += c_chunkBytes)
+                    {
+                        m_chunks.push_back({ m_files.size(), offset, std::min<uint64_t>(c_chunkBytes, view.m_size - offset) });
+                    }
+                    bytesTotal += view.m_size;
+                    m_files.push_back(std::move(file));
+                }
+
+                m_filesTotal = static_cast<unsigned int>(m_files.size());
+                m_bytesTotal = bytesTotal;
+                m_planned = true;
+            }
+
+            void GSDKContentWarmup::warmChunk(const Chunk &chunk)
+            {
+                File &file = *m_files[chunk.m_file];
+                m_content->prefetch(file.m_path, chunk.m_offset, chunk.m_length);
+
+                // Wait for the read by faulting every page in; the sum keeps the compiler from dropping the loads
+                static const size_t pageSize = getPageSize();
+                const volatile unsigned char *data = file.m_view.m_data + chunk.m_offset;
+                unsigned char sum = 0;
+                for (uint64_t offset = 0; offset < chunk.m_length; offset += pageSize)
+                {
+                    sum += data[offset];
+                }
+                (void)sum;
+
+                // Count the file before its bytes: waitUntilReady returns on m_bytesWarm, and getProgress must not
+                // then see every byte warm but the last file still pending
+                if (--file.m_chunksLeft == 0)
+                {
+                    ++m_filesDone;
+                }
+                m_bytesWarm += chunk.m_length;
+            }
+
+            void GSDKContentWarmup::workerThreadFunc()
+            {
+                std::call_once(m_planOnce, &GSDKContentWarmup::plan, this);
+
+                size_t chunkIndex;
+                while (!m_stop && (chunkIndex = m_nextChunk++) < m_chunks.size())
+                {
+                    warmChunk(m_chunks[chunkIndex]);
+                    if (m_readyFraction > 0)
+                    {
+                        std::lock_guard<std::mutex> lock(m_readyMutex);
+                        m_readyCondition.notify_all();
+                    }
+                }
+
+                if (--m_threadsRunning == 0)
+                {
+                    uint64_t elapsedMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_startTime).count());
+                    m_elapsedMs = elapsedMs;
+                    if (!m_stop)
+                    {
+                        GSDK_LOG(Info, SharedContentWarmedUp, m_filesDone.load(), m_bytesWarm.load(), elapsedMs, getProgress().m_megabytesPerSecond);
+                    }
+
+                    std::lock_guard<std::mutex> lock(m_readyMutex);
+                    m_readyCondition.notify_all();
+                }
+            }
+
+            SharedContentWarmupProgress GSDKContentWarmup::getProgress()
+            {
+                SharedContentWarmupProgress progress;
+                if (!m_started)
+                {
+                    return progress;
+                }
+
+                progress.m_finished = m_threadsRunning == 0;
+                progress.m_filesTotal = m_filesTotal;
+                progress.m_filesDone = m_filesDone;
+                progress.m_bytesTotal = m_bytesTotal;
+                progress.m_bytesWarm = m_bytesWarm;
+                progress.m_elapsedMs = m_elapsedMs;
+                if (!progress.m_finished || progress.m_elapsedMs == 0)
+                {
+                    progress.m_elapsedMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_startTime).count());
+                }
+                if (progress.m_elapsedMs > 0)
+                {
+                    progress.m_megabytesPerSecond = (progress.m_bytesWarm / (1024.0 * 1024.0)) / (progress.m_elapsedMs / 1000.0);
+                }
+                return progress;
+            }
+
+            void GSDKContentWarmup::waitUntilReady()
+            {
+                if (!m_started || m_readyFraction <= 0)
+                {
+                    return;
+                }
+
+                std::unique_lock<std::mutex> lock(m_readyMutex);
+                m_readyCondition.wait(lock, [this]()
+                {
+                    return m_threadsRunning == 0 ||
+                           (m_planned && static_cast<double>(m_bytesWarm.load()) >= m_readyFraction * static_cast<double>(m_bytesTotal.load()));
+                });
+            }
+        }
+    }
+}
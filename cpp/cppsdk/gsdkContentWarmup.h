@@ -0,0 +1,96 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gsdk.h"
+#include "gsdkSharedContent.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Pulls shared content into the OS file cache on a small thread pool, behind GSDK::warmSharedContent.
+            //
+            // The first worker maps the selected files and splits them into chunks, then every worker claims chunks
+            // in order: it prefetches the chunk (MADV_WILLNEED / PrefetchVirtualMemory) so the OS reads it with large
+            // requests, and touches one byte per page so the chunk is known to be resident when it's counted. Pages
+            // touched this way are shared with every other server mapping the file, they don't add private memory.
+            class GSDKContentWarmup
+            {
+            public:
+                GSDKContentWarmup();
+                ~GSDKContentWarmup();
+
+                GSDKContentWarmup(const GSDKContentWarmup &) = delete;
+                GSDKContentWarmup &operator=(const GSDKContentWarmup &) = delete;
+
+                // Only the first call starts anything
+                bool start(GSDKSharedContent &content, const std::vector<std::string> &directories, unsigned int threadCount, double readyFraction);
+
+                SharedContentWarmupProgress getProgress();
+
+                // Blocks until readyFraction of the bytes are warm or the warmup has finished; returns at once if none was started
+                void waitUntilReady();
+
+                static constexpr uint64_t c_chunkBytes = 8 * 1024 * 1024;
+                static constexpr unsigned int c_maxThreads = 16;
+
+            private:
+                struct Chunk
+                {
+                    size_t m_file;
+                    uint64_t m_offset;
+                    uint64_t m_length;
+                };
+
+                struct File
+                {
+                    std::string m_path;
+                    SharedContentView m_view;
+                    std::atomic<size_t> m_chunksLeft;
+                };
+
+                void workerThreadFunc();
+                void plan();
+                void warmChunk(const Chunk &chunk);
+
+                GSDKSharedContent *m_content;
+                std::vector<std::string> m_directories; // with a trailing '/'
+                double m_readyFraction;
+                std::vector<std::thread> m_threads;
+                std::once_flag m_startOnce;
+                std::once_flag m_planOnce;
+                std::chrono::steady_clock::time_point m_startTime;
+
+                // Written by plan(), only read by the workers afterwards
+                std::vector<std::unique_ptr<File>> m_files;
+                std::vector<Chunk> m_chunks;
+
+                std::atomic<bool> m_started; // set once start() has set everything up
+                std::atomic<bool> m_planned; // m_filesTotal and m_bytesTotal are final
+                std::atomic<unsigned int> m_filesTotal;
+                std::atomic<uint64_t> m_bytesTotal;
+                std::atomic<bool> m_stop;
+                std::atomic<size_t> m_nextChunk;
+                std::atomic<uint64_t> m_bytesWarm;
+                std::atomic<unsigned int> m_filesDone;
+                std::atomic<unsigned int> m_threadsRunning;
+                std::atomic<uint64_t> m_elapsedMs; // set by the last worker to finish
+
+                std::mutex m_readyMutex;
+                std::condition_variable m_readyCondition;
+            };
+        }
+    }
+}
@@ -0,0 +1,332 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkCustomMetrics.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            constexpr size_t GSDKCustomMetrics::c_maxMetrics;
+            constexpr size_t GSDKCustomMetrics::c_histogramBuckets;
+
+            namespace
+            {
+                constexpr int c_smallestBucketExponent = -10;
+                constexpr uint32_t c_invalidMetricId = static_cast<uint32_t>(-1);
+
+                // One metric on one thread. The atomics are written by the owning thread only, the
+                // m_reported* fields are only touched by collect() while it holds the registry mutex.
+                struct MetricSlot
+                {
+                    std::atomic<uint64_t> m_count{ 0 };
+                    std::atomic<double> m_sum{ 0 };          // for gauges, the last value
+                    std::atomic<uint64_t> m_updatedNs{ 0 };  // gauges only, picks the newest value across threads
+                    std::atomic<uint64_t> m_buckets[GSDKCustomMetrics::c_histogramBuckets] = {};
+
+                    uint64_t m_reportedCount = 0;
+                    double m_reportedSum = 0;
+                    uint64_t m_reportedBuckets[GSDKCustomMetrics::c_histogramBuckets] = {};
+                };
+
+                struct CachedId
+                {
+                    uint32_t m_id;
+                    GSDKCustomMetrics::Kind m_kind;
+                };
+
+                // Slots are allocated the first time the thread records that metric and published with a
+                // release store, so collect() never sees a half constructed slot.
+                struct ThreadMetrics
+                {
+                    std::atomic<MetricSlot *> m_slots[GSDKCustomMetrics::c_maxMetrics] = {};
+                    std::unordered_map<std::string, CachedId> m_ids; // owning thread only
+                    bool m_inUse = true;                              // guarded by the registry mutex
+                };
+
+                // Blocks outlive their thread: whatever it recorded since the last collect() still gets
+                // reported, and a new thread adopts the block instead of allocating another one.
+                struct Registry
+                {
+                    std::mutex m_mutex;
+                    std::vector<std::string> m_names;
+                    std::vector<GSDKCustomMetrics::Kind> m_kinds;
+                    std::unordered_map<std::string, uint32_t> m_ids;
+                    std::vector<std::unique_ptr<ThreadMetrics>> m_threads;
+                };
+
+                // Deliberately never destroyed, game threads may still record while statics are torn down
+                Registry &getRegistry()
+                {
+                    static Registry *registry = new Registry();
+                    return *registry;
+                }
+
+                // Hands the block back to the registry when its thread exits
+                struct ThreadMetricsOwner
+                {
+                    ThreadMetrics *m_metrics = nullptr;
+
+                    ~ThreadMetricsOwner()
+                    {
+                        if (m_metrics != nullptr)
+                        {
+                            Registry &registry = getRegistry();
+                            std::lock_guard<std::mutex> lock(registry.m_mutex);
+                            m_metrics->m_inUse = false;
+                        }
+                    }
+                };
+
+                ThreadMetrics &getThreadMetrics()
+                {
+                    static thread_local ThreadMetricsOwner owner;
+                    if (owner.m_metrics == nullptr)
+                    {
+                        Registry &registry = getRegistry();
+                        std::lock_guard<std::mutex> lock(registry.m_mutex);
+                        for (const std::unique_ptr<ThreadMetrics> &thread : registry.m_threads)
+                        {
+                            if (!thread->m_inUse)
+                            {
+                                thread->m_inUse = true;
+                                owner.m_metrics = thread.get();
+                                break;
+                            }
+                        }
+                        if (owner.m_metrics == nullptr)
+                        {
+                            registry.m_threads.emplace_back(new ThreadMetrics());
+                            owner.m_metrics = registry.m_threads.back().get();
+                        }
+                    }
+                    return *owner.m_metrics;
+                }
+
+                CachedId lookUpMetric(ThreadMetrics &thread, const std::string &name, GSDKCustomMetrics::Kind kind)
+                {
+                    auto cached = thread.m_ids.find(name);
+                    if (cached != thread.m_ids.end())
+                    {
+                        return cached->second;
+                    }
+
+                    CachedId id = { c_invalidMetricId, kind };
+                    {
+                        Registry &registry = getRegistry();
+                        std::lock_guard<std::mutex> lock(registry.m_mutex);
+                        auto registered = registry.m_ids.find(name);
+                        if (registered != registry.m_ids.end())
+                        {
+                            id.m_id = registered->second;
+                            id.m_kind = registry.m_kinds[registered->second];
+                        }
+                        else if (registry.m_names.size() < GSDKCustomMetrics::c_maxMetrics)
+                        {
+                            id.m_id = static_cast<uint32_t>(registry.m_names.size());
+                            registry.m_names.push_back(name);
+                            registry.m_kinds.push_back(kind);
+                            registry.m_ids[name] = id.m_id;
+                        }
+                    }
+
+                    // Names that didn't fit are cached too, so they don't take the registry lock every time
+                    thread.m_ids[name] = id;
+                    return id;
+                }
+
+                size_t getBucketIndex(double value)
+                {
+                    if (!(value > 0))
+                    {
+                        return 0;
+                    }
+
+                    // value < 2^exponent, so the first bound above it is bucket exponent - c_smallestBucketExponent
+                    int exponent = 0;
+                    std::frexp(value, &exponent);
+                    int index = exponent - c_smallestBucketExponent;
+                    if (index < 0)
+                    {
+                        return 0;
+                    }
+                    return std::min(static_cast<size_t>(index), GSDKCustomMetrics::c_histogramBuckets - 1);
+                }
+
+                // Single writer, so a plain load and store is enough and avoids a locked instruction
+                void addRelaxed(std::atomic<uint64_t> &counter, uint64_t value)
+                {
+                    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+                }
+
+                void addRelaxed(std::atomic<double> &sum, double value)
+                {
+                    sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+                }
+
+                const char *getKindName(GSDKCustomMetrics::Kind kind)
+                {
+                    switch (kind)
+                    {
+                        case GSDKCustomMetrics::Kind::Counter: return "Counter";
+                        case GSDKCustomMetrics::Kind::Gauge: return "Gauge";
+                        default: return "Histogram";
+                    }
+                }
+            }
+
+            void GSDKCustomMetrics::record(const std::string &name, Kind kind, double value)
+            {
+                ThreadMetrics &thread = getThreadMetrics();
+                CachedId id = lookUpMetric(thread, name, kind);
+                if (id.m_id == c_invalidMetricId || id.m_kind != kind)
+                {
+                    return;
+                }
+
+                MetricSlot *slot = thread.m_slots[id.m_id].load(std::memory_order_relaxed);
+                if (slot == nullptr)
+                {
+                    slot = new MetricSlot();
+                    thread.m_slots[id.m_id].store(slot, std::memory_order_release);
+                }
+
+                switch (kind)
+                {
+                    case Kind::Counter:
+                        addRelaxed(slot->m_count, 1);
+                        addRelaxed(slot->m_sum, value);
+                        break;
+                    case Kind::Gauge:
+                        slot->m_sum.store(value, std::memory_order_relaxed);
+                        slot->m_updatedNs.store(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch()).count()), std::memory_order_release);
+                        addRelaxed(slot->m_count, 1);
+                        break;
+                    case Kind::Histogram:
+                        addRelaxed(slot->m_buckets[getBucketIndex(value)], 1);
+                        addRelaxed(slot->m_sum, value);
+                        addRelaxed(slot->m_count, 1);
+                        break;
+                }
+            }
+
+            std::string GSDKCustomMetrics::collect(uint64_t intervalMs)
+            {
+                Registry &registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+                Json::Value metrics(Json::arrayValue);
+                for (size_t id = 0; id < registry.m_names.size(); ++id)
+                {
+                    Kind kind = registry.m_kinds[id];
+                    uint64_t count = 0;
+                    double sum = 0;
+                    uint64_t buckets[c_histogramBuckets] = {};
+                    uint64_t newestGaugeNs = 0;
+
+                    // Every thread's slot is read once and its totals moved to m_reported*, so a value recorded
+                    // while this runs is simply part of the next batch. Count, sum and buckets are read one after
+                    // the other and may be off by the record in flight.
+                    for (const std::unique_ptr<ThreadMetrics> &thread : registry.m_threads)
+                    {
+                        MetricSlot *slot = thread->m_slots[id].load(std::memory_order_acquire);
+                        if (slot == nullptr)
+                        {
+                            continue;
+                        }
+
+                        uint64_t slotCount = slot->m_count.load(std::memory_order_relaxed);
+                        count += slotCount - slot->m_reportedCount;
+                        slot->m_reportedCount = slotCount;
+
+                        if (kind == Kind::Gauge)
+                        {
+                            uint64_t updatedNs = slot->m_updatedNs.load(std::memory_order_acquire);
+                            if (updatedNs > newestGaugeNs)
+                            {
+                                newestGaugeNs = updatedNs;
+                                sum = slot->m_sum.load(std::memory_order_relaxed);
+                            }
+                            continue;
+                        }
+
+                        double slotSum = slot->m_sum.load(std::memory_order_relaxed);
+                        sum += slotSum - slot->m_reportedSum;
+                        slot->m_reportedSum = slotSum;
+
+                        if (kind == Kind::Histogram)
+                        {
+                            for (size_t bucket = 0; bucket < c_histogramBuckets; ++bucket)
+                            {
+                                uint64_t slotBucket = slot->m_buckets[bucket].load(std::memory_order_relaxed);
+                                buckets[bucket] += slotBucket - slot->m_reportedBuckets[bucket];
+                                slot->m_reportedBuckets[bucket] = slotBucket;
+                            }
+                        }
+                    }
+
+                    // Metrics nobody touched since the previous batch are left out, gauges included: a gauge
+                    // set in this interval is newer than any earlier value, so sum is the one it was set to
+                    if (count == 0)
+                    {
+                        continue;
+                    }
+
+                    Json::Value metric;
+                    metric["name"] = registry.m_names[id];
+                    metric["type"] = getKindName(kind);
+                    if (kind == Kind::Histogram)
+                    {
+                        metric["count"] = static_cast<Json::UInt64>(count);
+                        metric["sum"] = sum;
+
+                        Json::Value jsonBuckets(Json::arrayValue);
+                        for (size_t bucket = 0; bucket < c_histogramBuckets; ++bucket)
+                        {
+                            if (buckets[bucket] != 0)
+                            {
+                                Json::Value jsonBucket;
+                                jsonBucket["lessThan"] = bucket + 1 < c_histogramBuckets ? Json::Value(getBucketBound(bucket)) : Json::Value("Infinity");
+                                jsonBucket["count"] = static_cast<Json::UInt64>(buckets[bucket]);
+                                jsonBuckets.append(jsonBucket);
+                            }
+                        }
+                        metric["buckets"] = jsonBuckets;
+                    }
+                    else
+                    {
+                        metric["value"] = sum;
+                    }
+                    metrics.append(metric);
+                }
+
+                if (metrics.empty())
+                {
+                    return std::string();
+                }
+
+                Json::Value batch;
+                batch["intervalMs"] = static_cast<Json::UInt64>(intervalMs);
+                batch["metrics"] = metrics;
+
+                Json::StreamWriterBuilder writer;
+                writer["indentation"] = "";
+                return Json::writeString(writer, batch);
+            }
+
+            double GSDKCustomMetrics::getBucketBound(size_t index)
+            {
+                return std::ldexp(1.0, static_cast<int>(index) + c_smallestBucketExponent);
+            }
+        }
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Aggregates the counters, gauges and histograms a game records through GSDK::incrementCounter,
+            // GSDK::recordMetric and GSDK::recordHistogram, until the heartbeat thread collects them.
+            //
+            // Every thread aggregates into its own block of slots and is the only writer of it, so recording
+            // is a lookup in a thread local name cache plus a few relaxed atomic stores, no lock and no shared
+            // cache line. The values are cumulative; collect() remembers what it reported last time and sends
+            // the difference, so recording threads never have to reset anything.
+            class GSDKCustomMetrics
+            {
+            public:
+                enum class Kind : uint8_t
+                {
+                    Counter,   // sum of the recorded values over the interval
+                    Gauge,     // last recorded value, from whichever thread recorded it last; only sent after it was set
+                    Histogram, // count, sum and power of two buckets over the interval
+                };
+
+                // A name keeps the kind it was first recorded with; values recorded under another kind are ignored,
+                // as are new names once c_maxMetrics are in use.
+                static void record(const std::string &name, Kind kind, double value);
+
+                // The metrics recorded since the previous call as a JSON batch, or an empty string if nothing changed.
+                // Only called from one thread at a time (the heartbeat thread).
+                static std::string collect(uint64_t intervalMs);
+
+                // Upper bound of histogram bucket index, values above the last bound land in the last bucket
+                static double getBucketBound(size_t index);
+
+                static constexpr size_t c_maxMetrics = 256;
+                static constexpr size_t c_histogramBuckets = 40; // 2^-10 .. 2^28, then everything larger
+            };
+        }
+    }
+}
@@ -0,0 +1,231 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkFrameMonitor.h"
+#include <chrono>
+#include <cmath>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            constexpr unsigned int GSDKFrameMonitor::c_windowCount;
+            constexpr unsigned int GSDKFrameMonitor::c_maxSeconds;
+            constexpr unsigned int GSDKFrameMonitor::c_bucketCount;
+            std::atomic<uint64_t> GSDKFrameMonitor::m_budgetUs(0);
+            std::atomic<unsigned int> GSDKFrameMonitor::m_sustainedSeconds(10);
+
+            static_assert(GSDKFrameMonitor::c_maxSeconds < GSDKFrameMonitor::c_windowCount,
+                "The ring must hold the longest window plus the second in progress");
+
+            namespace
+            {
+                constexpr unsigned int c_subBucketBits = 3;
+                constexpr unsigned int c_subBucketCount = 1 << c_subBucketBits;
+
+                // One second of frames. The first frame of a new second claims the window with a CAS on m_second
+                // and clears it; frames recorded on other threads during that clear may be lost, which only
+                // matters for games that record frames from several threads at once.
+                struct FrameWindow
+                {
+                    std::atomic<uint64_t> m_second{ 0 };
+                    std::atomic<uint32_t> m_frameCount{ 0 };
+                    std::atomic<uint64_t> m_totalUs{ 0 };
+                    std::atomic<uint64_t> m_maxUs{ 0 };
+                    std::atomic<uint32_t> m_buckets[GSDKFrameMonitor::c_bucketCount] = {};
+                };
+
+                FrameWindow *getWindows()
+                {
+                    static FrameWindow windows[GSDKFrameMonitor::c_windowCount];
+                    return windows;
+                }
+
+                uint64_t getCurrentSecond()
+                {
+                    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+                }
+
+                struct MergedWindows
+                {
+                    uint64_t m_frameCount = 0;
+                    uint64_t m_totalUs = 0;
+                    uint64_t m_maxUs = 0;
+                    uint64_t m_buckets[GSDKFrameMonitor::c_bucketCount] = {};
+                };
+
+                // Adds the windows of seconds [first, last] that are still in the ring
+                void mergeWindows(uint64_t first, uint64_t last, MergedWindows &merged)
+                {
+                    FrameWindow *windows = getWindows();
+                    for (uint64_t second = first; second <= last; ++second)
+                    {
+                        FrameWindow &window = windows[second % GSDKFrameMonitor::c_windowCount];
+                        if (window.m_second.load(std::memory_order_acquire) != second)
+                        {
+                            continue;
+                        }
+
+                        merged.m_frameCount += window.m_frameCount.load(std::memory_order_relaxed);
+                        merged.m_totalUs += window.m_totalUs.load(std::memory_order_relaxed);
+                        merged.m_maxUs = std::max(merged.m_maxUs, window.m_maxUs.load(std::memory_order_relaxed));
+                        for (unsigned int bucket = 0; bucket < GSDKFrameMonitor::c_bucketCount; ++bucket)
+                        {
+                            merged.m_buckets[bucket] += window.m_buckets[bucket].load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                double getPercentileMs(const MergedWindows &merged, double percentile)
+                {
+                    if (merged.m_frameCount == 0)
+                    {
+                        return 0;
+                    }
+
+                    // The buckets are read one by one while frames are recorded, they may add up to a little more or
+                    // less than m_frameCount; the last non-empty bucket then stands in for the top of the range.
+                    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile * merged.m_frameCount));
+                    uint64_t seen = 0;
+                    uint64_t valueUs = 0;
+                    for (unsigned int bucket = 0; bucket < GSDKFrameMonitor::c_bucketCount; ++bucket)
+                    {
+                        if (merged.m_buckets[bucket] == 0)
+                        {
+                            continue;
+                        }
+                        seen += merged.m_buckets[bucket];
+                        valueUs = GSDKFrameMonitor::getBucketUpperBoundUs(bucket);
+                        if (seen >= rank)
+                        {
+                            break;
+                        }
+                    }
+                    return std::min(valueUs, merged.m_maxUs) / 1000.0;
+                }
+            }
+
+            unsigned int GSDKFrameMonitor::getBucketIndex(uint64_t durationUs)
+            {
+                if (durationUs < c_subBucketCount)
+                {
+                    return static_cast<unsigned int>(durationUs);
+                }
+
+                unsigned int exponent = 0;
+                for (uint64_t value = durationUs; value > 1; value >>= 1)
+                {
+                    ++exponent;
+                }
+
+                unsigned int subBucket = static_cast<unsigned int>(durationUs >> (exponent - c_subBucketBits)) & (c_subBucketCount - 1);
+                unsigned int index = (exponent - c_subBucketBits + 1) * c_subBucketCount + subBucket;
+                return std::min(index, c_bucketCount - 1);
+            }
+
+            uint64_t GSDKFrameMonitor::getBucketUpperBoundUs(unsigned int index)
+            {
+                if (index < c_subBucketCount)
+                {
+                    return index + 1;
+                }
+
+                unsigned int shift = index / c_subBucketCount - 1;
+                uint64_t lowerBound = static_cast<uint64_t>(c_subBucketCount + index % c_subBucketCount) << shift;
+                return lowerBound + (1ULL << shift);
+            }
+
+            void GSDKFrameMonitor::record(uint64_t durationUs)
+            {
+                uint64_t second = getCurrentSecond();
+                FrameWindow &window = getWindows()[second % c_windowCount];
+
+                uint64_t windowSecond = window.m_second.load(std::memory_order_acquire);
+                if (windowSecond != second)
+                {
+                    if (windowSecond > second)
+                    {
+                        return; // this thread was preempted across a second boundary, the frame is too late to count
+                    }
+                    if (window.m_second.compare_exchange_strong(windowSecond, second, std::memory_order_acq_rel))
+                    {
+                        window.m_frameCount.store(0, std::memory_order_relaxed);
+                        window.m_totalUs.store(0, std::memory_order_relaxed);
+                        window.m_maxUs.store(0, std::memory_order_relaxed);
+                        for (std::atomic<uint32_t> &bucket : window.m_buckets)
+                        {
+                            bucket.store(0, std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                window.m_buckets[getBucketIndex(durationUs)].fetch_add(1, std::memory_order_relaxed);
+                window.m_totalUs.fetch_add(durationUs, std::memory_order_relaxed);
+                window.m_frameCount.fetch_add(1, std::memory_order_relaxed);
+
+                uint64_t maxUs = window.m_maxUs.load(std::memory_order_relaxed);
+                while (durationUs > maxUs && !window.m_maxUs.compare_exchange_weak(maxUs, durationUs, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            void GSDKFrameMonitor::setBudget(uint64_t budgetUs, unsigned int sustainedSeconds)
+            {
+                m_sustainedSeconds.store(std::max(1u, std::min(sustainedSeconds, c_maxSeconds)), std::memory_order_relaxed);
+                m_budgetUs.store(budgetUs, std::memory_order_relaxed);
+            }
+
+            FrameTimeStats GSDKFrameMonitor::getStats(unsigned int seconds)
+            {
+                seconds = std::max(1u, std::min(seconds, c_maxSeconds));
+                uint64_t now = getCurrentSecond();
+
+                MergedWindows merged;
+                mergeWindows(now - seconds + 1, now, merged);
+
+                FrameTimeStats stats;
+                stats.m_frameCount = merged.m_frameCount;
+                if (merged.m_frameCount > 0)
+                {
+                    stats.m_averageMs = static_cast<double>(merged.m_totalUs) / merged.m_frameCount / 1000.0;
+                    stats.m_p50Ms = getPercentileMs(merged, 0.50);
+                    stats.m_p90Ms = getPercentileMs(merged, 0.90);
+                    stats.m_p99Ms = getPercentileMs(merged, 0.99);
+                    stats.m_maxMs = merged.m_maxUs / 1000.0;
+                }
+                return stats;
+            }
+
+            bool GSDKFrameMonitor::isOverBudget(double &sustainedP99Ms, double &budgetMs, unsigned int &sustainedSeconds)
+            {
+                uint64_t budgetUs = m_budgetUs.load(std::memory_order_relaxed);
+                if (budgetUs == 0)
+                {
+                    return false;
+                }
+                budgetMs = budgetUs / 1000.0;
+                sustainedSeconds = m_sustainedSeconds.load(std::memory_order_relaxed);
+
+                // Only complete seconds: the one in progress may have just started
+                uint64_t now = getCurrentSecond();
+                sustainedP99Ms = 0;
+                for (uint64_t second = now - sustainedSeconds; second < now; ++second)
+                {
+                    MergedWindows merged;
+                    mergeWindows(second, second, merged);
+
+                    double p99Ms = getPercentileMs(merged, 0.99);
+                    if (merged.m_frameCount == 0 || p99Ms <= budgetMs)
+                    {
+                        return false;
+                    }
+                    sustainedP99Ms = sustainedP99Ms == 0 ? p99Ms : std::min(sustainedP99Ms, p99Ms);
+                }
+                return true;
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "gsdk.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Rolling histogram of frame times behind GSDK::recordFrame and the frame budget health check.
+            //
+            // Frames land in one histogram per second of the steady clock, kept in a ring of c_windowCount
+            // windows. Buckets are log-linear (8 per power of two microseconds), so recording is a handful
+            // of relaxed atomic adds and percentiles are accurate to within one bucket.
+            class GSDKFrameMonitor
+            {
+            public:
+                static void record(uint64_t durationUs);
+
+                // budgetUs 0 turns the health check off
+                static void setBudget(uint64_t budgetUs, unsigned int sustainedSeconds);
+
+                // Over the last seconds seconds, including the one in progress
+                static FrameTimeStats getStats(unsigned int seconds);
+
+                // True if every one of the last sustainedSeconds complete seconds had frames and a p99 above budget.
+                // sustainedP99Ms is the lowest of those percentiles, i.e. how far over budget the server stayed.
+                static bool isOverBudget(double &sustainedP99Ms, double &budgetMs, unsigned int &sustainedSeconds);
+
+                static constexpr unsigned int c_windowCount = 64;
+                static constexpr unsigned int c_maxSeconds = 60;
+                static constexpr unsigned int c_bucketCount = 208; // up to 2^27 us (about 2 minutes)
+
+                // Index of the histogram bucket a duration falls in and the (exclusive) upper bound of a bucket
+                static unsigned int getBucketIndex(uint64_t durationUs);
+                static uint64_t getBucketUpperBoundUs(unsigned int index);
+
+            private:
+                static std::atomic<uint64_t> m_budgetUs;
+                static std::atomic<unsigned int> m_sustainedSeconds;
+            };
+        }
+    }
+}
@@ -4,11 +4,46 @@
 #pragma once
 
 #include "gsdk.h"
+#include "gsdkContentManifest.h"
+#include "gsdkContentWarmup.h"
+#include "gsdkCustomMetrics.h"
+#include "gsdkFrameMonitor.h"
 #include "gsdkLog.h"
+#include "gsdkLogWriter.h"
+#include "gsdkLogThrottle.h"
+#include "gsdkMetricsPage.h"
+#include "gsdkResourceSampler.h"
+#include "gsdkSharedContent.h"
+#include "gsdkWatchdog.h"
 #include "gsdkUtils.h"
 #include "ManualResetEvent.h"
 #include "gsdkConfig.h"
 
+// Structured logging for GSDK internals: GSDK_LOG(Level, Format, args...), with Level from GSDKLogLevel and
+// Format from GSDK_LOG_FORMATS. Only the format id and raw arguments are recorded on the calling thread,
+// and call sites below GSDK_LOG_MIN_LEVEL compile to nothing.
+#define GSDK_LOG(LEVEL, ...) \
+    do \
+    { \
+        if (::Microsoft::Azure::Gaming::isLogLevelCompiledIn(::Microsoft::Azure::Gaming::GSDKLogLevel::LEVEL)) \
+        { \
+            ::Microsoft::Azure::Gaming::GSDKInternal::log(::Microsoft::Azure::Gaming::GSDKLogLevel::LEVEL, ::Microsoft::Azure::Gaming::GSDKLogFormat::__VA_ARGS__); \
+        } \
+    } while (0)
+
+// GSDK_LOG for call sites that can repeat indefinitely (e.g. every heartbeat while the agent is unreachable).
+// Identical records collapse into a repeat count and each call site is capped per window, see GSDKLogThrottle.
+// The throttle is leaked on purpose, the heartbeat thread can still log while statics are being destroyed.
+#define GSDK_LOG_THROTTLED(LEVEL, ...) \
+    do \
+    { \
+        if (::Microsoft::Azure::Gaming::isLogLevelCompiledIn(::Microsoft::Azure::Gaming::GSDKLogLevel::LEVEL)) \
+        { \
+            static ::Microsoft::Azure::Gaming::GSDKLogThrottle &gsdkLogThrottle = *new ::Microsoft::Azure::Gaming::GSDKLogThrottle(); \
+            ::Microsoft::Azure::Gaming::GSDKInternal::logThrottled(gsdkLogThrottle, ::Microsoft::Azure::Gaming::GSDKLogLevel::LEVEL, ::Microsoft::Azure::Gaming::GSDKLogFormat::__VA_ARGS__); \
+        } \
+    } while (0)
+
 namespace Microsoft
 {
     namespace Azure
@@ -27,16 +62,15 @@ namespace Microsoft
                 DO( Terminated ) \
                 DO( Quarantined ) \
 
-            enum class GameState // send to Agent
-            {
-                GAME_STATES(MAKE_ENUM)
-            };
-
+            // GameState itself is public (gsdk.h), these names must stay in the same order
             const char* const GameStateNames[] =
             {
                 GAME_STATES(MAKE_STRINGS)
             };
 
+            static_assert(sizeof(GameStateNames) / sizeof(GameStateNames[0]) == static_cast<size_t>(GameState::Quarantined) + 1,
+                "GameStateNames is out of sync with the GameState enum");
+
             #define GAME_OPERATIONS(DO) \
                 DO( Invalid ) \
                 DO( Continue ) \
@@ -93,10 +127,14 @@ namespace Microsoft
                 {
                     m_currentGameState = GameState::Initializing;
                     m_isGameHealthy = true;
+                    m_isOverFrameBudget = false;
+                    m_isStalled = false;
                 }
 
-                volatile GameState m_currentGameState;
-                bool m_isGameHealthy;
+                std::atomic<GameState> m_currentGameState;
+                bool m_isGameHealthy;       // what the health callback last said
+                bool m_isOverFrameBudget;   // frames have been too slow, see GSDK::setFrameBudget
+                bool m_isStalled;           // the game stopped petting the watchdog, see GSDK::setWatchdogTimeout
                 std::vector<ConnectedPlayer> m_connectedPlayers;
             };
 
@@ -128,6 +166,20 @@ namespace Microsoft
                 GSDKInternal();
                 ~GSDKInternal();
 
+                // Use GSDK_LOG rather than calling this directly
+                template <typename... Args>
+                static void log(GSDKLogLevel level, GSDKLogFormat format, const Args &... args)
+                {
+                    m_logWriter.writeRecord(level, format, args...);
+                }
+
+                // Use GSDK_LOG_THROTTLED rather than calling this directly
+                template <typename... Args>
+                static void logThrottled(GSDKLogThrottle &throttle, GSDKLogLevel level, GSDKLogFormat format, const Args &... args)
+                {
+                    throttle.log(m_logWriter, level, format, args...);
+                }
+
             private:
                 // NOTE: Making this map non-static, because otherwise the heartbeat thread
                 // will throw an access violation exception when the game server main loop returns
@@ -143,6 +195,8 @@ namespace Microsoft
                 std::string m_sessionCookie;
                 int m_heatbeatInterval;
                 std::string m_heartbeatUrl;
+                std::string m_customMetricsUrl;
+                std::chrono::steady_clock::time_point m_lastCustomMetricsSend; // heartbeat thread only
 
                 std::function<void()> m_shutdownCallback;
                 std::function<bool()> m_healthCallback;
@@ -172,21 +226,46 @@ namespace Microsoft
                 std::string m_receivedData;
                 ManualResetEvent m_transitionToActiveEvent;
                 ManualResetEvent m_signalHeartbeatEvent;
-                std::mutex m_stateMutex;
                 std::mutex m_playersMutex;
 
+                // Written once by the heartbeat thread, then published through m_initialPlayersPublished
+                // and never modified again, so readers can hold on to the reference without a lock.
                 std::vector<std::string> m_initialPlayers;
+                std::atomic<bool> m_initialPlayersPublished;
 
+                // m_instance owns the object, m_instancePtr is what the public API reads. It is only
+                // stored once construction has finished, so get() never needs m_gsdkInitMutex after that.
                 static std::unique_ptr<GSDKInternal> m_instance;
+                static std::atomic<GSDKInternal *> m_instancePtr;
                 static std::mutex m_gsdkInitMutex;
 
                 static volatile long long m_exitStatus;
-                static std::mutex m_logLock;
-                static std::ofstream m_logFile;
+                static GSDKLogWriter &m_logWriter; // leaked on purpose, like the GSDK_LOG_THROTTLED throttles
+                static GSDKLogWriter::Options m_logOptions;
+                std::string m_tracePath; // empty if the log wasn't started
+                std::string m_logFolder; // with a trailing separator, only valid if m_tracePath isn't empty
+
+                // Only touched by the heartbeat thread, published to the page after every heartbeat
+                GSDKMetricsPage m_metricsPage;
+                GSDKMetricsSnapshot m_metrics;
+                std::chrono::steady_clock::time_point m_startTime;
+
+                // Sampled by the heartbeat thread, m_resourceUsage is copied out under m_resourceUsageMutex
+                GSDKResourceSampler m_resourceSampler;
+                std::chrono::steady_clock::time_point m_lastResourceSample;
+                std::mutex m_resourceUsageMutex;
+                ProcessResourceUsage m_resourceUsage;
+
+                GSDKSharedContent m_sharedContent;
+                GSDKContentWarmup m_contentWarmup; // after m_sharedContent, its threads use it
 
                 void heartbeatThreadFunc(std::string infoUrl);
-                static size_t curlReceiveData(char *buffer, size_t blockSize, size_t blockCount, void *);
-                static void runShutdownCallback();
+                static size_t curlReceiveData(char *buffer, size_t blockSize, size_t blockCount, void *userData);
+                void runShutdownCallback();
+                void writeTrace();
+                void publishMetrics();
+                void sampleResources();
+                void checkWatchdog();
                 
                 static bool m_debug;
 
@@ -194,6 +273,7 @@ namespace Microsoft
                 void resetCurl();
                 void sendHeartbeat();
                 void receiveHeartbeatResponse();
+                void sendCustomMetrics();
 
                 // These two methods are used for unit testing as well as regular operation.
                 std::string encodeHeartbeatRequest();
@@ -202,6 +282,7 @@ namespace Microsoft
                 int m_nextHeartbeatIntervalMs;
 
                 std::tm parseDate(const std::string &dateStr);
+                GameState getState() const;
                 void setState(GameState state);
                 void setConnectedPlayers(const std::vector<ConnectedPlayer> &currentConnectedPlayers);
 
@@ -0,0 +1,137 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+
+#ifdef GSDK_LINUX
+
+#include "gsdkListeners.h"
+#include "gsdkInternal.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            unsigned int GSDKListeners::getCpuCount()
+            {
+                cpu_set_t cpus;
+                CPU_ZERO(&cpus);
+                if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0 && CPU_COUNT(&cpus) > 0)
+                {
+                    return static_cast<unsigned int>(CPU_COUNT(&cpus));
+                }
+                long onlineCpus = sysconf(_SC_NPROCESSORS_ONLN);
+                return onlineCpus > 0 ? static_cast<unsigned int>(onlineCpus) : 1;
+            }
+
+            void GSDKListeners::setOption(int socket, int level, int option, int value, const char *optionName, const GamePort &port, bool &logged)
+            {
+                // Tuning only, the socket works without it; logged once per port rather than per socket
+                if (setsockopt(socket, level, option, &value, sizeof(value)) != 0 && !logged)
+                {
+                    logged = true;
+                    GSDK_LOG(Warning, ListenerOptionFailed, optionName, port.m_name, errno);
+                }
+            }
+
+            int GSDKListeners::openSocket(const GamePort &port, unsigned int index, const ListenerOptions &options, OptionFailures &failures)
+            {
+                bool isTcp = options.m_protocol == ListenerOptions::Protocol::Tcp;
+                int type = (isTcp ? SOCK_STREAM : SOCK_DGRAM) | SOCK_CLOEXEC | (options.m_nonBlocking ? SOCK_NONBLOCK : 0);
+                int listener = socket(AF_INET, type, 0);
+                if (listener < 0)
+                {
+                    GSDK_LOG(Error, ListenerFailed, index, port.m_name, port.m_serverListeningPort, "socket", errno);
+                    return -1;
+                }
+
+                // Before bind and listen: the TCP window scale is negotiated from the receive buffer at connect time,
+                // and accepted TCP sockets inherit all of these from the listener
+                if (options.m_receiveBufferBytes > 0)
+                {
+                    setOption(listener, SOL_SOCKET, SO_RCVBUF, options.m_receiveBufferBytes, "SO_RCVBUF", port, failures.m_receiveBuffer);
+                }
+                if (options.m_sendBufferBytes > 0)
+                {
+                    setOption(listener, SOL_SOCKET, SO_SNDBUF, options.m_sendBufferBytes, "SO_SNDBUF", port, failures.m_sendBuffer);
+                }
+                if (options.m_busyPollMicroseconds > 0)
+                {
+                    setOption(listener, SOL_SOCKET, SO_BUSY_POLL, options.m_busyPollMicroseconds, "SO_BUSY_POLL", port, failures.m_busyPoll);
+                }
+
+                const char *failedCall = nullptr;
+                int one = 1;
+                sockaddr_in address = {};
+                address.sin_family = AF_INET;
+                address.sin_addr.s_addr = htonl(INADDR_ANY);
+                address.sin_port = htons(static_cast<uint16_t>(port.m_serverListeningPort));
+                if (setsockopt(listener, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) != 0)
+                {
+                    failedCall = "setsockopt(SO_REUSEPORT)";
+                }
+                else if (bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+                {
+                    failedCall = "bind";
+                }
+                else if (isTcp && listen(listener, options.m_listenBacklog) != 0)
+                {
+                    failedCall = "listen";
+                }
+
+                if (failedCall != nullptr)
+                {
+                    GSDK_LOG(Error, ListenerFailed, index, port.m_name, port.m_serverListeningPort, failedCall, errno);
+                    close(listener);
+                    return -1;
+                }
+                return listener;
+            }
+
+            std::unordered_map<std::string, std::vector<int>> GSDKListeners::open(const std::vector<GamePort> &ports, const ListenerOptions &options)
+            {
+                std::unordered_map<std::string, std::vector<int>> listeners;
+                unsigned int socketsPerPort = options.m_socketsPerPort > 0 ? options.m_socketsPerPort : getCpuCount();
+                const char *protocol = options.m_protocol == ListenerOptions::Protocol::Tcp ? "TCP" : "UDP";
+
+                for (const GamePort &port : ports)
+                {
+                    std::vector<int> sockets;
+                    OptionFailures failures;
+                    for (unsigned int i = 0; i < socketsPerPort; ++i)
+                    {
+                        int listener = openSocket(port, i, options, failures);
+                        if (listener < 0)
+                        {
+                            break;
+                        }
+                        sockets.push_back(listener);
+                    }
+
+                    // A partial group would leave the kernel balancing onto fewer workers than the game expects
+                    if (sockets.size() != socketsPerPort)
+                    {
+                        for (int listener : sockets)
+                        {
+                            close(listener);
+                        }
+                        continue;
+                    }
+
+                    GSDK_LOG(Info, ListenersOpened, socketsPerPort, protocol, port.m_name, port.m_serverListeningPort);
+                    listeners[port.m_name] = std::move(sockets);
+                }
+                return listeners;
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,42 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "gsdk.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Opens the SO_REUSEPORT socket groups behind GSDK::openListeners. Linux only.
+            class GSDKListeners
+            {
+            public:
+                static std::unordered_map<std::string, std::vector<int>> open(const std::vector<GamePort> &ports, const ListenerOptions &options);
+
+                // The number of CPUs in the process's affinity mask
+                static unsigned int getCpuCount();
+
+            private:
+                // Which tuning options already failed for the port being opened
+                struct OptionFailures
+                {
+                    bool m_receiveBuffer;
+                    bool m_sendBuffer;
+                    bool m_busyPoll;
+
+                    OptionFailures() : m_receiveBuffer(false), m_sendBuffer(false), m_busyPoll(false) {}
+                };
+
+                // -1 on failure, after logging it
+                static int openSocket(const GamePort &port, unsigned int index, const ListenerOptions &options, OptionFailures &failures);
+                static void setOption(int socket, int level, int option, int value, const char *optionName, const GamePort &port, bool &logged);
+            };
+        }
+    }
+}
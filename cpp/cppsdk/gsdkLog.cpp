@@ -15,15 +15,19 @@ namespace Microsoft
             {
                 m_hr = S_OK;
                 m_methodName = methodName;
-                GSDK::logMessage(" - GSDKMethodEntry: " + m_methodName);
+                m_startNs = GSDKTrace::isEnabled() ? GSDKTrace::now() : 0;
+                GSDK_LOG(Info, MethodEntry, m_methodName);
             }
 
             GSDKLogMethod::~GSDKLogMethod()
             {
-                std::string msg = " - GSDKMethodEntry: " + m_methodName + " Result: " + std::to_string(m_hr);
-                if (!m_exception_message.empty())
-                    msg += " Exception: " + m_exception_message;
-                GSDK::logMessage(msg);
+                if (m_exception_message.empty())
+                    GSDK_LOG(Info, MethodExit, m_methodName, m_hr);
+                else
+                    GSDK_LOG(Info, MethodExitWithException, m_methodName, m_hr, m_exception_message);
+
+                if (m_startNs != 0)
+                    GSDKTrace::record(m_methodName, "method", m_startNs, GSDKTrace::now());
             }
 
             void GSDKLogMethod::setExceptionInformation(const std::exception &ex)
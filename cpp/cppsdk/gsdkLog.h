@@ -6,6 +6,7 @@
 #include <mutex>
 #include <fstream>
 #include "gsdkUtils.h"
+#include "gsdkTrace.h"
 
 namespace Microsoft
 {
@@ -14,6 +15,7 @@ namespace Microsoft
         namespace Gaming
         {
 
+            // Logs method entry and exit, and records the method as a trace span when tracing is on
             class GSDKLogMethod
             {
             public:
@@ -24,9 +26,10 @@ namespace Microsoft
                 HRESULT setHResult(HRESULT hr);
 
             private:
-                std::string m_methodName;
+                const char *m_methodName; // __func__, so it outlives this object
                 std::string m_exception_message;
                 HRESULT m_hr;
+                uint64_t m_startNs; // 0 if tracing was off on entry
             };
 
         }
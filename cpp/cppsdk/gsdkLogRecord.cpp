@@ -0,0 +1,242 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkLogRecord.h"
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            namespace GSDKLogRecord
+            {
+                static_assert(sizeof(GSDKLogFormatNames) == sizeof(GSDKLogFormatStrings), "GSDKLogFormatNames is out of sync with GSDKLogFormatStrings");
+                static_assert(sizeof(GSDKLogFormatStrings) / sizeof(GSDKLogFormatStrings[0]) == static_cast<size_t>(GSDKLogFormat::Format_Count),
+                              "GSDKLogFormatStrings must have an entry for every GSDKLogFormat");
+
+                uint64_t now()
+                {
+                    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count());
+                }
+
+                std::string formatTimestamp(uint64_t timestampNs)
+                {
+                    time_t seconds = static_cast<time_t>(timestampNs / 1000000000ULL);
+                    unsigned int microseconds = static_cast<unsigned int>((timestampNs / 1000ULL) % 1000000ULL);
+
+                    tm utc = {};
+#ifdef GSDK_LINUX
+                    gmtime_r(&seconds, &utc);
+#else
+                    gmtime_s(&utc, &seconds);
+#endif
+
+                    char buffer[64];
+                    size_t length = strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &utc);
+                    snprintf(buffer + length, sizeof(buffer) - length, ".%06uZ", microseconds);
+                    return buffer;
+                }
+
+                template <typename T>
+                static bool readValue(const char *&cursor, const char *end, T &value)
+                {
+                    if (static_cast<size_t>(end - cursor) < sizeof(T))
+                    {
+                        return false;
+                    }
+                    memcpy(&value, cursor, sizeof(T));
+                    cursor += sizeof(T);
+                    return true;
+                }
+
+                size_t decode(const char *data, size_t size, Record &record)
+                {
+                    uint32_t length = 0;
+                    uint8_t level = 0;
+                    uint8_t argumentCount = 0;
+                    const char *cursor = data;
+                    const char *end = data + size;
+
+                    if (!readValue(cursor, end, length) || length < c_headerSize || length > size)
+                    {
+                        return 0;
+                    }
+                    end = data + length;
+
+                    readValue(cursor, end, record.m_formatId);
+                    readValue(cursor, end, level);
+                    readValue(cursor, end, argumentCount);
+                    readValue(cursor, end, record.m_timestampNs);
+                    record.m_level = static_cast<GSDKLogLevel>(level);
+
+                    record.m_arguments.clear();
+                    for (uint8_t i = 0; i < argumentCount; ++i)
+                    {
+                        Argument argument = {};
+                        uint8_t type = 0;
+                        if (!readValue(cursor, end, type))
+                        {
+                            return 0;
+                        }
+                        argument.m_type = static_cast<ArgType>(type);
+
+                        bool valid = false;
+                        switch (argument.m_type)
+                        {
+                            case ArgType::Int:
+                                valid = readValue(cursor, end, argument.m_int);
+                                break;
+                            case ArgType::UInt:
+                                valid = readValue(cursor, end, argument.m_uint);
+                                break;
+                            case ArgType::Double:
+                                valid = readValue(cursor, end, argument.m_double);
+                                break;
+                            case ArgType::String:
+                                valid = readValue(cursor, end, argument.m_stringLength) && static_cast<size_t>(end - cursor) >= argument.m_stringLength;
+                                if (valid)
+                                {
+                                    argument.m_string = cursor;
+                                    cursor += argument.m_stringLength;
+                                }
+                                break;
+                        }
+
+                        if (!valid)
+                        {
+                            return 0;
+                        }
+                        record.m_arguments.push_back(argument);
+                    }
+
+                    return length;
+                }
+
+                static void appendArgumentText(const Argument &argument, std::string &out)
+                {
+                    char buffer[32];
+                    switch (argument.m_type)
+                    {
+                        case ArgType::Int:
+                            snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(argument.m_int));
+                            out.append(buffer);
+                            break;
+                        case ArgType::UInt:
+                            snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(argument.m_uint));
+                            out.append(buffer);
+                            break;
+                        case ArgType::Double:
+                            snprintf(buffer, sizeof(buffer), "%g", argument.m_double);
+                            out.append(buffer);
+                            break;
+                        case ArgType::String:
+                            out.append(argument.m_string, argument.m_stringLength);
+                            break;
+                    }
+                }
+
+                void format(const char *formatString, const Record &record, std::string &out)
+                {
+                    size_t nextArgument = 0;
+                    for (const char *cursor = formatString; *cursor != '\0'; ++cursor)
+                    {
+                        if (*cursor != '%' || cursor[1] == '\0')
+                        {
+                            out.push_back(*cursor);
+                            continue;
+                        }
+
+                        ++cursor;
+                        if (*cursor == '%')
+                        {
+                            out.push_back('%');
+                        }
+                        else if (nextArgument < record.m_arguments.size())
+                        {
+                            appendArgumentText(record.m_arguments[nextArgument++], out);
+                        }
+                    }
+
+                    // Arguments without a placeholder (e.g. a record from a newer format table) aren't lost
+                    for (; nextArgument < record.m_arguments.size(); ++nextArgument)
+                    {
+                        out.push_back(' ');
+                        appendArgumentText(record.m_arguments[nextArgument], out);
+                    }
+                }
+
+                static void appendHeaderString(std::string &header, const char *value)
+                {
+                    uint32_t length = static_cast<uint32_t>(strlen(value));
+                    appendRaw(header, &length, 4);
+                    appendRaw(header, value, length);
+                }
+
+                static bool readHeaderString(const char *&cursor, const char *end, std::string &value)
+                {
+                    uint32_t length = 0;
+                    if (!readValue(cursor, end, length) || static_cast<size_t>(end - cursor) < length)
+                    {
+                        return false;
+                    }
+                    value.assign(cursor, length);
+                    cursor += length;
+                    return true;
+                }
+
+                std::string getFileHeader()
+                {
+                    std::string header(c_fileMagic, c_fileMagicLength);
+                    uint32_t version = c_fileVersion;
+                    uint32_t formatCount = static_cast<uint32_t>(GSDKLogFormat::Format_Count);
+                    appendRaw(header, &version, 4);
+                    appendRaw(header, &formatCount, 4);
+
+                    for (uint32_t i = 0; i < formatCount; ++i)
+                    {
+                        appendHeaderString(header, GSDKLogFormatNames[i]);
+                        appendHeaderString(header, GSDKLogFormatStrings[i]);
+                    }
+                    return header;
+                }
+
+                size_t readFileHeader(const char *data, size_t size, std::vector<FormatEntry> &formats)
+                {
+                    const char *cursor = data;
+                    const char *end = data + size;
+                    uint32_t version = 0;
+                    uint32_t formatCount = 0;
+
+                    if (size < c_fileMagicLength || memcmp(data, c_fileMagic, c_fileMagicLength) != 0)
+                    {
+                        return 0;
+                    }
+                    cursor += c_fileMagicLength;
+
+                    if (!readValue(cursor, end, version) || version != c_fileVersion || !readValue(cursor, end, formatCount))
+                    {
+                        return 0;
+                    }
+
+                    formats.clear();
+                    for (uint32_t i = 0; i < formatCount; ++i)
+                    {
+                        FormatEntry entry;
+                        if (!readHeaderString(cursor, end, entry.m_name) || !readHeaderString(cursor, end, entry.m_format))
+                        {
+                            return 0;
+                        }
+                        formats.push_back(entry);
+                    }
+
+                    return static_cast<size_t>(cursor - data);
+                }
+            }
+        }
+    }
+}
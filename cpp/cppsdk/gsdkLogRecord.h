@@ -0,0 +1,268 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Log call sites below this level are compiled out entirely (0 = Debug, 1 = Info, 2 = Warning, 3 = Error)
+#ifndef GSDK_LOG_MIN_LEVEL
+#define GSDK_LOG_MIN_LEVEL 0
+#endif
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            #define GSDK_LOG_LEVELS(DO) \
+                DO( Debug ) \
+                DO( Info ) \
+                DO( Warning ) \
+                DO( Error ) \
+
+            #define MAKE_LOG_ENUM(NAME) NAME,
+            #define MAKE_LOG_LEVEL_STRINGS(NAME) #NAME,
+
+            enum class GSDKLogLevel : uint8_t
+            {
+                GSDK_LOG_LEVELS(MAKE_LOG_ENUM)
+            };
+
+            const char* const GSDKLogLevelNames[] =
+            {
+                GSDK_LOG_LEVELS(MAKE_LOG_LEVEL_STRINGS)
+            };
+
+            constexpr bool isLogLevelCompiledIn(GSDKLogLevel level)
+            {
+#if GSDK_LOG_MIN_LEVEL == 0
+                // Every level is compiled in; comparing an unsigned level against 0 would warn under -Wtype-limits
+                return (void)level, true;
+#else
+                return static_cast<int>(level) >= GSDK_LOG_MIN_LEVEL;
+#endif
+            }
+
+            // Every structured log line has a static format here. Only the id and the raw arguments are
+            // recorded on the calling thread; the text is rendered later by the writer thread, or offline
+            // by the log decoder when binary logging is enabled. Placeholders mark where arguments go,
+            // the argument's recorded type decides how it is rendered.
+            // Append new formats at the end: binary logs store the ids.
+            #define GSDK_LOG_FORMATS(DO) \
+                DO( Text,                       "%s" ) \
+                DO( MethodEntry,                " - GSDKMethodEntry: %s" ) \
+                DO( MethodExit,                 " - GSDKMethodEntry: %s Result: %d" ) \
+                DO( MethodExitWithException,    " - GSDKMethodEntry: %s Result: %d Exception: %s" ) \
+                DO( AgentEndpoint,              "VM Agent Endpoint: %s" ) \
+                DO( InstanceId,                 "Instance Id: %s" ) \
+                DO( GsdkInfoNonSuccess,         "Received non-success code from Agent when sending GSDK info.  Status Code: %d Response Body: %s" ) \
+                DO( EarlyHeartbeat,             "State transition signaled an early heartbeat." ) \
+                DO( HeartbeatExchange,          "Heartbeat request: { state = %s} response: { operation = %s}" ) \
+                DO( HeartbeatParseFailed,       "Failed to parse heartbeat" ) \
+                DO( HeartbeatProcessingFailed,  "An error occured while processing heartbeat." ) \
+                DO( HeartbeatMessage,           "Message: %s" ) \
+                DO( UnhandledOperation,         "Unhandled operation received: %s" ) \
+                DO( UnknownOperation,           "Unknown operation received: %s" ) \
+                DO( AgentNonSuccess,            "Received non-success code from Agent.  Status Code: %d Response Body: %s" ) \
+                DO( SuppressedRepeats,          "Previous %s message repeated %u more times between %s and %s" ) \
+                DO( SuppressedOverBudget,       "Suppressed %u messages after %s (more than %u per %u seconds from one call site)" ) \
+                DO( PlayFabRequestFailed,       "PlayFab request to %s failed. HTTP %d %s: %s" ) \
+                DO( CustomMetricsNonSuccess,    "Received non-success code from Agent when sending custom metrics.  Status Code: %d Response Body: %s" ) \
+                DO( FrameBudgetExceeded,        "Frame time p99 of %g ms has been over the %g ms budget for %u seconds, reporting Unhealthy" ) \
+                DO( ResourceUsage,              "Resources: CPU %g%% (user %u ms, system %u ms), RSS %u bytes, %u fds, %u threads, context switches %u voluntary %u involuntary" ) \
+                DO( WatchdogStalled,            "The game has not petted the watchdog for %u ms (timeout %u ms), reporting Unhealthy" ) \
+                DO( WatchdogStacksWritten,      "Stacks of all threads written to %s" ) \
+                DO( WatchdogRecovered,          "The game petted the watchdog again" ) \
+                DO( CertificatesLoaded,         "Loaded %u certificates from %s" ) \
+                DO( CertificateFileUnreadable,  "No certificate or private key could be read from %s" ) \
+                DO( SharedContentMapFailed,     "Could not map shared content file %s, error %d" ) \
+                DO( SharedContentWarmedUp,      "Warmed up %u shared content files, %u bytes in %u ms (%g MB/s)" ) \
+                DO( ContentManifestBuilt,       "Shared content manifest: %u files, %u hashed (%u bytes) in %u ms, hashing at %g GB/s" ) \
+                DO( ContentManifestNotSaved,    "Could not save the shared content manifest to %s" ) \
+                DO( ListenersOpened,            "Opened %u %s sockets for port %s (%d)" ) \
+                DO( ListenerFailed,             "Could not open socket %u for port %s (%d), %s failed with errno %d" ) \
+                DO( ListenerOptionFailed,       "Could not set %s on the sockets for port %s, errno %d" ) \
+                DO( PlayFabCircuitOpened,       "%u PlayFab requests in a row failed, failing requests fast for %u ms" ) \
+                DO( PlayFabCircuitClosed,       "PlayFab requests are succeeding again after %u failures" ) \
+                DO( PlayFabEventsDropped,       "Dropped %u PlayFab events, the event queue holds %u" ) \
+
+            #define MAKE_LOG_FORMAT_ENUM(NAME, FORMAT) NAME,
+            #define MAKE_LOG_FORMAT_NAMES(NAME, FORMAT) #NAME,
+            #define MAKE_LOG_FORMAT_STRINGS(NAME, FORMAT) FORMAT,
+
+            enum class GSDKLogFormat : uint16_t
+            {
+                GSDK_LOG_FORMATS(MAKE_LOG_FORMAT_ENUM)
+                Format_Count
+            };
+
+            const char* const GSDKLogFormatNames[] =
+            {
+                GSDK_LOG_FORMATS(MAKE_LOG_FORMAT_NAMES)
+            };
+
+            const char* const GSDKLogFormatStrings[] =
+            {
+                GSDK_LOG_FORMATS(MAKE_LOG_FORMAT_STRINGS)
+            };
+
+            // Encoding and decoding of the compact records that move through the log buffer.
+            //
+            // Record:      uint32 length (whole record), uint16 format id, uint8 level, uint8 argument count,
+            //              uint64 timestamp (ns since the Unix epoch), then the arguments.
+            // Argument:    uint8 type, then 8 bytes for numbers or uint32 length + bytes for strings.
+            // Binary file: "GSDKBLOG", uint32 version, uint32 format count, then the name and format string
+            //              of every format (each as uint32 length + bytes), then records. Every segment starts with this header, so each one
+            //              decodes on its own even after older segments have been rotated away.
+            //
+            // All integers are little endian (the byte order of every platform GSDK ships on).
+            namespace GSDKLogRecord
+            {
+                enum class ArgType : uint8_t
+                {
+                    Int = 0,
+                    UInt = 1,
+                    Double = 2,
+                    String = 3
+                };
+
+                struct Argument
+                {
+                    ArgType m_type;
+                    int64_t m_int;
+                    uint64_t m_uint;
+                    double m_double;
+                    const char *m_string; // points into the record being decoded
+                    uint32_t m_stringLength;
+                };
+
+                struct FormatEntry
+                {
+                    std::string m_name;
+                    std::string m_format;
+                };
+
+                struct Record
+                {
+                    uint16_t m_formatId;
+                    GSDKLogLevel m_level;
+                    uint64_t m_timestampNs;
+                    std::vector<Argument> m_arguments;
+                };
+
+                constexpr size_t c_headerSize = 16;
+                constexpr uint32_t c_fileVersion = 1;
+                constexpr const char *c_fileMagic = "GSDKBLOG";
+                constexpr size_t c_fileMagicLength = 8;
+                constexpr uint32_t c_maxStringLength = 64 * 1024;
+
+                uint64_t now();
+
+                // ISO 8601 UTC with microseconds, e.g. 2024-01-31T12:00:00.000000Z
+                std::string formatTimestamp(uint64_t timestampNs);
+
+                inline void appendRaw(std::string &out, const void *data, size_t length)
+                {
+                    out.append(static_cast<const char *>(data), length);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type appendArgument(std::string &out, T value)
+                {
+                    uint8_t type = static_cast<uint8_t>(ArgType::Int);
+                    int64_t widened = static_cast<int64_t>(value);
+                    appendRaw(out, &type, 1);
+                    appendRaw(out, &widened, 8);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type appendArgument(std::string &out, T value)
+                {
+                    uint8_t type = static_cast<uint8_t>(ArgType::UInt);
+                    uint64_t widened = static_cast<uint64_t>(value);
+                    appendRaw(out, &type, 1);
+                    appendRaw(out, &widened, 8);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_floating_point<T>::value>::type appendArgument(std::string &out, T value)
+                {
+                    uint8_t type = static_cast<uint8_t>(ArgType::Double);
+                    double widened = static_cast<double>(value);
+                    appendRaw(out, &type, 1);
+                    appendRaw(out, &widened, 8);
+                }
+
+                inline void appendString(std::string &out, const char *value, size_t length)
+                {
+                    uint8_t type = static_cast<uint8_t>(ArgType::String);
+                    uint32_t cappedLength = static_cast<uint32_t>(length < c_maxStringLength ? length : c_maxStringLength);
+                    appendRaw(out, &type, 1);
+                    appendRaw(out, &cappedLength, 4);
+                    appendRaw(out, value, cappedLength);
+                }
+
+                inline void appendArgument(std::string &out, const std::string &value)
+                {
+                    appendString(out, value.data(), value.size());
+                }
+
+                inline void appendArgument(std::string &out, const char *value)
+                {
+                    appendString(out, value, value != nullptr ? strlen(value) : 0);
+                }
+
+                inline void appendArguments(std::string &)
+                {
+                }
+
+                template <typename T, typename... Rest>
+                inline void appendArguments(std::string &out, const T &first, const Rest &... rest)
+                {
+                    appendArgument(out, first);
+                    appendArguments(out, rest...);
+                }
+
+                // Encodes a whole record into out, replacing its contents (but keeping its capacity)
+                template <typename... Args>
+                inline void encode(std::string &out, GSDKLogLevel level, GSDKLogFormat format, const Args &... args)
+                {
+                    static_assert(sizeof...(Args) < 256, "Too many log arguments");
+
+                    out.clear();
+                    uint32_t length = 0; // patched below
+                    uint16_t formatId = static_cast<uint16_t>(format);
+                    uint8_t levelValue = static_cast<uint8_t>(level);
+                    uint8_t argumentCount = static_cast<uint8_t>(sizeof...(Args));
+                    uint64_t timestamp = now();
+                    appendRaw(out, &length, 4);
+                    appendRaw(out, &formatId, 2);
+                    appendRaw(out, &levelValue, 1);
+                    appendRaw(out, &argumentCount, 1);
+                    appendRaw(out, &timestamp, 8);
+                    appendArguments(out, args...);
+
+                    length = static_cast<uint32_t>(out.size());
+                    memcpy(&out[0], &length, 4);
+                }
+
+                // Reads the record at the start of data. Returns its length, or 0 if it is truncated or malformed.
+                size_t decode(const char *data, size_t size, Record &record);
+
+                // Renders a record through its format string (appended to out, no trailing newline)
+                void format(const char *formatString, const Record &record, std::string &out);
+
+                // The header every binary log segment starts with
+                std::string getFileHeader();
+
+                // Parses a binary log header, returning its length (0 if data doesn't start with one)
+                size_t readFileHeader(const char *data, size_t size, std::vector<FormatEntry> &formats);
+            }
+        }
+    }
+}
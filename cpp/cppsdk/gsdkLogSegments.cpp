@@ -0,0 +1,213 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkLogSegments.h"
+#include <fstream>
+
+#ifdef GSDK_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            constexpr unsigned long long GSDKLogSegments::c_minSegmentBytes;
+
+#ifdef GSDK_LINUX
+            static const int c_invalidFile = -1;
+#else
+            static void * const c_invalidFile = INVALID_HANDLE_VALUE;
+#endif
+
+            GSDKLogSegments::GSDKLogSegments() :
+                m_maxSegmentBytes(c_minSegmentBytes),
+                m_maxSegmentCount(1),
+                m_file(c_invalidFile)
+            {
+            }
+
+            GSDKLogSegments::~GSDKLogSegments()
+            {
+                close();
+            }
+
+            bool GSDKLogSegments::open(const std::string &folder, const std::string &baseName, const std::string &extension,
+                                       unsigned long long maxSegmentBytes, unsigned int maxSegmentCount, const std::string &segmentHeader)
+            {
+                if (isOpen())
+                {
+                    return true;
+                }
+
+                m_folder = folder;
+                m_baseName = baseName;
+                m_extension = extension;
+                m_segmentHeader = segmentHeader;
+                m_maxSegmentBytes = std::max(maxSegmentBytes, c_minSegmentBytes);
+                m_maxSegmentCount = std::max(maxSegmentCount, 1u);
+                m_segments.clear();
+
+                if (!openSegment(0))
+                {
+                    return false;
+                }
+                writeIndex();
+                return true;
+            }
+
+            bool GSDKLogSegments::isOpen() const
+            {
+                return m_file != c_invalidFile;
+            }
+
+            void GSDKLogSegments::append(const char *data, size_t length)
+            {
+                if (!isOpen())
+                {
+                    return;
+                }
+
+                Segment &current = m_segments.back();
+                if (current.m_bytes > m_segmentHeader.size() && current.m_bytes + length > m_maxSegmentBytes)
+                {
+                    rotate();
+                    if (!isOpen())
+                    {
+                        return;
+                    }
+                }
+
+                writeAll(data, length);
+            }
+
+            void GSDKLogSegments::writeAll(const char *data, size_t length)
+            {
+                // The file is opened for append, so this is a single write syscall per batch without a seek
+                const char *cursor = data;
+                size_t remaining = length;
+                while (remaining > 0)
+                {
+#ifdef GSDK_LINUX
+                    ssize_t written = ::write(m_file, cursor, remaining);
+                    if (written < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    if (written <= 0)
+                    {
+                        break;
+                    }
+#else
+                    DWORD written = 0;
+                    DWORD toWrite = static_cast<DWORD>(std::min<size_t>(remaining, MAXDWORD));
+                    if (!WriteFile(m_file, cursor, toWrite, &written, nullptr) || written == 0)
+                    {
+                        break;
+                    }
+#endif
+                    cursor += written;
+                    remaining -= written;
+                    m_segments.back().m_bytes += written;
+                }
+            }
+
+            void GSDKLogSegments::close()
+            {
+                if (!isOpen())
+                {
+                    return;
+                }
+
+                closeSegment();
+                writeIndex();
+            }
+
+            std::string GSDKLogSegments::getSegmentPath(unsigned int sequence) const
+            {
+                if (sequence == 0)
+                {
+                    return m_folder + m_baseName + m_extension;
+                }
+                return m_folder + m_baseName + "." + std::to_string(sequence) + m_extension;
+            }
+
+            bool GSDKLogSegments::openSegment(unsigned int sequence)
+            {
+                std::string path = getSegmentPath(sequence);
+
+#ifdef GSDK_LINUX
+                m_file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+                if (m_file == c_invalidFile)
+                {
+                    return false;
+                }
+
+                // Reserve the blocks up front without changing the file size, so appends don't fragment
+                // the file or hit ENOSPC halfway through a segment. Not every file system supports this.
+                (void)::fallocate(m_file, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(m_maxSegmentBytes));
+#else
+                m_file = CreateFileA(path.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (m_file == c_invalidFile)
+                {
+                    return false;
+                }
+
+                // Same as fallocate(FALLOC_FL_KEEP_SIZE): reserve space, leave the end of file alone
+                FILE_ALLOCATION_INFO allocationInfo;
+                allocationInfo.AllocationSize.QuadPart = static_cast<LONGLONG>(m_maxSegmentBytes);
+                SetFileInformationByHandle(m_file, FileAllocationInfo, &allocationInfo, sizeof(allocationInfo));
+#endif
+
+                Segment segment;
+                segment.m_sequence = sequence;
+                segment.m_bytes = 0;
+                m_segments.push_back(segment);
+
+                if (!m_segmentHeader.empty())
+                {
+                    writeAll(m_segmentHeader.data(), m_segmentHeader.size());
+                }
+                return true;
+            }
+
+            void GSDKLogSegments::closeSegment()
+            {
+#ifdef GSDK_LINUX
+                ::close(m_file);
+#else
+                CloseHandle(m_file);
+#endif
+                m_file = c_invalidFile;
+            }
+
+            void GSDKLogSegments::rotate()
+            {
+                unsigned int nextSequence = m_segments.back().m_sequence + 1;
+                closeSegment();
+
+                while (m_segments.size() >= m_maxSegmentCount)
+                {
+                    std::remove(getSegmentPath(m_segments.front().m_sequence).c_str());
+                    m_segments.pop_front();
+                }
+
+                openSegment(nextSequence);
+                writeIndex();
+            }
+
+            void GSDKLogSegments::writeIndex()
+            {
+                std::ofstream index(m_folder + m_baseName + ".index", std::ofstream::out | std::ofstream::trunc);
+                for (const Segment &segment : m_segments)
+                {
+                    std::string path = getSegmentPath(segment.m_sequence);
+                    index << path.substr(m_folder.size()) << '\t' << segment.m_bytes << '\n';
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <deque>
+#include <string>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // The files behind the GSDK log. Output is split into segments of at most maxSegmentBytes and
+            // only the newest maxSegmentCount segments are kept, so the log folder never holds more than
+            // maxSegmentBytes * maxSegmentCount bytes of GSDK output.
+            //
+            // Segments are named <baseName><extension>, <baseName>.1<extension>, <baseName>.2<extension>, ...
+            // and <baseName>.index lists the ones still on disk, oldest first, with their sizes.
+            // If a segment header is given, every segment starts with it (binary logs use this so each
+            // segment can be decoded on its own).
+            //
+            // Not thread safe: only the log writer thread appends.
+            class GSDKLogSegments
+            {
+            public:
+                GSDKLogSegments();
+                ~GSDKLogSegments();
+
+                // folder must be empty or end with a path separator
+                bool open(const std::string &folder, const std::string &baseName, const std::string &extension,
+                          unsigned long long maxSegmentBytes, unsigned int maxSegmentCount, const std::string &segmentHeader = std::string());
+                bool isOpen() const;
+
+                // Appends a batch of whole lines, rotating to a new segment first if the batch doesn't fit
+                void append(const char *data, size_t length);
+
+                void close();
+
+                static constexpr unsigned long long c_minSegmentBytes = 1024 * 1024;
+
+            private:
+                struct Segment
+                {
+                    unsigned int m_sequence;
+                    unsigned long long m_bytes;
+                };
+
+                std::string getSegmentPath(unsigned int sequence) const;
+                bool openSegment(unsigned int sequence);
+                void closeSegment();
+                void rotate();
+                void writeAll(const char *data, size_t length);
+                void writeIndex();
+
+                std::string m_folder;
+                std::string m_baseName;
+                std::string m_extension;
+                std::string m_segmentHeader;
+                unsigned long long m_maxSegmentBytes;
+                unsigned int m_maxSegmentCount;
+                std::deque<Segment> m_segments; // oldest first, the back is the one being written
+
+#ifdef GSDK_LINUX
+                int m_file;
+#else
+                void *m_file; // HANDLE, kept as void* so this header doesn't need windows.h
+#endif
+            };
+        }
+    }
+}
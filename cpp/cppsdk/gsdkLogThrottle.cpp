@@ -0,0 +1,193 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkLogThrottle.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            constexpr uint64_t GSDKLogThrottle::c_windowNs;
+            constexpr unsigned int GSDKLogThrottle::c_budgetPerWindow;
+
+            namespace
+            {
+                struct Registry
+                {
+                    std::mutex m_mutex;
+                    GSDKLogThrottle *m_head = nullptr;
+                };
+
+                // Never destroyed, call sites unregister themselves as their statics are torn down
+                Registry &getRegistry()
+                {
+                    static Registry *registry = new Registry();
+                    return *registry;
+                }
+
+                // FNV-1a over everything but the record's length and timestamp
+                uint64_t hashRecord(const std::string &record)
+                {
+                    uint64_t hash = 14695981039346656037ULL;
+                    for (size_t i = 4; i < record.size(); ++i)
+                    {
+                        if (i == 8)
+                        {
+                            i += 8; // skip the timestamp
+                            if (i >= record.size())
+                            {
+                                break;
+                            }
+                        }
+                        hash ^= static_cast<unsigned char>(record[i]);
+                        hash *= 1099511628211ULL;
+                    }
+                    return hash;
+                }
+
+                uint64_t getTimestamp(const std::string &record)
+                {
+                    uint64_t timestamp = 0;
+                    if (record.size() >= GSDKLogRecord::c_headerSize)
+                    {
+                        memcpy(&timestamp, record.data() + 8, sizeof(timestamp));
+                    }
+                    return timestamp;
+                }
+            }
+
+            GSDKLogThrottle::GSDKLogThrottle() :
+                m_next(nullptr),
+                m_hasLast(false),
+                m_lastHash(0),
+                m_lastLevel(GSDKLogLevel::Info),
+                m_lastFormat(GSDKLogFormat::Text),
+                m_repeatCount(0),
+                m_firstRepeatNs(0),
+                m_lastRepeatNs(0),
+                m_windowStartNs(0),
+                m_writtenInWindow(0),
+                m_overBudgetCount(0)
+            {
+                Registry &registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.m_mutex);
+                m_next = registry.m_head;
+                registry.m_head = this;
+            }
+
+            GSDKLogThrottle::~GSDKLogThrottle()
+            {
+                Registry &registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.m_mutex);
+                for (GSDKLogThrottle **link = &registry.m_head; *link != nullptr; link = &(*link)->m_next)
+                {
+                    if (*link == this)
+                    {
+                        *link = m_next;
+                        break;
+                    }
+                }
+            }
+
+            void GSDKLogThrottle::flushAll(GSDKLogWriter &writer)
+            {
+                Registry &registry = getRegistry();
+                std::lock_guard<std::mutex> registryLock(registry.m_mutex);
+                for (GSDKLogThrottle *throttle = registry.m_head; throttle != nullptr; throttle = throttle->m_next)
+                {
+                    std::lock_guard<std::mutex> lock(throttle->m_mutex);
+                    throttle->flushPending(writer);
+                }
+            }
+
+            void GSDKLogThrottle::flushExpired(GSDKLogWriter &writer)
+            {
+                uint64_t now = GSDKLogRecord::now();
+
+                Registry &registry = getRegistry();
+                std::lock_guard<std::mutex> registryLock(registry.m_mutex);
+                for (GSDKLogThrottle *throttle = registry.m_head; throttle != nullptr; throttle = throttle->m_next)
+                {
+                    std::lock_guard<std::mutex> lock(throttle->m_mutex);
+                    if ((throttle->m_repeatCount > 0 || throttle->m_overBudgetCount > 0) && now - throttle->m_windowStartNs >= c_windowNs)
+                    {
+                        throttle->startWindow(writer, now);
+                    }
+                }
+            }
+
+            void GSDKLogThrottle::submit(GSDKLogWriter &writer, const std::string &record)
+            {
+                uint64_t hash = hashRecord(record);
+                uint64_t timestamp = getTimestamp(record);
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                if (timestamp - m_windowStartNs >= c_windowNs)
+                {
+                    startWindow(writer, timestamp);
+                }
+
+                if (m_hasLast && hash == m_lastHash)
+                {
+                    if (m_repeatCount == 0)
+                    {
+                        m_firstRepeatNs = timestamp;
+                    }
+                    ++m_repeatCount;
+                    m_lastRepeatNs = timestamp;
+                    return;
+                }
+
+                if (m_writtenInWindow >= c_budgetPerWindow)
+                {
+                    ++m_overBudgetCount;
+                    return;
+                }
+
+                // A different record: close off the run of repeats before it
+                flushPending(writer);
+
+                writer.writeEncoded(record);
+                ++m_writtenInWindow;
+                m_hasLast = true;
+                m_lastHash = hash;
+                memcpy(&m_lastFormat, record.data() + 4, sizeof(m_lastFormat));
+                memcpy(&m_lastLevel, record.data() + 6, sizeof(m_lastLevel));
+            }
+
+            void GSDKLogThrottle::startWindow(GSDKLogWriter &writer, uint64_t timestampNs)
+            {
+                // Summarize the old window and let the next record through even if it repeats,
+                // so a persistent problem still shows up once per window
+                flushPending(writer);
+                m_windowStartNs = timestampNs;
+                m_writtenInWindow = 0;
+                m_hasLast = false;
+            }
+
+            void GSDKLogThrottle::flushPending(GSDKLogWriter &writer)
+            {
+                const char *formatName = static_cast<size_t>(m_lastFormat) < static_cast<size_t>(GSDKLogFormat::Format_Count)
+                    ? GSDKLogFormatNames[static_cast<size_t>(m_lastFormat)]
+                    : "unknown";
+
+                if (m_repeatCount > 0)
+                {
+                    writer.writeRecord(m_lastLevel, GSDKLogFormat::SuppressedRepeats, formatName, m_repeatCount,
+                                       GSDKLogRecord::formatTimestamp(m_firstRepeatNs), GSDKLogRecord::formatTimestamp(m_lastRepeatNs));
+                    m_repeatCount = 0;
+                }
+
+                if (m_overBudgetCount > 0)
+                {
+                    writer.writeRecord(GSDKLogLevel::Warning, GSDKLogFormat::SuppressedOverBudget, m_overBudgetCount, formatName,
+                                       c_budgetPerWindow, static_cast<unsigned int>(c_windowNs / 1000000000ULL));
+                    m_overBudgetCount = 0;
+                }
+            }
+        }
+    }
+}
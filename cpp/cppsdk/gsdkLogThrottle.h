@@ -0,0 +1,74 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "gsdkLogRecord.h"
+#include "gsdkLogWriter.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Rate limits and de-duplicates one log call site (use through GSDK_LOG_THROTTLED).
+            //
+            // A record identical to the previous one from the same call site (same format and arguments)
+            // is counted instead of written, and the count is written as one line with the first and last
+            // time it repeated once a different record comes in or the window ends. On top of that each
+            // call site may write at most c_budgetPerWindow distinct records per window; the rest are
+            // counted and summarized the same way.
+            class GSDKLogThrottle
+            {
+            public:
+                GSDKLogThrottle();
+                ~GSDKLogThrottle();
+
+                GSDKLogThrottle(const GSDKLogThrottle &) = delete;
+                GSDKLogThrottle &operator=(const GSDKLogThrottle &) = delete;
+
+                template <typename... Args>
+                void log(GSDKLogWriter &writer, GSDKLogLevel level, GSDKLogFormat format, const Args &... args)
+                {
+                    // Encoding is cheap and lets identical records be compared without formatting them
+                    static thread_local std::string record;
+                    GSDKLogRecord::encode(record, level, format, args...);
+                    submit(writer, record);
+                }
+
+                // Writes the pending summaries of every call site, e.g. before shutdown
+                static void flushAll(GSDKLogWriter &writer);
+
+                // Writes the summaries of call sites whose window has ended, which otherwise wait until the site
+                // logs again; called periodically by the heartbeat thread
+                static void flushExpired(GSDKLogWriter &writer);
+
+                static constexpr uint64_t c_windowNs = 60ULL * 1000 * 1000 * 1000;
+                static constexpr unsigned int c_budgetPerWindow = 10;
+
+            private:
+                void submit(GSDKLogWriter &writer, const std::string &record);
+                void flushPending(GSDKLogWriter &writer); // m_mutex must be held
+                void startWindow(GSDKLogWriter &writer, uint64_t timestampNs); // m_mutex must be held
+
+                std::mutex m_mutex;
+                GSDKLogThrottle *m_next; // list of every call site, guarded by the registry mutex
+
+                bool m_hasLast;
+                uint64_t m_lastHash;
+                GSDKLogLevel m_lastLevel;
+                GSDKLogFormat m_lastFormat;
+                unsigned int m_repeatCount;
+                uint64_t m_firstRepeatNs;
+                uint64_t m_lastRepeatNs;
+
+                uint64_t m_windowStartNs;
+                unsigned int m_writtenInWindow;
+                unsigned int m_overBudgetCount;
+            };
+        }
+    }
+}
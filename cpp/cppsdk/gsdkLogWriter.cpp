@@ -0,0 +1,289 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkLogWriter.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            constexpr size_t GSDKLogWriter::c_maxMessageLength;
+
+            // How long the writer sleeps when there is nothing to write. Bounds how stale the file can get.
+            constexpr unsigned int c_writerIdleWaitMs = 50;
+            // Slots that held an unusually large message give the memory back once it is written
+            constexpr size_t c_retainedSlotBytes = 4 * 1024;
+            // Upper bound on a single write to the file
+            constexpr size_t c_maxBatchBytes = 256 * 1024;
+            constexpr size_t c_minCapacity = 16;
+
+            GSDKLogWriter::GSDKLogWriter() :
+                m_mask(0),
+                m_policy(OverflowPolicy::Drop),
+                m_binary(false),
+                m_enqueuePos(0),
+                m_dequeuePos(0),
+                m_writtenPos(0),
+                m_droppedCount(0),
+                m_isOpen(false),
+                m_stopRequested(false),
+                m_wakeRequested(false)
+            {
+            }
+
+            GSDKLogWriter::~GSDKLogWriter()
+            {
+                close();
+            }
+
+            bool GSDKLogWriter::open(const std::string &folder, const std::string &baseName, const Options &options)
+            {
+                if (m_isOpen.load(std::memory_order_acquire))
+                {
+                    return true;
+                }
+
+                bool segmentsOpened = options.m_binary
+                    ? m_segments.open(folder, baseName, ".bin", options.m_maxSegmentBytes, options.m_maxSegmentCount, GSDKLogRecord::getFileHeader())
+                    : m_segments.open(folder, baseName, ".txt", options.m_maxSegmentBytes, options.m_maxSegmentCount);
+                if (!segmentsOpened)
+                {
+                    return false;
+                }
+
+                size_t roundedCapacity = c_minCapacity;
+                while (roundedCapacity < options.m_capacity)
+                {
+                    roundedCapacity <<= 1;
+                }
+
+                m_slots.reset(new Slot[roundedCapacity]);
+                for (size_t i = 0; i < roundedCapacity; ++i)
+                {
+                    m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+                }
+                m_mask = roundedCapacity - 1;
+                m_policy = options.m_policy;
+                m_binary = options.m_binary;
+                m_enqueuePos.store(0, std::memory_order_relaxed);
+                m_dequeuePos = 0;
+                m_writtenPos.store(0, std::memory_order_relaxed);
+                m_stopRequested.store(false, std::memory_order_relaxed);
+                m_wakeRequested = false;
+
+                m_isOpen.store(true, std::memory_order_release);
+                m_writerThread = std::thread(&GSDKLogWriter::writerThreadFunc, this);
+                return true;
+            }
+
+            bool GSDKLogWriter::isOpen() const
+            {
+                return m_isOpen.load(std::memory_order_acquire);
+            }
+
+            bool GSDKLogWriter::write(const std::string &message)
+            {
+                return writeRecord(GSDKLogLevel::Info, GSDKLogFormat::Text, message);
+            }
+
+            bool GSDKLogWriter::writeEncoded(const std::string &record)
+            {
+                size_t pos;
+                Slot *slot = claimSlot(pos);
+                if (slot == nullptr)
+                {
+                    return false;
+                }
+
+                slot->m_record.assign(record);
+                publishSlot(slot, pos);
+                return true;
+            }
+
+            GSDKLogWriter::Slot *GSDKLogWriter::claimSlot(size_t &pos)
+            {
+                if (!m_isOpen.load(std::memory_order_acquire))
+                {
+                    return nullptr;
+                }
+
+                // Bounded MPMC queue (Vyukov): each slot's sequence says whether it is free for position pos
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    Slot *slot = &m_slots[pos & m_mask];
+                    size_t sequence = slot->m_sequence.load(std::memory_order_acquire);
+                    std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+
+                    if (diff == 0)
+                    {
+                        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            return slot;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        // Buffer is full
+                        m_wakeCondition.notify_one();
+
+                        if (m_policy == OverflowPolicy::Drop)
+                        {
+                            m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+                            return nullptr;
+                        }
+
+                        std::this_thread::yield();
+                        pos = m_enqueuePos.load(std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        pos = m_enqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            void GSDKLogWriter::publishSlot(Slot *slot, size_t pos)
+            {
+                slot->m_sequence.store(pos + 1, std::memory_order_release);
+
+                // Nudge the writer every quarter buffer so a burst doesn't have to wait for the idle timeout
+                if ((pos & (m_mask >> 2)) == 0)
+                {
+                    m_wakeCondition.notify_one();
+                }
+            }
+
+            void GSDKLogWriter::flush()
+            {
+                if (!m_isOpen.load(std::memory_order_acquire))
+                {
+                    return;
+                }
+
+                size_t target = m_enqueuePos.load(std::memory_order_acquire);
+
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+                m_wakeRequested = true;
+                m_wakeCondition.notify_one();
+                m_flushedCondition.wait(lock, [&]() -> bool
+                {
+                    return m_writtenPos.load(std::memory_order_acquire) >= target || m_stopRequested.load(std::memory_order_acquire);
+                });
+            }
+
+            void GSDKLogWriter::close()
+            {
+                if (!m_isOpen.exchange(false, std::memory_order_acq_rel))
+                {
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(m_wakeMutex);
+                    m_stopRequested.store(true, std::memory_order_release);
+                    m_wakeRequested = true;
+                }
+                m_wakeCondition.notify_all();
+
+                if (m_writerThread.joinable())
+                {
+                    m_writerThread.join();
+                }
+
+                // If the runtime tore the writer thread down before us (process exit), finish its work here
+                std::string batch;
+                while (drain(batch) > 0)
+                {
+                    writeBatch(batch);
+                }
+
+                m_segments.close();
+                m_flushedCondition.notify_all();
+            }
+
+            unsigned long long GSDKLogWriter::getDroppedCount() const
+            {
+                return m_droppedCount.load(std::memory_order_relaxed);
+            }
+
+            void GSDKLogWriter::writerThreadFunc()
+            {
+                std::string batch;
+                batch.reserve(c_maxBatchBytes);
+
+                for (;;)
+                {
+                    bool stopping = m_stopRequested.load(std::memory_order_acquire);
+
+                    if (drain(batch) > 0)
+                    {
+                        writeBatch(batch);
+                        continue;
+                    }
+
+                    if (stopping)
+                    {
+                        break;
+                    }
+
+                    // Producers notify without taking the lock, so any wakeup (or the timeout) is a reason to drain again
+                    std::unique_lock<std::mutex> lock(m_wakeMutex);
+                    if (!m_wakeRequested && !m_stopRequested.load(std::memory_order_acquire))
+                    {
+                        m_wakeCondition.wait_for(lock, std::chrono::milliseconds(c_writerIdleWaitMs));
+                    }
+                    m_wakeRequested = false;
+                }
+            }
+
+            size_t GSDKLogWriter::drain(std::string &batch)
+            {
+                size_t count = 0;
+                while (batch.size() < c_maxBatchBytes)
+                {
+                    Slot &slot = m_slots[m_dequeuePos & m_mask];
+                    if (slot.m_sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+                    {
+                        break; // empty, or a producer is still copying into it
+                    }
+
+                    if (m_binary)
+                    {
+                        batch.append(slot.m_record);
+                    }
+                    else if (GSDKLogRecord::decode(slot.m_record.data(), slot.m_record.size(), m_decodedRecord) > 0 &&
+                             m_decodedRecord.m_formatId < static_cast<uint16_t>(GSDKLogFormat::Format_Count))
+                    {
+                        GSDKLogRecord::format(GSDKLogFormatStrings[m_decodedRecord.m_formatId], m_decodedRecord, batch);
+                        batch.push_back('\n');
+                    }
+
+                    if (slot.m_record.capacity() > c_retainedSlotBytes)
+                    {
+                        std::string().swap(slot.m_record);
+                    }
+
+                    slot.m_sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+                    ++m_dequeuePos;
+                    ++count;
+                }
+                return count;
+            }
+
+            void GSDKLogWriter::writeBatch(std::string &batch)
+            {
+                m_segments.append(batch.data(), batch.size());
+                batch.clear();
+
+                {
+                    std::lock_guard<std::mutex> lock(m_wakeMutex);
+                    m_writtenPos.store(m_dequeuePos, std::memory_order_release);
+                }
+                m_flushedCondition.notify_all();
+            }
+        }
+    }
+}
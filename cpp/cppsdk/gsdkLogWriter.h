@@ -0,0 +1,122 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "gsdkLogRecord.h"
+#include "gsdkLogSegments.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Moves GSDK log file I/O off the calling thread. Messages are encoded as compact records
+            // (see gsdkLogRecord.h) into a bounded multi-producer ring buffer (no locks, no syscalls)
+            // and a background thread formats them and writes them to disk in batches. In binary mode
+            // the records are written as they are and formatting is left to the log decoder.
+            class GSDKLogWriter
+            {
+            public:
+                enum class OverflowPolicy
+                {
+                    Drop,  // Discard the message and count it, the caller never waits
+                    Block  // Spin until the writer frees a slot
+                };
+
+                struct Options
+                {
+                    size_t m_capacity = 4096; // rounded up to a power of two
+                    OverflowPolicy m_policy = OverflowPolicy::Drop;
+                    unsigned long long m_maxSegmentBytes = 16 * 1024 * 1024;
+                    unsigned int m_maxSegmentCount = 8;
+                    bool m_binary = false; // write records instead of text, see gsdkLogDecoder
+                };
+
+                GSDKLogWriter();
+                ~GSDKLogWriter();
+
+                // Opens the first log segment and starts the writer thread
+                bool open(const std::string &folder, const std::string &baseName, const Options &options);
+                bool isOpen() const;
+
+                // Queues a plain text message for the writer thread. Returns false if it was dropped.
+                bool write(const std::string &message);
+
+                // Queues a structured record: only the format id and the raw arguments are copied here,
+                // the text is rendered by the writer thread (or not at all, in binary mode).
+                template <typename... Args>
+                bool writeRecord(GSDKLogLevel level, GSDKLogFormat format, const Args &... args)
+                {
+                    size_t pos;
+                    Slot *slot = claimSlot(pos);
+                    if (slot == nullptr)
+                    {
+                        return false;
+                    }
+
+                    GSDKLogRecord::encode(slot->m_record, level, format, args...);
+                    publishSlot(slot, pos);
+                    return true;
+                }
+
+                // Queues a record that was already encoded with GSDKLogRecord::encode
+                bool writeEncoded(const std::string &record);
+
+                // Blocks until every message queued before this call has been written to disk.
+                void flush();
+
+                // Flushes everything and stops the writer thread.
+                void close();
+
+                unsigned long long getDroppedCount() const;
+
+                // Messages longer than this are truncated, so a single line can't blow up the buffer
+                static constexpr size_t c_maxMessageLength = GSDKLogRecord::c_maxStringLength;
+
+            private:
+                struct Slot
+                {
+                    std::atomic<size_t> m_sequence;
+                    std::string m_record;
+                };
+
+                Slot *claimSlot(size_t &pos);
+                void publishSlot(Slot *slot, size_t pos);
+
+                void writerThreadFunc();
+                size_t drain(std::string &batch);
+                void writeBatch(std::string &batch);
+
+                std::unique_ptr<Slot[]> m_slots;
+                size_t m_mask;
+                OverflowPolicy m_policy;
+                bool m_binary;
+
+                // Producers contend on m_enqueuePos, keep it away from the writer's cache lines
+                alignas(64) std::atomic<size_t> m_enqueuePos;
+                alignas(64) size_t m_dequeuePos; // only touched by the writer (or by close() once it has stopped)
+                std::atomic<size_t> m_writtenPos;
+                std::atomic<unsigned long long> m_droppedCount;
+
+                std::atomic<bool> m_isOpen;
+                std::atomic<bool> m_stopRequested;
+                std::mutex m_wakeMutex;
+                bool m_wakeRequested; // guarded by m_wakeMutex
+                std::condition_variable m_wakeCondition;
+                std::condition_variable m_flushedCondition;
+
+                // Only touched by the writer thread (or by close() once it has stopped)
+                GSDKLogSegments m_segments;
+                GSDKLogRecord::Record m_decodedRecord;
+                std::thread m_writerThread;
+            };
+        }
+    }
+}
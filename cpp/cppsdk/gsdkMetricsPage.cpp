@@ -0,0 +1,206 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkMetricsPage.h"
+#include <new>
+
+#ifdef GSDK_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            std::atomic<uint64_t> GSDKMetricsPage::m_playFabRequests(0);
+            std::atomic<uint64_t> GSDKMetricsPage::m_playFabFailures(0);
+
+            // A reader that keeps losing the race to the writer gives up rather than spinning forever
+            constexpr int c_maxReadAttempts = 100;
+
+#ifdef GSDK_LINUX
+            static const int c_invalidFile = -1;
+#else
+            static void * const c_invalidFile = INVALID_HANDLE_VALUE;
+#endif
+
+            GSDKMetricsPage::GSDKMetricsPage() :
+                m_page(nullptr),
+                m_file(c_invalidFile)
+#ifndef GSDK_LINUX
+                , m_mapping(nullptr)
+#endif
+            {
+            }
+
+            GSDKMetricsPage::~GSDKMetricsPage()
+            {
+                close();
+            }
+
+            bool GSDKMetricsPage::open(const std::string &path)
+            {
+                if (isOpen())
+                {
+                    return true;
+                }
+
+                void *view = nullptr;
+#ifdef GSDK_LINUX
+                m_file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                if (m_file == c_invalidFile)
+                {
+                    return false;
+                }
+
+                if (ftruncate(m_file, static_cast<off_t>(c_metricsPageFileSize)) != 0)
+                {
+                    close();
+                    return false;
+                }
+
+                view = mmap(nullptr, c_metricsPageFileSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+                if (view == MAP_FAILED)
+                {
+                    close();
+                    return false;
+                }
+#else
+                m_file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                     nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (m_file == c_invalidFile)
+                {
+                    return false;
+                }
+
+                // Mapping a size larger than the file grows it to that size
+                m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(c_metricsPageFileSize), nullptr);
+                if (m_mapping == nullptr)
+                {
+                    close();
+                    return false;
+                }
+
+                view = MapViewOfFile(m_mapping, FILE_MAP_WRITE, 0, 0, c_metricsPageFileSize);
+                if (view == nullptr)
+                {
+                    close();
+                    return false;
+                }
+#endif
+
+                // The file starts out zeroed, so readers see sequence 0 and magic 0 until the header is written
+                m_page = new (view) GSDKMetricsPageLayout();
+                m_page->m_version = c_metricsPageVersion;
+                m_page->m_size = static_cast<uint32_t>(sizeof(GSDKMetricsSnapshot));
+                m_page->m_sequence.store(0, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                m_page->m_magic = c_metricsPageMagic;
+                return true;
+            }
+
+            bool GSDKMetricsPage::isOpen() const
+            {
+                return m_page != nullptr;
+            }
+
+            void GSDKMetricsPage::publish(const GSDKMetricsSnapshot &snapshot)
+            {
+                if (m_page == nullptr)
+                {
+                    return;
+                }
+
+                // Seqlock write: odd sequence, copy, even sequence. There is a single writer, so no CAS.
+                uint64_t sequence = m_page->m_sequence.load(std::memory_order_relaxed);
+                m_page->m_sequence.store(sequence + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                memcpy(&m_page->m_snapshot, &snapshot, sizeof(snapshot));
+                m_page->m_sequence.store(sequence + 2, std::memory_order_release);
+            }
+
+            void GSDKMetricsPage::close()
+            {
+#ifdef GSDK_LINUX
+                if (m_page != nullptr)
+                {
+                    munmap(m_page, c_metricsPageFileSize);
+                }
+                if (m_file != c_invalidFile)
+                {
+                    ::close(m_file);
+                }
+#else
+                if (m_page != nullptr)
+                {
+                    UnmapViewOfFile(m_page);
+                }
+                if (m_mapping != nullptr)
+                {
+                    CloseHandle(m_mapping);
+                    m_mapping = nullptr;
+                }
+                if (m_file != c_invalidFile)
+                {
+                    CloseHandle(m_file);
+                }
+#endif
+                m_page = nullptr;
+                m_file = c_invalidFile;
+            }
+
+            bool GSDKMetricsPage::read(const void *page, GSDKMetricsSnapshot &snapshot)
+            {
+                const GSDKMetricsPageLayout *layout = static_cast<const GSDKMetricsPageLayout *>(page);
+                if (layout->m_magic != c_metricsPageMagic)
+                {
+                    return false;
+                }
+
+                // A newer writer may have appended fields, only copy what both sides know about
+                size_t size = std::min<size_t>(layout->m_size, sizeof(snapshot));
+                for (int attempt = 0; attempt < c_maxReadAttempts; ++attempt)
+                {
+                    uint64_t before = layout->m_sequence.load(std::memory_order_acquire);
+                    if ((before & 1) != 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    memcpy(&snapshot, &layout->m_snapshot, size);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+
+                    if (layout->m_sequence.load(std::memory_order_relaxed) == before)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void GSDKMetricsPage::countPlayFabResult(bool succeeded)
+            {
+                m_playFabRequests.fetch_add(1, std::memory_order_relaxed);
+                if (!succeeded)
+                {
+                    m_playFabFailures.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            uint64_t GSDKMetricsPage::getPlayFabRequests()
+            {
+                return m_playFabRequests.load(std::memory_order_relaxed);
+            }
+
+            uint64_t GSDKMetricsPage::getPlayFabFailures()
+            {
+                return m_playFabFailures.load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
@@ -0,0 +1,110 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // What the metrics page publishes. Fields are only ever appended (bumping c_metricsPageVersion),
+            // so a reader built against an older version can still read the prefix it knows about.
+            struct GSDKMetricsSnapshot
+            {
+                uint64_t m_processId;
+                uint64_t m_startTimeUnixMs;
+                uint64_t m_updateTimeUnixMs;
+                uint64_t m_uptimeMs;
+
+                uint32_t m_gameState;           // GameState value
+                uint32_t m_gameHealthy;         // 1 if the last heartbeat reported healthy
+                uint32_t m_connectedPlayers;
+                uint32_t m_heartbeatIntervalMs; // as requested by the agent
+
+                uint64_t m_heartbeatsSent;
+                uint64_t m_heartbeatFailures;   // transport errors and non-success status codes
+                uint64_t m_lastHeartbeatUnixMs;
+                uint64_t m_lastHeartbeatLatencyUs;
+                uint64_t m_maxHeartbeatLatencyUs;
+
+                uint64_t m_playFabRequests;
+                uint64_t m_playFabFailures;
+                uint64_t m_logMessagesDropped;
+
+                char m_instanceId[64];          // null terminated, truncated if longer
+
+                // Version 2, from the resource sampler (see ProcessResourceUsage)
+                uint64_t m_cpuUserMs;
+                uint64_t m_cpuSystemMs;
+                uint64_t m_residentBytes;
+                uint32_t m_openFileDescriptors;
+                uint32_t m_threadCount;
+                uint64_t m_voluntaryContextSwitches;
+                uint64_t m_involuntaryContextSwitches;
+                uint64_t m_cgroupMemoryBytes;
+                uint64_t m_cgroupThrottledUs;
+            };
+
+            // Layout of the memory mapped GSDK_metrics.page file in the log folder. A sidecar maps the
+            // file read-only and reads it with GSDKMetricsPage::read (or the same seqlock protocol),
+            // without any syscall or request reaching the game server.
+            //
+            // All integers are little endian. m_sequence is odd while an update is in progress.
+            struct GSDKMetricsPageLayout
+            {
+                uint32_t m_magic;   // c_metricsPageMagic
+                uint32_t m_version; // c_metricsPageVersion
+                uint32_t m_size;    // sizeof(GSDKMetricsSnapshot) as written
+                uint32_t m_reserved;
+                std::atomic<uint64_t> m_sequence;
+                GSDKMetricsSnapshot m_snapshot;
+            };
+
+            constexpr uint32_t c_metricsPageMagic = 0x4d445347; // "GSDM"
+            constexpr uint32_t c_metricsPageVersion = 2;
+            constexpr size_t c_metricsPageFileSize = 4096;
+
+            static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t), "The page needs a plain 64 bit sequence");
+            static_assert(sizeof(GSDKMetricsPageLayout) <= c_metricsPageFileSize, "GSDKMetricsPageLayout must fit in the file");
+
+            // Owns the mapping. Only one thread (the heartbeat thread) publishes.
+            class GSDKMetricsPage
+            {
+            public:
+                GSDKMetricsPage();
+                ~GSDKMetricsPage();
+
+                bool open(const std::string &path);
+                bool isOpen() const;
+                void publish(const GSDKMetricsSnapshot &snapshot);
+                void close();
+
+                // Consistent copy of a mapped page. Returns false if it isn't a metrics page or keeps changing.
+                static bool read(const void *page, GSDKMetricsSnapshot &snapshot);
+
+                // PlayFab requests are counted process wide, they don't go through GSDKInternal
+                static void countPlayFabResult(bool succeeded);
+                static uint64_t getPlayFabRequests();
+                static uint64_t getPlayFabFailures();
+
+            private:
+                GSDKMetricsPageLayout *m_page;
+
+#ifdef GSDK_LINUX
+                int m_file;
+#else
+                void *m_file;    // HANDLE
+                void *m_mapping; // HANDLE
+#endif
+
+                static std::atomic<uint64_t> m_playFabRequests;
+                static std::atomic<uint64_t> m_playFabFailures;
+            };
+        }
+    }
+}
@@ -0,0 +1,363 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkResourceSampler.h"
+#include <chrono>
+#include <fstream>
+
+#ifdef GSDK_LINUX
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <psapi.h>
+#endif
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            namespace
+            {
+                uint64_t getMonotonicUs()
+                {
+                    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+                }
+
+#ifdef GSDK_LINUX
+                const int c_notOpen = -1;
+
+                // Anything this close to 2^63 is cgroup v1's way of saying "no limit"
+                const uint64_t c_cgroupV1Unlimited = 1ULL << 62;
+
+                struct linux_dirent64
+                {
+                    uint64_t d_ino;
+                    int64_t d_off;
+                    unsigned short d_reclen;
+                    unsigned char d_type;
+                    char d_name[1];
+                };
+
+                int openForSampling(const std::string &path)
+                {
+                    return ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                }
+
+                void closeIfOpen(int &file)
+                {
+                    if (file != c_notOpen)
+                    {
+                        ::close(file);
+                        file = c_notOpen;
+                    }
+                }
+
+                // The number after "key" in a "key value" or "key:\tvalue" list, 0 if the key isn't there
+                uint64_t findValue(const char *text, const char *key)
+                {
+                    size_t keyLength = strlen(key);
+                    for (const char *line = text; line != nullptr && *line != '\0'; )
+                    {
+                        if (strncmp(line, key, keyLength) == 0 && (line[keyLength] == ' ' || line[keyLength] == ':'))
+                        {
+                            const char *value = line + keyLength + 1;
+                            while (*value == ' ' || *value == '\t')
+                            {
+                                ++value;
+                            }
+                            return strtoull(value, nullptr, 10);
+                        }
+                        line = strchr(line, '\n');
+                        if (line != nullptr)
+                        {
+                            ++line;
+                        }
+                    }
+                    return 0;
+                }
+
+                // Skips count space separated fields
+                const char *skipFields(const char *text, int count)
+                {
+                    for (int i = 0; i < count && text != nullptr; ++i)
+                    {
+                        text = strchr(text, ' ');
+                        if (text != nullptr)
+                        {
+                            ++text;
+                        }
+                    }
+                    return text;
+                }
+
+                // Where this process's cgroup lives under the hierarchy mounted at mount, or mount itself
+                // when the path from /proc/self/cgroup isn't visible (typically inside a container).
+                std::string getCgroupFolder(const std::string &mount, const std::string &relativePath)
+                {
+                    std::string folder = mount + relativePath;
+                    if (relativePath.size() > 1 && access(folder.c_str(), F_OK) == 0)
+                    {
+                        return folder + "/";
+                    }
+                    return mount + "/";
+                }
+#endif
+            }
+
+            GSDKResourceSampler::GSDKResourceSampler() :
+                m_lastCpuUs(0),
+                m_lastSampleUs(0)
+#ifdef GSDK_LINUX
+                , m_stat(c_notOpen),
+                m_statm(c_notOpen),
+                m_status(c_notOpen),
+                m_fdDirectory(c_notOpen),
+                m_cgroupMemory(c_notOpen),
+                m_cgroupMemoryLimit(c_notOpen),
+                m_cgroupCpuStat(c_notOpen),
+                m_cgroupV1(false),
+                m_clockTicksPerSecond(100),
+                m_pageSize(4096)
+#endif
+            {
+            }
+
+            GSDKResourceSampler::~GSDKResourceSampler()
+            {
+                close();
+            }
+
+            void GSDKResourceSampler::updateCpuPercent(ProcessResourceUsage &usage)
+            {
+                uint64_t nowUs = getMonotonicUs();
+                uint64_t cpuUs = (usage.m_cpuUserMs + usage.m_cpuSystemMs) * 1000;
+                if (m_lastSampleUs != 0 && nowUs > m_lastSampleUs && cpuUs >= m_lastCpuUs)
+                {
+                    usage.m_cpuPercent = 100.0 * (cpuUs - m_lastCpuUs) / (nowUs - m_lastSampleUs);
+                }
+                m_lastCpuUs = cpuUs;
+                m_lastSampleUs = nowUs;
+            }
+
+#ifdef GSDK_LINUX
+            void GSDKResourceSampler::open()
+            {
+                if (m_stat != c_notOpen)
+                {
+                    return;
+                }
+
+                m_stat = openForSampling("/proc/self/stat");
+                m_statm = openForSampling("/proc/self/statm");
+                m_status = openForSampling("/proc/self/status");
+                m_fdDirectory = ::open("/proc/self/fd", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+                long clockTicks = sysconf(_SC_CLK_TCK);
+                m_clockTicksPerSecond = clockTicks > 0 ? static_cast<uint64_t>(clockTicks) : 100;
+                long pageSize = sysconf(_SC_PAGESIZE);
+                m_pageSize = pageSize > 0 ? static_cast<uint64_t>(pageSize) : 4096;
+
+                // Lines are "id:controllers:path", cgroup v2 is the single "0::path" line
+                std::string unifiedPath, memoryPath, cpuPath;
+                bool hasUnified = false;
+                std::ifstream cgroups("/proc/self/cgroup");
+                std::string line;
+                while (std::getline(cgroups, line))
+                {
+                    size_t first = line.find(':');
+                    size_t second = first == std::string::npos ? std::string::npos : line.find(':', first + 1);
+                    if (second == std::string::npos)
+                    {
+                        continue;
+                    }
+
+                    std::string controllers = "," + line.substr(first + 1, second - first - 1) + ",";
+                    std::string path = line.substr(second + 1);
+                    if (controllers == ",,")
+                    {
+                        unifiedPath = path;
+                        hasUnified = true;
+                    }
+                    else if (controllers.find(",memory,") != std::string::npos)
+                    {
+                        memoryPath = path;
+                    }
+                    else if (controllers.find(",cpu,") != std::string::npos)
+                    {
+                        cpuPath = path;
+                    }
+                }
+
+                if (!memoryPath.empty() || !cpuPath.empty())
+                {
+                    m_cgroupV1 = true;
+                    std::string memoryFolder = getCgroupFolder("/sys/fs/cgroup/memory", memoryPath);
+                    std::string cpuFolder = getCgroupFolder("/sys/fs/cgroup/cpu", cpuPath);
+                    m_cgroupMemory = openForSampling(memoryFolder + "memory.usage_in_bytes");
+                    m_cgroupMemoryLimit = openForSampling(memoryFolder + "memory.limit_in_bytes");
+                    m_cgroupCpuStat = openForSampling(cpuFolder + "cpu.stat");
+                }
+                else if (hasUnified)
+                {
+                    std::string folder = getCgroupFolder("/sys/fs/cgroup", unifiedPath);
+                    m_cgroupMemory = openForSampling(folder + "memory.current");
+                    m_cgroupMemoryLimit = openForSampling(folder + "memory.max");
+                    m_cgroupCpuStat = openForSampling(folder + "cpu.stat");
+                }
+            }
+
+            size_t GSDKResourceSampler::readFile(int file)
+            {
+                m_buffer[0] = '\0';
+                if (file == c_notOpen)
+                {
+                    return 0;
+                }
+
+                // Procfs and cgroupfs regenerate the contents on every read from offset 0
+                ssize_t length = pread(file, m_buffer, sizeof(m_buffer) - 1, 0);
+                if (length <= 0)
+                {
+                    return 0;
+                }
+                m_buffer[length] = '\0';
+                return static_cast<size_t>(length);
+            }
+
+            uint64_t GSDKResourceSampler::readNumber(int file)
+            {
+                return readFile(file) > 0 ? strtoull(m_buffer, nullptr, 10) : 0;
+            }
+
+            void GSDKResourceSampler::sample(ProcessResourceUsage &usage)
+            {
+                usage = ProcessResourceUsage();
+                usage.m_sampleTimeUnixMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count());
+
+                // The command name (field 2) is in parentheses and may contain spaces, fields are counted from
+                // the last ')': state is field 3, utime 14, stime 15, num_threads 20.
+                if (readFile(m_stat) > 0)
+                {
+                    const char *afterName = strrchr(m_buffer, ')');
+                    const char *utime = afterName != nullptr ? skipFields(afterName + 2, 11) : nullptr;
+                    if (utime != nullptr)
+                    {
+                        char *end = nullptr;
+                        uint64_t userTicks = strtoull(utime, &end, 10);
+                        uint64_t systemTicks = strtoull(end, &end, 10);
+                        const char *threads = skipFields(end + 1, 4);
+
+                        usage.m_cpuUserMs = userTicks * 1000 / m_clockTicksPerSecond;
+                        usage.m_cpuSystemMs = systemTicks * 1000 / m_clockTicksPerSecond;
+                        usage.m_threadCount = threads != nullptr ? static_cast<unsigned int>(strtoul(threads, nullptr, 10)) : 0;
+                    }
+                }
+
+                // size resident shared ..., in pages
+                if (readFile(m_statm) > 0)
+                {
+                    const char *resident = skipFields(m_buffer, 1);
+                    usage.m_residentBytes = resident != nullptr ? strtoull(resident, nullptr, 10) * m_pageSize : 0;
+                }
+
+                if (readFile(m_status) > 0)
+                {
+                    usage.m_voluntaryContextSwitches = findValue(m_buffer, "voluntary_ctxt_switches");
+                    usage.m_involuntaryContextSwitches = findValue(m_buffer, "nonvoluntary_ctxt_switches");
+                }
+
+                if (m_fdDirectory != c_notOpen && lseek(m_fdDirectory, 0, SEEK_SET) == 0)
+                {
+                    unsigned int entries = 0;
+                    long length;
+                    while ((length = syscall(SYS_getdents64, m_fdDirectory, m_buffer, sizeof(m_buffer))) > 0)
+                    {
+                        for (long offset = 0; offset < length; )
+                        {
+                            const linux_dirent64 *entry = reinterpret_cast<const linux_dirent64 *>(m_buffer + offset);
+                            if (entry->d_name[0] != '.')
+                            {
+                                ++entries;
+                            }
+                            offset += entry->d_reclen;
+                        }
+                    }
+
+                    // Leave out the descriptors the sampler itself keeps open
+                    unsigned int ownFiles = 0;
+                    for (int file : { m_stat, m_statm, m_status, m_fdDirectory, m_cgroupMemory, m_cgroupMemoryLimit, m_cgroupCpuStat })
+                    {
+                        ownFiles += file != c_notOpen ? 1 : 0;
+                    }
+                    usage.m_openFileDescriptors = entries > ownFiles ? entries - ownFiles : 0;
+                }
+
+                usage.m_cgroupMemoryBytes = readNumber(m_cgroupMemory);
+                uint64_t memoryLimit = readNumber(m_cgroupMemoryLimit); // cgroup v2 writes "max", which reads as 0
+                usage.m_cgroupMemoryLimitBytes = memoryLimit >= c_cgroupV1Unlimited ? 0 : memoryLimit;
+                if (readFile(m_cgroupCpuStat) > 0)
+                {
+                    usage.m_cgroupThrottledUs = m_cgroupV1 ? findValue(m_buffer, "throttled_time") / 1000 : findValue(m_buffer, "throttled_usec");
+                }
+
+                updateCpuPercent(usage);
+            }
+
+            void GSDKResourceSampler::close()
+            {
+                closeIfOpen(m_stat);
+                closeIfOpen(m_statm);
+                closeIfOpen(m_status);
+                closeIfOpen(m_fdDirectory);
+                closeIfOpen(m_cgroupMemory);
+                closeIfOpen(m_cgroupMemoryLimit);
+                closeIfOpen(m_cgroupCpuStat);
+            }
+#else
+            void GSDKResourceSampler::open()
+            {
+            }
+
+            void GSDKResourceSampler::sample(ProcessResourceUsage &usage)
+            {
+                usage = ProcessResourceUsage();
+                usage.m_sampleTimeUnixMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count());
+
+                HANDLE process = GetCurrentProcess();
+                FILETIME creationTime, exitTime, kernelTime, userTime;
+                if (GetProcessTimes(process, &creationTime, &exitTime, &kernelTime, &userTime))
+                {
+                    // FILETIME counts 100 ns intervals
+                    auto toMs = [](const FILETIME &time) { return ((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) / 10000; };
+                    usage.m_cpuUserMs = toMs(userTime);
+                    usage.m_cpuSystemMs = toMs(kernelTime);
+                }
+
+                PROCESS_MEMORY_COUNTERS memory = {};
+                if (GetProcessMemoryInfo(process, &memory, sizeof(memory)))
+                {
+                    usage.m_residentBytes = memory.WorkingSetSize;
+                }
+
+                DWORD handles = 0;
+                if (GetProcessHandleCount(process, &handles))
+                {
+                    usage.m_openFileDescriptors = handles;
+                }
+
+                updateCpuPercent(usage);
+            }
+
+            void GSDKResourceSampler::close()
+            {
+            }
+#endif
+        }
+    }
+}
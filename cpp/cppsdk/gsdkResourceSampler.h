@@ -0,0 +1,60 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "gsdk.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Samples the resource usage of the current process.
+            //
+            // On Linux the /proc and cgroup files are opened once by open() and re-read from offset 0 into a
+            // fixed buffer on every sample, so sampling is a few pread calls and no allocation. On Windows the
+            // process counters come from GetProcessTimes, GetProcessMemoryInfo and GetProcessHandleCount.
+            // Only one thread (the heartbeat thread) samples.
+            class GSDKResourceSampler
+            {
+            public:
+                GSDKResourceSampler();
+                ~GSDKResourceSampler();
+
+                GSDKResourceSampler(const GSDKResourceSampler &) = delete;
+                GSDKResourceSampler &operator=(const GSDKResourceSampler &) = delete;
+
+                void open();
+                void sample(ProcessResourceUsage &usage);
+                void close();
+
+            private:
+                void updateCpuPercent(ProcessResourceUsage &usage);
+
+                uint64_t m_lastCpuUs;
+                uint64_t m_lastSampleUs; // monotonic
+
+#ifdef GSDK_LINUX
+                size_t readFile(int file); // into m_buffer, null terminated
+                uint64_t readNumber(int file);
+
+                int m_stat;
+                int m_statm;
+                int m_status;
+                int m_fdDirectory;
+                int m_cgroupMemory;
+                int m_cgroupMemoryLimit;
+                int m_cgroupCpuStat;
+                bool m_cgroupV1;
+
+                uint64_t m_clockTicksPerSecond;
+                uint64_t m_pageSize;
+                char m_buffer[4096];
+#endif
+            };
+        }
+    }
+}
@@ -0,0 +1,350 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkSharedContent.h"
+#include "gsdkInternal.h"
+
+#ifdef GSDK_LINUX
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            namespace
+            {
+                // What empty files map to, mmap can't map zero bytes
+                const unsigned char c_emptyFile[1] = { 0 };
+
+#ifdef GSDK_LINUX
+                void walkDirectory(const std::string &root, const std::string &relativeFolder, std::vector<std::pair<std::string, uint64_t>> &files)
+                {
+                    DIR *directory = opendir((root + relativeFolder).c_str());
+                    if (directory == nullptr)
+                    {
+                        return;
+                    }
+
+                    while (dirent *entry = readdir(directory))
+                    {
+                        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+                        {
+                            continue;
+                        }
+
+                        std::string relativePath = relativeFolder + entry->d_name;
+                        struct stat fileInfo;
+                        if (stat((root + relativePath).c_str(), &fileInfo) != 0)
+                        {
+                            continue;
+                        }
+                        if (S_ISDIR(fileInfo.st_mode))
+                        {
+                            walkDirectory(root, relativePath + "/", files);
+                        }
+                        else if (S_ISREG(fileInfo.st_mode))
+                        {
+                            files.emplace_back(relativePath, static_cast<uint64_t>(fileInfo.st_size));
+                        }
+                    }
+                    closedir(directory);
+                }
+#else
+                // WIN32_MEMORY_RANGE_ENTRY, which is only declared when targeting Windows 8 or later
+                struct MemoryRange
+                {
+                    void *m_virtualAddress;
+                    SIZE_T m_numberOfBytes;
+                };
+
+                typedef BOOL (WINAPI *PrefetchVirtualMemoryFunction)(HANDLE, ULONG_PTR, MemoryRange *, ULONG);
+
+                void walkDirectory(const std::string &root, const std::string &relativeFolder, std::vector<std::pair<std::string, uint64_t>> &files)
+                {
+                    WIN32_FIND_DATAA findData;
+                    HANDLE find = FindFirstFileA((root + relativeFolder + "*").c_str(), &findData);
+                    if (find == INVALID_HANDLE_VALUE)
+                    {
+                        return;
+                    }
+
+                    do
+                    {
+                        if (strcmp(findData.cFileName, ".") == 0 || strcmp(findData.cFileName, "..") == 0)
+                        {
+                            continue;
+                        }
+
+                        std::string relativePath = relativeFolder + findData.cFileName;
+                        if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+                        {
+                            walkDirectory(root, relativePath + "/", files);
+                        }
+                        else
+                        {
+                            files.emplace_back(relativePath, (static_cast<uint64_t>(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow);
+                        }
+                    } while (FindNextFileA(find, &findData));
+                    FindClose(find);
+                }
+#endif
+            }
+
+            GSDKSharedContent::GSDKSharedContent() : m_indexBuilt(false)
+            {
+            }
+
+            void GSDKSharedContent::setRoot(const std::string &root)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_root = root;
+                if (!m_root.empty() && m_root.back() != '/' && m_root.back() != '\\')
+                {
+                    m_root += '/';
+                }
+                m_indexBuilt = false;
+                m_entries.clear(); // only ever called before anything is mapped
+            }
+
+            std::string GSDKSharedContent::getRoot()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_root;
+            }
+
+            void GSDKSharedContent::buildIndex()
+            {
+                if (m_indexBuilt)
+                {
+                    return;
+                }
+                m_indexBuilt = true;
+
+                if (m_root.empty())
+                {
+                    return;
+                }
+
+                std::vector<std::pair<std::string, uint64_t>> files;
+                walkDirectory(m_root, "", files);
+                m_entries.reserve(files.size());
+                for (const std::pair<std::string, uint64_t> &file : files)
+                {
+                    m_entries.emplace(file.first, Entry{ file.second, nullptr });
+                }
+            }
+
+            bool GSDKSharedContent::isValidPath(const std::string &relativePath)
+            {
+                if (relativePath.empty() || relativePath[0] == '/' || relativePath[0] == '\\' || relativePath.find(':') != std::string::npos)
+                {
+                    return false;
+                }
+
+                // No ".." components, the shared content directory is all this hands out
+                size_t start = 0;
+                while (start <= relativePath.size())
+                {
+                    size_t end = relativePath.find_first_of("/\\", start);
+                    if (end == std::string::npos)
+                    {
+                        end = relativePath.size();
+                    }
+                    if (relativePath.compare(start, end - start, "..") == 0)
+                    {
+                        return false;
+                    }
+                    start = end + 1;
+                }
+                return true;
+            }
+
+            GSDKSharedContent::Entry *GSDKSharedContent::mapEntry(const std::string &relativePath)
+            {
+                buildIndex();
+                if (m_root.empty() || !isValidPath(relativePath))
+                {
+                    return nullptr;
+                }
+
+                std::string key = relativePath;
+                std::replace(key.begin(), key.end(), '\\', '/');
+                auto it = m_entries.find(key);
+                if (it == m_entries.end())
+                {
+                    // Not there when the index was built, e.g. written by another server since
+                    it = m_entries.emplace(key, Entry{ 0, nullptr }).first;
+                }
+
+                Entry &entry = it->second;
+                if (entry.m_data == nullptr && (entry.m_data = mapFile(key, entry.m_size)) == nullptr)
+                {
+                    if (entry.m_size == 0)
+                    {
+                        m_entries.erase(it); // never existed, keep it out of getFiles()
+                    }
+                    return nullptr;
+                }
+                return &entry;
+            }
+
+#ifdef GSDK_LINUX
+            const unsigned char *GSDKSharedContent::mapFile(const std::string &relativePath, uint64_t &size)
+            {
+                std::string path = m_root + relativePath;
+                int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                if (file < 0)
+                {
+                    return nullptr;
+                }
+
+                struct stat fileInfo;
+                const unsigned char *data = nullptr;
+                if (fstat(file, &fileInfo) == 0 && S_ISREG(fileInfo.st_mode))
+                {
+                    size = static_cast<uint64_t>(fileInfo.st_size);
+                    if (size == 0)
+                    {
+                        data = c_emptyFile;
+                    }
+                    else
+                    {
+                        void *mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+                        if (mapping != MAP_FAILED)
+                        {
+                            data = static_cast<const unsigned char *>(mapping);
+                        }
+                        else
+                        {
+                            GSDK_LOG(Warning, SharedContentMapFailed, path, errno);
+                        }
+                    }
+                }
+
+                // The mapping keeps the file referenced
+                ::close(file);
+                return data;
+            }
+
+            bool GSDKSharedContent::adviseWillNeed(const unsigned char *data, uint64_t length)
+            {
+                // madvise wants a page aligned start
+                uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+                uintptr_t start = reinterpret_cast<uintptr_t>(data);
+                uintptr_t alignedStart = start & ~(pageSize - 1);
+                return madvise(reinterpret_cast<void *>(alignedStart), static_cast<size_t>(length + (start - alignedStart)), MADV_WILLNEED) == 0;
+            }
+#else
+            const unsigned char *GSDKSharedContent::mapFile(const std::string &relativePath, uint64_t &size)
+            {
+                std::string path = m_root + relativePath;
+                HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return nullptr;
+                }
+
+                LARGE_INTEGER fileSize;
+                const unsigned char *data = nullptr;
+                if (GetFileSizeEx(file, &fileSize))
+                {
+                    size = static_cast<uint64_t>(fileSize.QuadPart);
+                    if (size == 0)
+                    {
+                        data = c_emptyFile;
+                    }
+                    else
+                    {
+                        HANDLE section = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                        void *view = section != nullptr ? MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0) : nullptr;
+                        if (view != nullptr)
+                        {
+                            data = static_cast<const unsigned char *>(view);
+                        }
+                        else
+                        {
+                            GSDK_LOG(Warning, SharedContentMapFailed, path, static_cast<int>(GetLastError()));
+                        }
+                        if (section != nullptr)
+                        {
+                            CloseHandle(section); // the view keeps the section alive
+                        }
+                    }
+                }
+
+                CloseHandle(file);
+                return data;
+            }
+
+            bool GSDKSharedContent::adviseWillNeed(const unsigned char *data, uint64_t length)
+            {
+                // Windows 8 and later, looked up so that the GSDK still loads on older versions
+                static PrefetchVirtualMemoryFunction prefetchVirtualMemory = reinterpret_cast<PrefetchVirtualMemoryFunction>(
+                    GetProcAddress(GetModuleHandleA("kernel32.dll"), "PrefetchVirtualMemory"));
+                if (prefetchVirtualMemory == nullptr)
+                {
+                    return false;
+                }
+
+                MemoryRange range;
+                range.m_virtualAddress = const_cast<unsigned char *>(data);
+                range.m_numberOfBytes = static_cast<SIZE_T>(length);
+                return prefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != FALSE;
+            }
+#endif
+
+            SharedContentView GSDKSharedContent::map(const std::string &relativePath)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                SharedContentView view;
+                if (Entry *entry = mapEntry(relativePath))
+                {
+                    view.m_data = entry->m_data;
+                    view.m_size = entry->m_size;
+                }
+                return view;
+            }
+
+            bool GSDKSharedContent::prefetch(const std::string &relativePath, uint64_t offset, uint64_t length)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                Entry *entry = mapEntry(relativePath);
+                if (entry == nullptr)
+                {
+                    return false;
+                }
+                if (offset >= entry->m_size)
+                {
+                    return true;
+                }
+                if (length == 0 || length > entry->m_size - offset)
+                {
+                    length = entry->m_size - offset;
+                }
+                return adviseWillNeed(entry->m_data + offset, length);
+            }
+
+            std::vector<std::string> GSDKSharedContent::getFiles()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                buildIndex();
+                std::vector<std::string> files;
+                files.reserve(m_entries.size());
+                for (const auto &entry : m_entries)
+                {
+                    files.push_back(entry.first);
+                }
+                std::sort(files.begin(), files.end());
+                return files;
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "gsdk.h"
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Read-only memory mappings of the files in the shared content directory, behind GSDK::mapSharedContent.
+            //
+            // The directory is shared by every server on the VM, so mapping its files (MAP_SHARED / a read-only
+            // section) makes all of them use the one copy in the page cache instead of each reading the assets
+            // into private memory. The index of files is built by walking the directory on first use, each file
+            // is mapped the first time it is asked for, and mappings are never unmapped so views stay valid until
+            // the process exits.
+            class GSDKSharedContent
+            {
+            public:
+                GSDKSharedContent();
+
+                GSDKSharedContent(const GSDKSharedContent &) = delete;
+                GSDKSharedContent &operator=(const GSDKSharedContent &) = delete;
+
+                void setRoot(const std::string &root);
+                std::string getRoot(); // with a trailing separator, empty if there is no shared content directory
+
+                // Relative paths use '/' on every platform; a file created after the index was built is still found
+                SharedContentView map(const std::string &relativePath);
+
+                // madvise(MADV_WILLNEED) / PrefetchVirtualMemory over [offset, offset + length), length 0 meaning to the end
+                bool prefetch(const std::string &relativePath, uint64_t offset, uint64_t length);
+
+                std::vector<std::string> getFiles();
+
+            private:
+                struct Entry
+                {
+                    uint64_t m_size;
+                    const unsigned char *m_data; // nullptr until mapped
+                };
+
+                void buildIndex();
+                Entry *mapEntry(const std::string &relativePath); // nullptr if the file can't be mapped
+                static bool isValidPath(const std::string &relativePath);
+                const unsigned char *mapFile(const std::string &relativePath, uint64_t &size);
+                static bool adviseWillNeed(const unsigned char *data, uint64_t length);
+
+                std::mutex m_mutex;
+                std::string m_root; // with a trailing separator, empty if there is no shared content directory
+                bool m_indexBuilt;
+                std::unordered_map<std::string, Entry> m_entries;
+            };
+        }
+    }
+}
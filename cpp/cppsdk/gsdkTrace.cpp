@@ -0,0 +1,249 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkTrace.h"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef GSDK_LINUX
+#include <unistd.h>
+#endif
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            constexpr size_t GSDKTrace::c_eventsPerThread;
+            constexpr size_t GSDKTrace::c_maxExitedThreadBuffers;
+            std::atomic<bool> GSDKTrace::m_enabled(false);
+
+            namespace
+            {
+                struct TraceEvent
+                {
+                    const char *m_name;
+                    const char *m_category;
+                    uint64_t m_startNs;
+                    uint64_t m_durationNs;
+                };
+
+                // Only the owning thread records into a buffer. The mutex is only ever contended while
+                // a trace is being exported, so recording is an uncontended lock and a 32 byte copy.
+                struct ThreadBuffer
+                {
+                    std::mutex m_mutex;
+                    std::unique_ptr<TraceEvent[]> m_events;
+                    uint64_t m_recordedCount = 0;
+                    unsigned int m_threadId = 0;
+                    const char *m_threadName = nullptr;
+                };
+
+                // Buffers stay registered after their thread exits, so short lived threads (the shutdown
+                // callback, PlayFab requests) still show up in the trace, but only the newest
+                // c_maxExitedThreadBuffers of them: past that, a new thread takes over the buffer of the
+                // thread that exited first, or it is freed.
+                struct Registry
+                {
+                    std::mutex m_mutex;
+                    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+                    std::deque<ThreadBuffer *> m_exited; // oldest first
+                    unsigned int m_lastThreadId = 0;
+                };
+
+                // Deliberately never destroyed: the heartbeat thread can still record spans while other
+                // statics are being torn down at process exit.
+                Registry &getRegistry()
+                {
+                    static Registry *registry = new Registry();
+                    return *registry;
+                }
+
+                // Hands the buffer back to the registry when its thread exits
+                struct ThreadBufferOwner
+                {
+                    ThreadBuffer *m_buffer = nullptr;
+
+                    ~ThreadBufferOwner()
+                    {
+                        if (m_buffer == nullptr)
+                        {
+                            return;
+                        }
+
+                        Registry &registry = getRegistry();
+                        std::lock_guard<std::mutex> lock(registry.m_mutex);
+                        registry.m_exited.push_back(m_buffer);
+                        if (registry.m_exited.size() > GSDKTrace::c_maxExitedThreadBuffers)
+                        {
+                            ThreadBuffer *oldest = registry.m_exited.front();
+                            registry.m_exited.pop_front();
+                            registry.m_buffers.erase(std::find_if(registry.m_buffers.begin(), registry.m_buffers.end(),
+                                [oldest](const std::unique_ptr<ThreadBuffer> &buffer) { return buffer.get() == oldest; }));
+                        }
+                    }
+                };
+
+                ThreadBuffer &getThreadBuffer()
+                {
+                    static thread_local ThreadBufferOwner owner;
+                    if (owner.m_buffer == nullptr)
+                    {
+                        Registry &registry = getRegistry();
+                        std::lock_guard<std::mutex> lock(registry.m_mutex);
+                        if (registry.m_exited.size() >= GSDKTrace::c_maxExitedThreadBuffers)
+                        {
+                            ThreadBuffer *buffer = registry.m_exited.front();
+                            registry.m_exited.pop_front();
+
+                            std::lock_guard<std::mutex> bufferLock(buffer->m_mutex);
+                            buffer->m_recordedCount = 0;
+                            buffer->m_threadId = ++registry.m_lastThreadId;
+                            buffer->m_threadName = nullptr;
+                            owner.m_buffer = buffer;
+                        }
+                        else
+                        {
+                            std::unique_ptr<ThreadBuffer> newBuffer(new ThreadBuffer());
+                            newBuffer->m_events.reset(new TraceEvent[GSDKTrace::c_eventsPerThread]);
+                            newBuffer->m_threadId = ++registry.m_lastThreadId;
+                            owner.m_buffer = newBuffer.get();
+                            registry.m_buffers.push_back(std::move(newBuffer));
+                        }
+                    }
+                    return *owner.m_buffer;
+                }
+
+                void appendJsonString(std::string &out, const char *value)
+                {
+                    out.push_back('"');
+                    for (const char *c = value; *c != '\0'; ++c)
+                    {
+                        if (*c == '"' || *c == '\\')
+                        {
+                            out.push_back('\\');
+                            out.push_back(*c);
+                        }
+                        else if (*c == '\n')
+                        {
+                            out.append("\\n");
+                        }
+                        else if (*c == '\t')
+                        {
+                            out.append("\\t");
+                        }
+                        else if (static_cast<unsigned char>(*c) < 0x20)
+                        {
+                            // JSON doesn't allow control characters in strings
+                            char escaped[8];
+                            snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(*c)));
+                            out.append(escaped);
+                        }
+                        else
+                        {
+                            out.push_back(*c);
+                        }
+                    }
+                    out.push_back('"');
+                }
+
+                unsigned long getProcessId()
+                {
+#ifdef GSDK_LINUX
+                    return static_cast<unsigned long>(getpid());
+#else
+                    return static_cast<unsigned long>(GetCurrentProcessId());
+#endif
+                }
+            }
+
+            void GSDKTrace::setEnabled(bool enabled)
+            {
+                m_enabled.store(enabled, std::memory_order_relaxed);
+            }
+
+            uint64_t GSDKTrace::now()
+            {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+
+            void GSDKTrace::record(const char *name, const char *category, uint64_t startNs, uint64_t endNs)
+            {
+                ThreadBuffer &buffer = getThreadBuffer();
+                std::lock_guard<std::mutex> lock(buffer.m_mutex);
+
+                TraceEvent &event = buffer.m_events[buffer.m_recordedCount % c_eventsPerThread];
+                event.m_name = name;
+                event.m_category = category;
+                event.m_startNs = startNs;
+                event.m_durationNs = endNs > startNs ? endNs - startNs : 0;
+                ++buffer.m_recordedCount;
+            }
+
+            void GSDKTrace::setThreadName(const char *name)
+            {
+                ThreadBuffer &buffer = getThreadBuffer();
+                std::lock_guard<std::mutex> lock(buffer.m_mutex);
+                buffer.m_threadName = name;
+            }
+
+            bool GSDKTrace::writeChromeTrace(const std::string &path)
+            {
+                std::string pid = std::to_string(getProcessId());
+                std::string json;
+                json.reserve(64 * 1024);
+                json.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+                bool first = true;
+                char number[64];
+                {
+                    Registry &registry = getRegistry();
+                    std::lock_guard<std::mutex> registryLock(registry.m_mutex);
+                    for (const std::unique_ptr<ThreadBuffer> &buffer : registry.m_buffers)
+                    {
+                        std::lock_guard<std::mutex> lock(buffer->m_mutex);
+                        std::string tid = std::to_string(buffer->m_threadId);
+
+                        if (buffer->m_threadName != nullptr)
+                        {
+                            json.append(first ? "\n" : ",\n");
+                            json.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":").append(pid).append(",\"tid\":").append(tid).append(",\"args\":{\"name\":");
+                            appendJsonString(json, buffer->m_threadName);
+                            json.append("}}");
+                            first = false;
+                        }
+
+                        // Oldest first; only the newest c_eventsPerThread spans are still in the ring
+                        uint64_t begin = buffer->m_recordedCount > c_eventsPerThread ? buffer->m_recordedCount - c_eventsPerThread : 0;
+                        for (uint64_t i = begin; i < buffer->m_recordedCount; ++i)
+                        {
+                            const TraceEvent &event = buffer->m_events[i % c_eventsPerThread];
+                            json.append(first ? "\n" : ",\n");
+                            json.append("{\"name\":");
+                            appendJsonString(json, event.m_name);
+                            json.append(",\"cat\":");
+                            appendJsonString(json, event.m_category);
+                            // Chrome trace timestamps are in microseconds
+                            snprintf(number, sizeof(number), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":",
+                                     event.m_startNs / 1000.0, event.m_durationNs / 1000.0);
+                            json.append(number).append(pid).append(",\"tid\":").append(tid).append("}");
+                            first = false;
+                        }
+                    }
+                }
+                json.append("\n]}\n");
+
+                std::ofstream file(path, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+                file << json;
+                return file.good();
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Records timed spans (name, start, duration, thread) into per-thread ring buffers and
+            // exports them as Chrome trace JSON, which chrome://tracing and ui.perfetto.dev open.
+            // When tracing is off, a span costs one relaxed atomic load.
+            class GSDKTrace
+            {
+            public:
+                static void setEnabled(bool enabled);
+
+                static bool isEnabled()
+                {
+                    return m_enabled.load(std::memory_order_relaxed);
+                }
+
+                // Monotonic clock, in nanoseconds
+                static uint64_t now();
+
+                // name and category must outlive the trace (string literals or __func__)
+                static void record(const char *name, const char *category, uint64_t startNs, uint64_t endNs);
+
+                // Labels the calling thread in the exported trace. name must be a string literal.
+                static void setThreadName(const char *name);
+
+                // Writes every span still in the buffers. Spans keep being recorded while this runs.
+                static bool writeChromeTrace(const std::string &path);
+
+                // Each thread keeps its newest c_eventsPerThread spans
+                static constexpr size_t c_eventsPerThread = 8192;
+
+                // The buffers of up to this many exited threads are kept so their spans are still exported;
+                // past that the oldest is reused by a new thread or freed
+                static constexpr size_t c_maxExitedThreadBuffers = 16;
+
+            private:
+                static std::atomic<bool> m_enabled;
+            };
+
+            // Records a span from construction to destruction
+            class GSDKTraceSpan
+            {
+            public:
+                explicit GSDKTraceSpan(const char *name, const char *category = "gsdk") :
+                    m_name(name),
+                    m_category(category),
+                    m_startNs(GSDKTrace::isEnabled() ? GSDKTrace::now() : 0)
+                {
+                }
+
+                ~GSDKTraceSpan()
+                {
+                    if (m_startNs != 0)
+                    {
+                        GSDKTrace::record(m_name, m_category, m_startNs, GSDKTrace::now());
+                    }
+                }
+
+                GSDKTraceSpan(const GSDKTraceSpan &) = delete;
+                GSDKTraceSpan &operator=(const GSDKTraceSpan &) = delete;
+
+            private:
+                const char *m_name;
+                const char *m_category;
+                uint64_t m_startNs; // 0 if tracing was off when the span started
+            };
+        }
+    }
+}
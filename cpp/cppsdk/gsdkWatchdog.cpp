@@ -0,0 +1,262 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "gsdkCommonPch.h"
+#include "gsdkWatchdog.h"
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#ifdef GSDK_LINUX
+#include <dirent.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <dbghelp.h>
+#endif
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            std::atomic<uint64_t> GSDKWatchdog::m_timeoutNs(0);
+            std::atomic<uint64_t> GSDKWatchdog::m_lastPetNs(0);
+            constexpr const char *GSDKWatchdog::c_stacksFileExtension;
+
+            namespace
+            {
+#ifdef GSDK_LINUX
+                constexpr int c_maxFrames = 64;
+                constexpr int c_maxThreads = 512;
+                constexpr int c_responseTimeoutMs = 200;
+
+                int getStackSignal()
+                {
+                    return SIGRTMIN + 4;
+                }
+
+                struct ThreadStack
+                {
+                    pid_t m_threadId;
+                    int m_depth;
+                    void *m_frames[c_maxFrames];
+                };
+
+                // Filled in by the signal handler on each thread, one slot per thread
+                struct StackCapture
+                {
+                    std::atomic<int> m_nextSlot;
+                    std::atomic<int> m_finished;
+                    ThreadStack m_stacks[c_maxThreads];
+                };
+
+                // Created before the handler is installed and never destroyed, the handler only reads the pointer.
+                // Null until setTimeout enables the watchdog: the handler is only installed for games that use it.
+                std::atomic<StackCapture *> g_stackCapture(nullptr);
+
+                void captureStackSignalHandler(int)
+                {
+                    int savedErrno = errno;
+                    StackCapture *capture = g_stackCapture.load(std::memory_order_acquire);
+                    int slot = capture->m_nextSlot.fetch_add(1, std::memory_order_relaxed);
+                    if (slot < c_maxThreads)
+                    {
+                        ThreadStack &stack = capture->m_stacks[slot];
+                        stack.m_threadId = static_cast<pid_t>(syscall(SYS_gettid));
+                        stack.m_depth = backtrace(stack.m_frames, c_maxFrames);
+                    }
+                    capture->m_finished.fetch_add(1, std::memory_order_release);
+                    errno = savedErrno;
+                }
+
+                void installStackHandler()
+                {
+                    static std::once_flag installed;
+                    std::call_once(installed, []()
+                    {
+                        // The first backtrace() loads libgcc, which allocates and isn't async-signal-safe; get that
+                        // out of the way here, before the handler can run
+                        void *frames[1];
+                        backtrace(frames, 1);
+
+                        g_stackCapture.store(new StackCapture(), std::memory_order_release);
+
+                        struct sigaction action = {};
+                        action.sa_handler = captureStackSignalHandler;
+                        action.sa_flags = SA_RESTART;
+                        sigemptyset(&action.sa_mask);
+                        sigaction(getStackSignal(), &action, nullptr);
+                    });
+                }
+
+                std::vector<pid_t> getThreadIds()
+                {
+                    std::vector<pid_t> threadIds;
+                    DIR *tasks = opendir("/proc/self/task");
+                    if (tasks == nullptr)
+                    {
+                        return threadIds;
+                    }
+                    while (dirent *entry = readdir(tasks))
+                    {
+                        if (entry->d_name[0] != '.')
+                        {
+                            threadIds.push_back(static_cast<pid_t>(atoi(entry->d_name)));
+                        }
+                    }
+                    closedir(tasks);
+                    return threadIds;
+                }
+
+                std::string getThreadName(pid_t threadId)
+                {
+                    std::ifstream comm("/proc/self/task/" + std::to_string(threadId) + "/comm");
+                    std::string name;
+                    std::getline(comm, name);
+                    return name;
+                }
+
+                void writeString(int file, const std::string &text)
+                {
+                    ssize_t written = write(file, text.data(), text.size());
+                    (void)written;
+                }
+#else
+                typedef BOOL (WINAPI *MiniDumpWriteDumpFunction)(HANDLE, DWORD, HANDLE, MINIDUMP_TYPE,
+                    PMINIDUMP_EXCEPTION_INFORMATION, PMINIDUMP_USER_STREAM_INFORMATION, PMINIDUMP_CALLBACK_INFORMATION);
+#endif
+            }
+
+            uint64_t GSDKWatchdog::now()
+            {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+
+            void GSDKWatchdog::setTimeout(uint64_t timeoutMs)
+            {
+#ifdef GSDK_LINUX
+                if (timeoutMs > 0)
+                {
+                    installStackHandler();
+                }
+#endif
+                pet();
+                m_timeoutNs.store(timeoutMs * 1000000ULL, std::memory_order_relaxed);
+            }
+
+            uint64_t GSDKWatchdog::getTimeoutMs()
+            {
+                return m_timeoutNs.load(std::memory_order_relaxed) / 1000000ULL;
+            }
+
+            bool GSDKWatchdog::isStalled(uint64_t &stalledMs)
+            {
+                uint64_t timeoutNs = m_timeoutNs.load(std::memory_order_relaxed);
+                if (timeoutNs == 0)
+                {
+                    return false;
+                }
+
+                uint64_t lastPetNs = m_lastPetNs.load(std::memory_order_relaxed);
+                uint64_t currentNs = now();
+                uint64_t sincePetNs = currentNs > lastPetNs ? currentNs - lastPetNs : 0;
+                stalledMs = sincePetNs / 1000000ULL;
+                return sincePetNs > timeoutNs;
+            }
+
+#ifdef GSDK_LINUX
+            bool GSDKWatchdog::captureStacks(const std::string &path)
+            {
+                StackCapture *stackCapture = g_stackCapture.load(std::memory_order_acquire);
+                if (stackCapture == nullptr)
+                {
+                    return false; // the watchdog was never enabled, so the handler isn't installed
+                }
+
+                int file = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                if (file < 0)
+                {
+                    return false;
+                }
+
+                StackCapture &capture = *stackCapture;
+                capture.m_nextSlot.store(0, std::memory_order_relaxed);
+                capture.m_finished.store(0, std::memory_order_relaxed);
+
+                // One thread at a time, so a thread that has the signal blocked only costs its own timeout
+                std::vector<pid_t> threadIds = getThreadIds();
+                std::vector<pid_t> unresponsive;
+                pid_t processId = getpid();
+                int expected = 0;
+                for (pid_t threadId : threadIds)
+                {
+                    if (syscall(SYS_tgkill, processId, threadId, getStackSignal()) != 0)
+                    {
+                        continue; // the thread exited in the meantime
+                    }
+
+                    ++expected;
+                    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(c_responseTimeoutMs);
+                    while (capture.m_finished.load(std::memory_order_acquire) < expected && std::chrono::steady_clock::now() < deadline)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    if (capture.m_finished.load(std::memory_order_acquire) < expected)
+                    {
+                        unresponsive.push_back(threadId);
+                        expected = capture.m_finished.load(std::memory_order_acquire);
+                    }
+                }
+
+                writeString(file, "Stacks of process " + std::to_string(processId) + ", " + std::to_string(threadIds.size()) + " threads\n");
+                int captured = std::min(capture.m_finished.load(std::memory_order_acquire), c_maxThreads);
+                for (int slot = 0; slot < captured; ++slot)
+                {
+                    const ThreadStack &stack = capture.m_stacks[slot];
+                    writeString(file, "\nThread " + std::to_string(stack.m_threadId) + " (" + getThreadName(stack.m_threadId) + ")\n");
+                    backtrace_symbols_fd(stack.m_frames, stack.m_depth, file);
+                }
+                for (pid_t threadId : unresponsive)
+                {
+                    writeString(file, "\nThread " + std::to_string(threadId) + " (" + getThreadName(threadId) + ") did not respond\n");
+                }
+
+                close(file);
+                return true;
+            }
+#else
+            bool GSDKWatchdog::captureStacks(const std::string &path)
+            {
+                // Loaded on demand so that games don't have to link dbghelp.lib for a feature they may not use
+                HMODULE dbghelp = LoadLibraryA("dbghelp.dll");
+                MiniDumpWriteDumpFunction miniDumpWriteDump = dbghelp != nullptr
+                    ? reinterpret_cast<MiniDumpWriteDumpFunction>(GetProcAddress(dbghelp, "MiniDumpWriteDump"))
+                    : nullptr;
+                if (miniDumpWriteDump == nullptr)
+                {
+                    return false;
+                }
+
+                HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return false;
+                }
+
+                // Thread stacks plus enough module information to symbolize them, without the whole heap
+                BOOL written = miniDumpWriteDump(GetCurrentProcess(), GetCurrentProcessId(), file,
+                    static_cast<MINIDUMP_TYPE>(MiniDumpNormal | MiniDumpWithThreadInfo), nullptr, nullptr, nullptr);
+                CloseHandle(file);
+                return written != FALSE;
+            }
+#endif
+        }
+    }
+}
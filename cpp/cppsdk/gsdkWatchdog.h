@@ -0,0 +1,51 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Microsoft
+{
+    namespace Azure
+    {
+        namespace Gaming
+        {
+            // Game loop stall detection behind GSDK::setWatchdogTimeout and GSDK::petWatchdog.
+            // Petting is one relaxed store of the monotonic clock; the heartbeat thread checks it.
+            class GSDKWatchdog
+            {
+            public:
+                static void setTimeout(uint64_t timeoutMs);
+
+                static void pet()
+                {
+                    m_lastPetNs.store(now(), std::memory_order_relaxed);
+                }
+
+                static uint64_t getTimeoutMs();
+
+                // True if enabled and not petted for longer than the timeout
+                static bool isStalled(uint64_t &stalledMs);
+
+                // Writes the stack of every thread in the process to path: symbolized text on Linux, a minidump
+                // on Windows (see c_stacksFileExtension). Only one thread may capture at a time. On Linux this
+                // needs the SIGRTMIN+4 handler, which setTimeout installs the first time it enables the watchdog.
+                static bool captureStacks(const std::string &path);
+
+#ifdef GSDK_LINUX
+                static constexpr const char *c_stacksFileExtension = ".txt";
+#else
+                static constexpr const char *c_stacksFileExtension = ".dmp";
+#endif
+
+            private:
+                static uint64_t now();
+
+                static std::atomic<uint64_t> m_timeoutNs; // 0 when off
+                static std::atomic<uint64_t> m_lastPetNs;
+            };
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#ifdef ENABLE_PLAYFABSERVER_API
+
+#include <playfab/PlayFabHttp.h>
+#include <playfab/PlayFabServerDataModels.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Microsoft { namespace Azure { namespace Gaming { class GSDKTests; } } }
+
+namespace PlayFab
+{
+    /// <summary>
+    /// Process wide PlayFabEventPipeline counters.
+    /// Succeeded, failed and latency are counted when the results are delivered: by Update() unless threadedCallbacks.
+    /// </summary>
+    struct PlayFabEventPipelineStats
+    {
+        uint64_t eventsQueued;
+        uint64_t eventsDropped; // the queue was full, or the pipeline was shut down
+        uint64_t eventsSent; // handed to PlayFabHttp
+        uint64_t eventsSucceeded;
+        uint64_t eventsFailed;
+        uint64_t batchesSent; // requests, one per event when the batch endpoint isn't used
+        uint64_t latencyTotalMicroseconds; // from Write...Event until the result, over eventsSucceeded + eventsFailed
+        uint64_t latencyMaxMicroseconds;
+    };
+
+    /// <summary>
+    /// Write-behind telemetry: WritePlayerEvent and WriteTitleEvent only move the event into a fixed size lock-free
+    /// queue, and a background thread sends the queue in batches of PlayFabSettings::eventBatchSize, or whatever has
+    /// queued up every PlayFabSettings::eventFlushIntervalMs, with at most PlayFabSettings::eventBatchesInFlight
+    /// requests outstanding. When the queue is full events are dropped rather than blocking the caller.
+    ///
+    /// With PlayFabSettings::eventNamespace and entityToken set, a batch is one Event/WriteEvents call; otherwise
+    /// each event is its own Server/WritePlayerEvent or WriteTitleEvent call, still serialized off the caller's thread,
+    /// and counts against eventBatchesInFlight on its own.
+    /// </summary>
+    class PlayFabEventPipeline
+    {
+    public:
+        static PlayFabEventPipeline& Get();
+        ~PlayFabEventPipeline();
+
+        /// <summary>
+        /// Moves the request's contents into the queue, leaving it empty. Unset timestamps are set to now, as the
+        /// event may reach PlayFab some time later. False if the event was dropped.
+        /// </summary>
+        bool WritePlayerEvent(ServerModels::WriteServerPlayerEventRequest& request);
+        bool WriteTitleEvent(ServerModels::WriteTitleEventRequest& request);
+
+        /// <summary>Sends what is queued without waiting for the flush interval</summary>
+        void Flush();
+
+        /// <summary>
+        /// Stops taking events, sends everything queued and waits up to timeout for it, then cancels the batches
+        /// still outstanding. Returns how many events were not delivered. Without Shutdown, queued events are lost
+        /// when the process exits.
+        /// </summary>
+        size_t Shutdown(std::chrono::milliseconds timeout);
+
+        static PlayFabEventPipelineStats GetStats();
+
+        static constexpr unsigned int c_maxBatchSize = 200; // the most Event/WriteEvents takes in one call
+    private:
+        friend class ::Microsoft::Azure::Gaming::GSDKTests; // creates pipelines with its own settings
+        PlayFabEventPipeline(); // Private constructor, to enforce singleton instance
+        PlayFabEventPipeline(const PlayFabEventPipeline& other); // Private copy-constructor, to enforce singleton instance
+
+        struct QueuedEvent
+        {
+            bool playerEvent;
+            std::string eventName;
+            std::string playFabId;
+            Json::Value body;
+            time_t timestamp;
+            int64_t enqueueMicroseconds; // steady clock
+        };
+
+        // A bounded multi-producer queue (Vyukov): a slot is free for position p when its sequence is p,
+        // and holds the event for p once its sequence is p + 1
+        struct QueueSlot
+        {
+            std::atomic<size_t> sequence;
+            QueuedEvent event;
+        };
+
+        // Held by each request's successCallback and errorCallback
+        struct BatchInfo
+        {
+            size_t eventCount;
+            int64_t enqueueMicrosecondsTotal;
+            int64_t oldestEnqueueMicroseconds;
+        };
+
+        struct InFlightRequest
+        {
+            PlayFabRequestHandle handle;
+            size_t eventCount;
+        };
+
+        bool Enqueue(QueuedEvent& event); // swaps the event into a free slot
+        bool Dequeue(QueuedEvent& event);
+        void FlushThread();
+        size_t SendBatch(size_t maxRequests); // returns how many events it sent
+        size_t ReapRequests(); // returns how many are still outstanding
+        static int64_t NowMicroseconds();
+        static void RecordResult(const BatchInfo& batchInfo, bool succeeded);
+        static void OnWriteEventsResult(CallRequestContainer& request);
+
+        static std::atomic<uint64_t> statEventsQueued;
+        static std::atomic<uint64_t> statEventsDropped;
+        static std::atomic<uint64_t> statEventsSent;
+        static std::atomic<uint64_t> statEventsSucceeded;
+        static std::atomic<uint64_t> statEventsFailed;
+        static std::atomic<uint64_t> statBatchesSent;
+        static std::atomic<uint64_t> statLatencyTotalMicroseconds;
+        static std::atomic<uint64_t> statLatencyMaxMicroseconds;
+
+        // Read from PlayFabSettings when the pipeline is created
+        size_t queueMask;
+        size_t batchSize;
+        std::chrono::milliseconds flushInterval;
+        size_t requestsInFlight;
+
+        std::unique_ptr<QueueSlot[]> slots;
+        std::atomic<size_t> enqueuePosition;
+        size_t dequeuePosition; // only the flush thread dequeues
+        std::atomic<size_t> queuedEvents;
+        std::atomic<bool> accepting;
+        std::atomic<size_t> activeProducers; // in Enqueue, counted before they check accepting
+
+        // Callers only take pipelineMutex to wake the flush thread, once per eventBatchSize events
+        std::thread flushThread;
+        std::mutex pipelineMutex;
+        std::condition_variable flushNeeded;
+        bool flushRequested;
+        bool stopRequested;
+        bool abandonRequested;
+        std::chrono::steady_clock::time_point shutdownDeadline;
+        size_t undelivered;
+
+        std::vector<InFlightRequest> inFlightRequests;
+        std::vector<QueuedEvent> batch;
+        uint64_t droppedReported;
+    };
+}
+
+#endif
@@ -3,23 +3,84 @@
 #include <gsdkCommonPch.h>
 
 #include <playfab/PlayFabError.h>
+#include <playfab/PlayFabReadCache.h>
+#include <playfab/PlayFabRetryPolicy.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <map>
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft { namespace Azure { namespace Gaming { class GSDKTests; } } }
 
 namespace PlayFab
 {
     struct CallRequestContainer;
+    class PlayFabHttp;
     typedef void(*RequestCompleteCallback)(CallRequestContainer& reqContainer);
     typedef std::shared_ptr<void> SharedVoidPointer;
 
+    /// <summary>
+    /// Internal state shared by a CallRequestContainer and the PlayFabRequestHandles for it
+    /// </summary>
+    struct PlayFabRequestState
+    {
+        PlayFabHttp* http; // null when a custom IPlayFabHttp made it
+        std::atomic<bool> cancelled;
+        std::atomic<int64_t> deadlineNs; // steady clock, 0 for none
+
+        std::mutex doneMutex;
+        std::condition_variable doneCondition;
+        bool done;
+
+        PlayFabRequestState();
+        void MarkDone();
+    };
+
+    /// <summary>
+    /// Returned by every API call to cancel it, give it a deadline or wait for it (through a custom IPlayFabHttp that
+    /// doesn't override AddRequestWithHandle, it refers to no call and does nothing; one that does makes its own
+    /// PlayFabRequestState, without http, checks cancelled and deadlineNs itself and calls MarkDone). Copies refer to the same call,
+    /// and ignoring the handle changes nothing. A cancelled or expired call fails with HttpStatus "Cancelled" or
+    /// "DeadlineExceeded": if it hasn't been sent it never is, and a transfer in flight is aborted.
+    /// </summary>
+    class PlayFabRequestHandle
+    {
+    public:
+        PlayFabRequestHandle(); // refers to no call
+        explicit PlayFabRequestHandle(std::shared_ptr<PlayFabRequestState> state);
+
+        bool IsValid() const;
+        void Cancel();
+
+        /// <summary>Fails the call if it hasn't completed by then, retries included</summary>
+        void SetDeadline(std::chrono::steady_clock::time_point deadline);
+        void SetTimeout(std::chrono::milliseconds timeout);
+
+        /// <summary>
+        /// Done once the result is ready: its callback has run (threadedCallbacks) or is queued for Update().
+        /// With threadedCallbacks off, don't wait on the thread that calls Update() for the callback itself.
+        /// </summary>
+        bool IsDone() const;
+        bool Wait(std::chrono::milliseconds timeout) const; // false if it's still running after timeout
+
+    private:
+        std::shared_ptr<PlayFabRequestState> state;
+    };
+
     /// <summary>
     /// Internal PlayFabHttp container for each api call
     /// </summary>
     struct CallRequestContainer
     {
-        // I own these objects, I must always destroy them
+        // Borrowed from the worker's handle pool and header cache while the request is in flight
         CURL* curlHandle;
         curl_slist* curlHttpHeaders;
         // I never own this, I can never destroy it
@@ -28,17 +89,53 @@ namespace PlayFab
         bool finished;
         std::string authKey;
         std::string authValue;
+        std::string requestString; // the POST body, which curl doesn't copy
         std::string responseString;
-        Json::Value responseJson = Json::Value::null;
+        Json::Value responseJson = Json::Value::null; // parsed once the response is complete, "data" is moved to errorWrapper.Data
         PlayFabError errorWrapper;
         RequestCompleteCallback internalCallback;
         SharedVoidPointer successCallback;
         ErrorCallback errorCallback;
 
+        // Set by AddRequest and when a worker takes the request off the queue
+        std::chrono::steady_clock::time_point enqueueTime;
+        uint64_t queueWaitMicroseconds;
+        uint64_t traceStartNs; // 0 if tracing was off when the request was started
+        unsigned int retryCount;
+        uint64_t circuitProbe; // PlayFabRetryPolicy's token while this request probes the circuit, otherwise 0
+        std::shared_ptr<PlayFabRequestState> requestState;
+        std::chrono::milliseconds cacheTtl; // from PlayFabSettings when the call was made, 0 if it isn't cached
+        std::string cacheKey; // set while this is the request in flight for a PlayFabReadCache entry
+        bool cachedResult; // answered from PlayFabReadCache, a worker completes it without sending it
+        std::atomic<CallRequestContainer*> nextResult; // links PlayFabHttp's queue of results waiting for Update()
+
         CallRequestContainer();
         ~CallRequestContainer();
     };
 
+    /// <summary>
+    /// Process wide PlayFabHttp counters, to compare compression settings.
+    /// Body sizes are before compression, wire sizes are what was sent or received.
+    /// </summary>
+    struct PlayFabHttpStats
+    {
+        uint64_t requests;
+        uint64_t requestsCompressed;
+        uint64_t requestBodyBytes;
+        uint64_t requestWireBytes;
+        uint64_t responseBodyBytes;
+        uint64_t responseWireBytes;
+        uint64_t serializeMicroseconds;
+        uint64_t compressMicroseconds;
+        uint64_t parseMicroseconds;
+        uint64_t workerCpuMicroseconds; // all CPU time of the worker threads, including TLS and response decompression
+        uint64_t retries;
+        uint64_t failedFast; // not sent while the circuit breaker was open
+        uint64_t cacheHits; // answered from PlayFabReadCache
+        uint64_t cacheMisses; // sent, and their responses cached
+        uint64_t cacheJoined; // waited for an identical request in flight instead of being sent
+    };
+
     /// <summary>
     /// Provides an interface and a static instance for https implementations
     /// </summary>
@@ -50,7 +147,20 @@ namespace PlayFab
         virtual ~IPlayFabHttp();
 
         virtual void AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData) = 0;
+
+        /// <summary>
+        /// AddRequest, returning a handle to the call; the API classes use this. Implementations that don't override it
+        /// send the request with AddRequest and return a handle that refers to no call.
+        /// </summary>
+        virtual PlayFabRequestHandle AddRequestWithHandle(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData);
         virtual size_t Update() = 0;
+
+        /// <summary>
+        /// Runs the callbacks of up to maxResults completed calls, oldest first, stopping early once timeBudget has
+        /// been spent (after at least one). Returns how many results are still waiting.
+        /// Implementations that don't override it call Update() once per result.
+        /// </summary>
+        virtual size_t Update(size_t maxResults, std::chrono::microseconds timeBudget);
     protected:
         static std::unique_ptr<IPlayFabHttp> httpInstance;
     };
@@ -65,21 +175,117 @@ namespace PlayFab
         ~PlayFabHttp() override;
 
         void AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData) override;
+        PlayFabRequestHandle AddRequestWithHandle(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData) override;
         size_t Update() override;
+        size_t Update(size_t maxResults, std::chrono::microseconds timeBudget) override;
+
+        /// <summary>
+        /// For shutdown: waits up to timeout for every queued and in-flight request to complete, then cancels
+        /// whatever is left and waits (at most c_cancelWaitMs) for the cancellations. Returns how many were cancelled.
+        /// Requests added after the timeout, e.g. by other threads, aren't cancelled.
+        /// With threadedCallbacks off, the results still have to be delivered with Update().
+        /// </summary>
+        size_t DrainOrCancel(std::chrono::milliseconds timeout);
+
+        static PlayFabHttpStats GetStats();
+
+        static constexpr int64_t c_cancelWaitMs = 1000;
     private:
+        friend class PlayFabRequestHandle;
+        friend class ::Microsoft::Azure::Gaming::GSDKTests; // creates its own instances to test the results queue
         PlayFabHttp(); // Private constructor, to enforce singleton instance
         PlayFabHttp(const PlayFabHttp& other); // Private copy-constructor, to enforce singleton instance
 
+        // Each worker drives its own curl multi handle, whose connection cache its requests to the same host
+        // reuse (and with HTTP/2, multiplex). The multi handles share only DNS and TLS sessions through curlShare:
+        // libcurl doesn't support a shared connection cache used from several threads at once.
+        struct HttpWorker
+        {
+            std::thread thread;
+            CURLM* curlMulti;
+            std::vector<CURL*> idleHandles;
+            std::unordered_map<std::string, curl_slist*> headerLists; // by auth header, "" for none
+            std::unique_ptr<Json::CharReader> jsonReader; // reused for every response
+            std::unique_ptr<Json::StreamWriter> jsonWriter; // compact, reused for every request
+            std::ostringstream jsonStream;
+            std::vector<CallRequestContainer*> activeRequests;
+            std::multimap<std::chrono::steady_clock::time_point, CallRequestContainer*> retryRequests; // by when to send them again
+        };
+
         static size_t CurlReceiveData(char* buffer, size_t blockSize, size_t blockCount, void* userData);
-        static void ExecuteRequest(CallRequestContainer& reqContainer);
-        void WorkerThread();
+        static void ParseResponse(HttpWorker& worker, CallRequestContainer& reqContainer);
+#ifdef ENABLE_PLAYFAB_GZIP_REQUESTS
+        static bool GzipCompress(const std::string& input, std::string& output);
+#endif
+        static uint64_t GetThreadCpuMicroseconds();
+        static void CurlShareLock(CURL* handle, curl_lock_data data, curl_lock_access access, void* userData);
+        static void CurlShareUnlock(CURL* handle, curl_lock_data data, void* userData);
+        void StartRequest(HttpWorker& worker, CallRequestContainer& reqContainer);
+        void FinishRequest(HttpWorker& worker, CURL* handle, CURLcode result);
+        void FailFast(CallRequestContainer& reqContainer);
+        void CompleteRequest(CallRequestContainer& reqContainer);
+        bool IsAbandoned(const CallRequestContainer& reqContainer, std::chrono::steady_clock::time_point now) const;
+        void AbandonRequest(CallRequestContainer& reqContainer, bool counted);
+        void SweepQueue(std::chrono::steady_clock::time_point now, std::vector<CallRequestContainer*>& abandonedRequests);
+        std::chrono::steady_clock::time_point SweepWorker(HttpWorker& worker, std::chrono::steady_clock::time_point now);
+        void RequestSweep();
+        void WakeWorkers(); // interrupts the workers waiting in curl_multi_poll
+        void QueueRequest(CallRequestContainer* reqContainer);
+        void CompleteCachedRequest(CallRequestContainer& reqContainer);
+        void WorkerThread(HttpWorker& worker);
+        void PushResult(CallRequestContainer& reqContainer);
+        void LinkResult(CallRequestContainer& reqContainer);
+        CallRequestContainer* PopResult();
         static void HandleCallback(CallRequestContainer& reqContainer);
         static void HandleResults(CallRequestContainer& reqContainer);
 
-        std::thread pfHttpWorkerThread;
+        static constexpr int64_t c_maxResponseReserve = 64 * 1024 * 1024; // Content-Length beyond this isn't trusted up front
+        static constexpr int c_pollWithoutWakeupMs = 10; // longest wait of a busy worker with libcurl older than 7.68
+
+        static std::atomic<uint64_t> statRequests;
+        static std::atomic<uint64_t> statRequestsCompressed;
+        static std::atomic<uint64_t> statRequestBodyBytes;
+        static std::atomic<uint64_t> statRequestWireBytes;
+        static std::atomic<uint64_t> statResponseBodyBytes;
+        static std::atomic<uint64_t> statResponseWireBytes;
+        static std::atomic<uint64_t> statSerializeMicroseconds;
+        static std::atomic<uint64_t> statCompressMicroseconds;
+        static std::atomic<uint64_t> statParseMicroseconds;
+        static std::atomic<uint64_t> statWorkerCpuMicroseconds;
+        static std::atomic<uint64_t> statRetries;
+        static std::atomic<uint64_t> statFailedFast;
+        static std::atomic<uint64_t> statCacheHits;
+        static std::atomic<uint64_t> statCacheMisses;
+        static std::atomic<uint64_t> statCacheJoined;
+
+        // PlayFabSettings::httpWorkerThreads workers take requests in the order they were added, while fewer
+        // than PlayFabSettings::maxConcurrentRequests are in flight. Idle workers sleep on requestAvailable,
+        // busy ones in curl_multi_poll, which AddRequest interrupts with curl_multi_wakeup (see WakeWorkers).
+        std::vector<std::unique_ptr<HttpWorker>> pfHttpWorkers;
+        CURLSH* curlShare;
+        std::mutex curlShareMutexes[CURL_LOCK_DATA_LAST];
         std::mutex httpRequestMutex;
+        std::condition_variable requestAvailable;
+        std::condition_variable requestsFinished; // for DrainOrCancel
         bool threadRunning;
-        std::vector<CallRequestContainer*> pendingRequests;
-        std::vector<CallRequestContainer*> pendingResults;
+        size_t activeRequests; // across all workers, including requests waiting to be retried
+        PlayFabRetryPolicy retryPolicy;
+        PlayFabReadCache readCache; // when PlayFabSettings::readCacheEnabled
+        std::deque<CallRequestContainer*> pendingRequests;
+
+        // Completed calls waiting for Update(), when threadedCallbacks is off: an intrusive multi-producer queue
+        // (Vyukov) the workers add to without locking. Update() callers take updateMutex, which nothing else
+        // uses, to take results off one at a time; callbacks run outside it.
+        std::atomic<CallRequestContainer*> resultsHead; // most recently added
+        CallRequestContainer* resultsTail; // next to take, or resultsStub
+        CallRequestContainer resultsStub;
+        std::atomic<size_t> pendingResultCount;
+        std::mutex updateMutex;
+
+        // Cancellations and deadlines: workers check their own requests every time they wake up, and the
+        // queue when a handle asks for it or its earliest deadline has passed
+        bool queueSweepRequested;
+        std::chrono::steady_clock::time_point nextQueueDeadline;
+        std::atomic<int64_t> cancelAddedBeforeNs; // set by DrainOrCancel, steady clock: workers cancel their requests added until then
     };
 }
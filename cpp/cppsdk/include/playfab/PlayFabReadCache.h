@@ -0,0 +1,67 @@
+#pragma once
+
+#include <gsdkCommonPch.h>
+
+#include <playfab/PlayFabError.h>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PlayFab
+{
+    struct CallRequestContainer;
+
+    /// <summary>
+    /// PlayFabHttp's cache of successful read responses, for the APIs listed in PlayFabSettings::readCacheTtlMs.
+    /// Entries are keyed by URL path, auth value and the request JSON (jsoncpp writes object members sorted, so
+    /// equal requests serialize the same), and identical requests made while one is in flight wait for its response
+    /// instead of being sent again.
+    /// </summary>
+    class PlayFabReadCache
+    {
+    public:
+        typedef std::chrono::steady_clock::time_point TimePoint;
+
+        enum class Lookup
+        {
+            Hit,    // the cached response was copied into the request's errorWrapper
+            Joined, // an identical request is in flight, this one was added to its waiters
+            Miss    // this request is now the one in flight for its key
+        };
+
+        /// <summary>By API name, 0 if the API isn't cached</summary>
+        static std::chrono::milliseconds GetTtl(const std::string& urlPath);
+        static std::string MakeKey(const std::string& urlPath, const std::string& authValue, const Json::Value& requestBody);
+
+        Lookup Find(const std::string& key, CallRequestContainer& reqContainer, TimePoint now);
+
+        /// <summary>
+        /// The request in flight for key finished. A successful result is kept for ttl, anything else is forgotten.
+        /// Returns the requests that were waiting for it.
+        /// </summary>
+        std::vector<CallRequestContainer*> Complete(const std::string& key, const PlayFabError& result, std::chrono::milliseconds ttl, TimePoint now);
+
+        /// <summary>Takes every waiting request for which remove returns true out of the cache</summary>
+        void RemoveWaiters(const std::function<bool(CallRequestContainer&)>& remove);
+
+        /// <summary>Copies a response, but not the UrlPath and Request it belongs to</summary>
+        static void CopyResult(const PlayFabError& from, PlayFabError& to);
+
+        static constexpr size_t c_maxEntries = 1024; // beyond this, responses aren't stored until entries expire
+
+    private:
+        struct Entry
+        {
+            bool inFlight;
+            TimePoint expires;
+            PlayFabError result;
+            std::vector<CallRequestContainer*> waiters;
+        };
+
+        std::mutex cacheMutex;
+        std::unordered_map<std::string, Entry> entries;
+    };
+}
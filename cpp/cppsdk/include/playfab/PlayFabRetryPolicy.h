@@ -0,0 +1,91 @@
+#pragma once
+
+#include <gsdkCommonPch.h>
+
+#include <playfab/PlayFabError.h>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+
+namespace PlayFab
+{
+    /// <summary>
+    /// Decides which failed PlayFabHttp requests are retried and when, and fails requests fast
+    /// (a circuit breaker) after PlayFabSettings::circuitBreakerThreshold failures in a row.
+    /// Times are passed in so a stand-in server or a test can drive it without waiting.
+    /// </summary>
+    class PlayFabRetryPolicy
+    {
+    public:
+        typedef std::chrono::steady_clock::time_point TimePoint;
+
+        enum class Outcome
+        {
+            Success,
+            Rejected,    // PlayFab answered with an error that retrying won't fix
+            Throttled,   // 429 or a rate limit error, the request was not processed
+            ServerError, // 5xx, the request may have been processed
+            NotSent,     // DNS, connect or TLS handshake failure, the request never left
+            NoResponse   // timed out or lost the connection after sending, the request may have been processed
+        };
+
+        PlayFabRetryPolicy();
+
+        /// <summary>
+        /// Whether sending the call twice has the same effect as sending it once, by API name:
+        /// reads (Get, List, ...) and absolute writes (Set, Update, Delete, ...) are, Add, Grant, Consume,
+        /// Write...Event and the like are not. Non-idempotent calls are only retried when the server never
+        /// saw them (Throttled or NotSent).
+        /// </summary>
+        static bool IsIdempotent(const std::string& urlPath);
+
+        static Outcome Classify(CURLcode result, long responseCode, const PlayFabError& error);
+
+        /// <summary>Whether to retry after the given outcome, with retryCount retries already made</summary>
+        static bool ShouldRetry(Outcome outcome, const std::string& urlPath, unsigned int retryCount);
+
+        /// <summary>
+        /// Exponential backoff with full jitter, but never less than a Retry-After / retryAfterSeconds
+        /// hint from the server (0 if there was none).
+        /// </summary>
+        std::chrono::milliseconds GetRetryDelay(unsigned int retryCount, std::chrono::milliseconds retryHint);
+
+        /// <summary>
+        /// How long the server asked to back off: the longer of the Retry-After header (headerSeconds, 0 if there
+        /// was none) and retryAfterSeconds in the response body
+        /// </summary>
+        static std::chrono::milliseconds GetRetryHint(int64_t headerSeconds, const Json::Value& responseJson);
+
+        /// <summary>
+        /// False while the circuit is open. Once it has been open for PlayFabSettings::circuitBreakerOpenMs,
+        /// a single request is let through to probe whether PlayFab has recovered: probe is set to a token for it,
+        /// and to 0 for any other request.
+        /// </summary>
+        bool AllowRequest(TimePoint now, uint64_t& probe);
+        void RecordOutcome(Outcome outcome, TimePoint now);
+
+        /// <summary>
+        /// The probe ended without an outcome (cancelled, or past its deadline), so it says nothing about PlayFab:
+        /// the circuit goes back to open, and the next request probes instead.
+        /// </summary>
+        void AbandonProbe(uint64_t probe, TimePoint now);
+
+        static constexpr int64_t c_maxRetryHintMs = 60 * 1000; // longer hints fail the request instead
+
+    private:
+        enum class CircuitState
+        {
+            Closed,
+            Open,
+            Probing
+        };
+
+        std::mutex policyMutex;
+        std::mt19937 random;
+        CircuitState circuitState;
+        unsigned int consecutiveFailures;
+        TimePoint openUntil;
+        uint64_t lastProbe; // token of the latest probe, the one in flight while Probing
+    };
+}
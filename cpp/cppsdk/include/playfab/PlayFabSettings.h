@@ -23,6 +23,44 @@ namespace PlayFab
         // Control whether all callbacks are threaded or whether the user manually controlls callback timing from their main-thread
         static bool threadedCallbacks;
 
+        // Number of threads sending requests, read when the PlayFabHttp instance is created
+        static unsigned int httpWorkerThreads;
+        // Requests in flight at once across all workers, further requests wait in the queue
+        static unsigned int maxConcurrentRequests;
+        // Request bodies of at least this many bytes are sent gzip compressed, 0 never compresses them.
+        // Needs the SDK built with ENABLE_PLAYFAB_GZIP_REQUESTS and linked with zlib, otherwise it is ignored.
+        static unsigned int requestCompressionThreshold;
+        // Send Accept-Encoding so the server may compress responses, which curl decompresses
+        static bool acceptCompressedResponses;
+
+        // Per attempt, in milliseconds
+        static unsigned int requestTimeoutMs;
+        // Failed requests are retried up to maxRetries times, when PlayFabRetryPolicy considers it safe, after a
+        // random delay of up to retryBaseDelayMs * 2^retry (capped at retryMaxDelayMs) or as long as the server asks
+        static unsigned int maxRetries;
+        static unsigned int retryBaseDelayMs;
+        static unsigned int retryMaxDelayMs;
+        // After this many failures in a row requests fail fast for circuitBreakerOpenMs, 0 never does
+        static unsigned int circuitBreakerThreshold;
+        static unsigned int circuitBreakerOpenMs;
+
+        // PlayFabEventPipeline, read when it is created: events it holds (rounded up to a power of two, more are dropped),
+        // events per batch (at most 200), how often a partial batch is sent, and how many requests may be outstanding
+        // (a batch with Event/WriteEvents, otherwise one event each)
+        static unsigned int eventQueueCapacity;
+        static unsigned int eventBatchSize;
+        static unsigned int eventFlushIntervalMs;
+        static unsigned int eventBatchesInFlight;
+        // With entityToken set, PlayFabEventPipeline batches go to Event/WriteEvents in this namespace ("custom.<name>");
+        // empty sends each event with Server/WritePlayerEvent or WriteTitleEvent
+        static std::string eventNamespace;
+
+        // Answer repeated reads from PlayFabHttp's cache: responses of the APIs in readCacheTtlMs are kept for that
+        // many milliseconds, per API name, and identical calls made while one is in flight share its response.
+        // Both are read on the thread making each call, when it is made.
+        static bool readCacheEnabled;
+        static std::map<std::string, unsigned int> readCacheTtlMs;
+
         static std::string entityToken; // This is set by entity GetEntityToken method, and is required by all other Entity API methods
 #if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
         static std::string developerSecretKey; // You must set this value for PlayFabSdk to work properly (Found in the Game Manager for your title, at the PlayFab Website)
@@ -15,6 +15,11 @@ namespace PlayFab
         return PlayFabHttp::Get().Update();
     }
 
+    size_t PlayFabAdminAPI::Update(size_t maxResults, std::chrono::microseconds timeBudget)
+    {
+        return PlayFabHttp::Get().Update(maxResults, timeBudget);
+    }
+
     void PlayFabAdminAPI::ForgetAllCredentials()
     {
         return PlayFabSettings::ForgetAllCredentials();
@@ -22,7 +27,7 @@ namespace PlayFab
 
     // PlayFabAdmin APIs
 
-    void PlayFabAdminAPI::AbortTaskInstance(
+    PlayFabRequestHandle PlayFabAdminAPI::AbortTaskInstance(
         AbortTaskInstanceRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -32,7 +37,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AbortTaskInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAbortTaskInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/AbortTaskInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAbortTaskInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnAbortTaskInstanceResult(CallRequestContainer& request)
@@ -49,7 +54,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::AddNews(
+    PlayFabRequestHandle PlayFabAdminAPI::AddNews(
         AddNewsRequest& request,
         ProcessApiCallback<AddNewsResult> callback,
         ErrorCallback errorCallback,
@@ -59,7 +64,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddNews", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddNewsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddNewsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/AddNews", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddNewsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddNewsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnAddNewsResult(CallRequestContainer& request)
@@ -76,7 +81,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::AddPlayerTag(
+    PlayFabRequestHandle PlayFabAdminAPI::AddPlayerTag(
         AddPlayerTagRequest& request,
         ProcessApiCallback<AddPlayerTagResult> callback,
         ErrorCallback errorCallback,
@@ -86,7 +91,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddPlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddPlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/AddPlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddPlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnAddPlayerTagResult(CallRequestContainer& request)
@@ -103,7 +108,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::AddServerBuild(
+    PlayFabRequestHandle PlayFabAdminAPI::AddServerBuild(
         AddServerBuildRequest& request,
         ProcessApiCallback<AddServerBuildResult> callback,
         ErrorCallback errorCallback,
@@ -113,7 +118,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddServerBuild", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddServerBuildResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddServerBuildResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/AddServerBuild", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddServerBuildResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddServerBuildResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnAddServerBuildResult(CallRequestContainer& request)
@@ -130,7 +135,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::AddUserVirtualCurrency(
+    PlayFabRequestHandle PlayFabAdminAPI::AddUserVirtualCurrency(
         AddUserVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -140,7 +145,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/AddUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnAddUserVirtualCurrencyResult(CallRequestContainer& request)
@@ -157,7 +162,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::AddVirtualCurrencyTypes(
+    PlayFabRequestHandle PlayFabAdminAPI::AddVirtualCurrencyTypes(
         AddVirtualCurrencyTypesRequest& request,
         ProcessApiCallback<BlankResult> callback,
         ErrorCallback errorCallback,
@@ -167,7 +172,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/AddVirtualCurrencyTypes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddVirtualCurrencyTypesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/AddVirtualCurrencyTypes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddVirtualCurrencyTypesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnAddVirtualCurrencyTypesResult(CallRequestContainer& request)
@@ -184,7 +189,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::BanUsers(
+    PlayFabRequestHandle PlayFabAdminAPI::BanUsers(
         BanUsersRequest& request,
         ProcessApiCallback<BanUsersResult> callback,
         ErrorCallback errorCallback,
@@ -194,7 +199,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/BanUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnBanUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/BanUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnBanUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnBanUsersResult(CallRequestContainer& request)
@@ -211,7 +216,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::CheckLimitedEditionItemAvailability(
+    PlayFabRequestHandle PlayFabAdminAPI::CheckLimitedEditionItemAvailability(
         CheckLimitedEditionItemAvailabilityRequest& request,
         ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult> callback,
         ErrorCallback errorCallback,
@@ -221,7 +226,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CheckLimitedEditionItemAvailability", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCheckLimitedEditionItemAvailabilityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/CheckLimitedEditionItemAvailability", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCheckLimitedEditionItemAvailabilityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnCheckLimitedEditionItemAvailabilityResult(CallRequestContainer& request)
@@ -238,7 +243,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(
+    PlayFabRequestHandle PlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(
         CreateActionsOnPlayerSegmentTaskRequest& request,
         ProcessApiCallback<CreateTaskResult> callback,
         ErrorCallback errorCallback,
@@ -248,7 +253,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CreateActionsOnPlayersInSegmentTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreateActionsOnPlayersInSegmentTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/CreateActionsOnPlayersInSegmentTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreateActionsOnPlayersInSegmentTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnCreateActionsOnPlayersInSegmentTaskResult(CallRequestContainer& request)
@@ -265,7 +270,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::CreateCloudScriptTask(
+    PlayFabRequestHandle PlayFabAdminAPI::CreateCloudScriptTask(
         CreateCloudScriptTaskRequest& request,
         ProcessApiCallback<CreateTaskResult> callback,
         ErrorCallback errorCallback,
@@ -275,7 +280,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CreateCloudScriptTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreateCloudScriptTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/CreateCloudScriptTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreateCloudScriptTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnCreateCloudScriptTaskResult(CallRequestContainer& request)
@@ -292,7 +297,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::CreatePlayerSharedSecret(
+    PlayFabRequestHandle PlayFabAdminAPI::CreatePlayerSharedSecret(
         CreatePlayerSharedSecretRequest& request,
         ProcessApiCallback<CreatePlayerSharedSecretResult> callback,
         ErrorCallback errorCallback,
@@ -302,7 +307,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CreatePlayerSharedSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreatePlayerSharedSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerSharedSecretResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/CreatePlayerSharedSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreatePlayerSharedSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerSharedSecretResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnCreatePlayerSharedSecretResult(CallRequestContainer& request)
@@ -319,7 +324,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::CreatePlayerStatisticDefinition(
+    PlayFabRequestHandle PlayFabAdminAPI::CreatePlayerStatisticDefinition(
         CreatePlayerStatisticDefinitionRequest& request,
         ProcessApiCallback<CreatePlayerStatisticDefinitionResult> callback,
         ErrorCallback errorCallback,
@@ -329,7 +334,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/CreatePlayerStatisticDefinition", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreatePlayerStatisticDefinitionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerStatisticDefinitionResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/CreatePlayerStatisticDefinition", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreatePlayerStatisticDefinitionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerStatisticDefinitionResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnCreatePlayerStatisticDefinitionResult(CallRequestContainer& request)
@@ -346,7 +351,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::DeleteContent(
+    PlayFabRequestHandle PlayFabAdminAPI::DeleteContent(
         DeleteContentRequest& request,
         ProcessApiCallback<BlankResult> callback,
         ErrorCallback errorCallback,
@@ -356,7 +361,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeleteContent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteContentResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/DeleteContent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteContentResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnDeleteContentResult(CallRequestContainer& request)
@@ -373,7 +378,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::DeletePlayer(
+    PlayFabRequestHandle PlayFabAdminAPI::DeletePlayer(
         DeletePlayerRequest& request,
         ProcessApiCallback<DeletePlayerResult> callback,
         ErrorCallback errorCallback,
@@ -383,7 +388,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeletePlayer", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeletePlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/DeletePlayer", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeletePlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnDeletePlayerResult(CallRequestContainer& request)
@@ -400,7 +405,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::DeletePlayerSharedSecret(
+    PlayFabRequestHandle PlayFabAdminAPI::DeletePlayerSharedSecret(
         DeletePlayerSharedSecretRequest& request,
         ProcessApiCallback<DeletePlayerSharedSecretResult> callback,
         ErrorCallback errorCallback,
@@ -410,7 +415,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeletePlayerSharedSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeletePlayerSharedSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerSharedSecretResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/DeletePlayerSharedSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeletePlayerSharedSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerSharedSecretResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnDeletePlayerSharedSecretResult(CallRequestContainer& request)
@@ -427,7 +432,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::DeleteStore(
+    PlayFabRequestHandle PlayFabAdminAPI::DeleteStore(
         DeleteStoreRequest& request,
         ProcessApiCallback<DeleteStoreResult> callback,
         ErrorCallback errorCallback,
@@ -437,7 +442,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeleteStore", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteStoreResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteStoreResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/DeleteStore", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteStoreResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteStoreResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnDeleteStoreResult(CallRequestContainer& request)
@@ -454,7 +459,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::DeleteTask(
+    PlayFabRequestHandle PlayFabAdminAPI::DeleteTask(
         DeleteTaskRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -464,7 +469,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeleteTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/DeleteTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnDeleteTaskResult(CallRequestContainer& request)
@@ -481,7 +486,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::DeleteTitle(
+    PlayFabRequestHandle PlayFabAdminAPI::DeleteTitle(
         DeleteTitleRequest& request,
         ProcessApiCallback<DeleteTitleResult> callback,
         ErrorCallback errorCallback,
@@ -491,7 +496,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/DeleteTitle", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteTitleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteTitleResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/DeleteTitle", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteTitleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteTitleResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnDeleteTitleResult(CallRequestContainer& request)
@@ -508,7 +513,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(
+    PlayFabRequestHandle PlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(
         GetTaskInstanceRequest& request,
         ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult> callback,
         ErrorCallback errorCallback,
@@ -518,7 +523,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetActionsOnPlayersInSegmentTaskInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetActionsOnPlayersInSegmentTaskInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetActionsOnPlayersInSegmentTaskInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetActionsOnPlayersInSegmentTaskInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(CallRequestContainer& request)
@@ -535,7 +540,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetAllSegments(
+    PlayFabRequestHandle PlayFabAdminAPI::GetAllSegments(
         GetAllSegmentsRequest& request,
         ProcessApiCallback<GetAllSegmentsResult> callback,
         ErrorCallback errorCallback,
@@ -545,7 +550,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetAllSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetAllSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetAllSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetAllSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetAllSegmentsResult(CallRequestContainer& request)
@@ -562,7 +567,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetCatalogItems(
+    PlayFabRequestHandle PlayFabAdminAPI::GetCatalogItems(
         GetCatalogItemsRequest& request,
         ProcessApiCallback<GetCatalogItemsResult> callback,
         ErrorCallback errorCallback,
@@ -572,7 +577,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetCatalogItemsResult(CallRequestContainer& request)
@@ -589,7 +594,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetCloudScriptRevision(
+    PlayFabRequestHandle PlayFabAdminAPI::GetCloudScriptRevision(
         GetCloudScriptRevisionRequest& request,
         ProcessApiCallback<GetCloudScriptRevisionResult> callback,
         ErrorCallback errorCallback,
@@ -599,7 +604,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetCloudScriptRevision", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCloudScriptRevisionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptRevisionResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetCloudScriptRevision", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCloudScriptRevisionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptRevisionResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetCloudScriptRevisionResult(CallRequestContainer& request)
@@ -616,7 +621,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetCloudScriptTaskInstance(
+    PlayFabRequestHandle PlayFabAdminAPI::GetCloudScriptTaskInstance(
         GetTaskInstanceRequest& request,
         ProcessApiCallback<GetCloudScriptTaskInstanceResult> callback,
         ErrorCallback errorCallback,
@@ -626,7 +631,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetCloudScriptTaskInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCloudScriptTaskInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptTaskInstanceResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetCloudScriptTaskInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCloudScriptTaskInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptTaskInstanceResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetCloudScriptTaskInstanceResult(CallRequestContainer& request)
@@ -643,7 +648,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetCloudScriptVersions(
+    PlayFabRequestHandle PlayFabAdminAPI::GetCloudScriptVersions(
         GetCloudScriptVersionsRequest& request,
         ProcessApiCallback<GetCloudScriptVersionsResult> callback,
         ErrorCallback errorCallback,
@@ -653,7 +658,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetCloudScriptVersions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCloudScriptVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptVersionsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetCloudScriptVersions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCloudScriptVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptVersionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetCloudScriptVersionsResult(CallRequestContainer& request)
@@ -670,7 +675,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetContentList(
+    PlayFabRequestHandle PlayFabAdminAPI::GetContentList(
         GetContentListRequest& request,
         ProcessApiCallback<GetContentListResult> callback,
         ErrorCallback errorCallback,
@@ -680,7 +685,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetContentList", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetContentListResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentListResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetContentList", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetContentListResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentListResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetContentListResult(CallRequestContainer& request)
@@ -697,7 +702,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetContentUploadUrl(
+    PlayFabRequestHandle PlayFabAdminAPI::GetContentUploadUrl(
         GetContentUploadUrlRequest& request,
         ProcessApiCallback<GetContentUploadUrlResult> callback,
         ErrorCallback errorCallback,
@@ -707,7 +712,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetContentUploadUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetContentUploadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentUploadUrlResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetContentUploadUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetContentUploadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentUploadUrlResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetContentUploadUrlResult(CallRequestContainer& request)
@@ -724,7 +729,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetDataReport(
+    PlayFabRequestHandle PlayFabAdminAPI::GetDataReport(
         GetDataReportRequest& request,
         ProcessApiCallback<GetDataReportResult> callback,
         ErrorCallback errorCallback,
@@ -734,7 +739,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetDataReport", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetDataReportResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetDataReportResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetDataReport", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetDataReportResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetDataReportResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetDataReportResult(CallRequestContainer& request)
@@ -751,7 +756,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetMatchmakerGameInfo(
+    PlayFabRequestHandle PlayFabAdminAPI::GetMatchmakerGameInfo(
         GetMatchmakerGameInfoRequest& request,
         ProcessApiCallback<GetMatchmakerGameInfoResult> callback,
         ErrorCallback errorCallback,
@@ -761,7 +766,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetMatchmakerGameInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetMatchmakerGameInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameInfoResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetMatchmakerGameInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetMatchmakerGameInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetMatchmakerGameInfoResult(CallRequestContainer& request)
@@ -778,7 +783,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetMatchmakerGameModes(
+    PlayFabRequestHandle PlayFabAdminAPI::GetMatchmakerGameModes(
         GetMatchmakerGameModesRequest& request,
         ProcessApiCallback<GetMatchmakerGameModesResult> callback,
         ErrorCallback errorCallback,
@@ -788,7 +793,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetMatchmakerGameModes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetMatchmakerGameModesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameModesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetMatchmakerGameModes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetMatchmakerGameModesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameModesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetMatchmakerGameModesResult(CallRequestContainer& request)
@@ -805,7 +810,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPlayerIdFromAuthToken(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPlayerIdFromAuthToken(
         GetPlayerIdFromAuthTokenRequest& request,
         ProcessApiCallback<GetPlayerIdFromAuthTokenResult> callback,
         ErrorCallback errorCallback,
@@ -815,7 +820,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerIdFromAuthToken", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerIdFromAuthTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerIdFromAuthTokenResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPlayerIdFromAuthToken", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerIdFromAuthTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerIdFromAuthTokenResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPlayerIdFromAuthTokenResult(CallRequestContainer& request)
@@ -832,7 +837,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPlayerProfile(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPlayerProfile(
         GetPlayerProfileRequest& request,
         ProcessApiCallback<GetPlayerProfileResult> callback,
         ErrorCallback errorCallback,
@@ -842,7 +847,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerProfile", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPlayerProfile", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPlayerProfileResult(CallRequestContainer& request)
@@ -859,7 +864,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPlayerSegments(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPlayerSegments(
         GetPlayersSegmentsRequest& request,
         ProcessApiCallback<GetPlayerSegmentsResult> callback,
         ErrorCallback errorCallback,
@@ -869,7 +874,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPlayerSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPlayerSegmentsResult(CallRequestContainer& request)
@@ -886,7 +891,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPlayerSharedSecrets(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPlayerSharedSecrets(
         GetPlayerSharedSecretsRequest& request,
         ProcessApiCallback<GetPlayerSharedSecretsResult> callback,
         ErrorCallback errorCallback,
@@ -896,7 +901,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerSharedSecrets", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerSharedSecretsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSharedSecretsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPlayerSharedSecrets", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerSharedSecretsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSharedSecretsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPlayerSharedSecretsResult(CallRequestContainer& request)
@@ -913,7 +918,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPlayersInSegment(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPlayersInSegment(
         GetPlayersInSegmentRequest& request,
         ProcessApiCallback<GetPlayersInSegmentResult> callback,
         ErrorCallback errorCallback,
@@ -923,7 +928,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayersInSegment", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayersInSegmentResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPlayersInSegment", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayersInSegmentResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPlayersInSegmentResult(CallRequestContainer& request)
@@ -940,7 +945,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPlayerStatisticDefinitions(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPlayerStatisticDefinitions(
         GetPlayerStatisticDefinitionsRequest& request,
         ProcessApiCallback<GetPlayerStatisticDefinitionsResult> callback,
         ErrorCallback errorCallback,
@@ -950,7 +955,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerStatisticDefinitions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticDefinitionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticDefinitionsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPlayerStatisticDefinitions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticDefinitionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticDefinitionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPlayerStatisticDefinitionsResult(CallRequestContainer& request)
@@ -967,7 +972,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPlayerStatisticVersions(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPlayerStatisticVersions(
         GetPlayerStatisticVersionsRequest& request,
         ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
         ErrorCallback errorCallback,
@@ -977,7 +982,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerStatisticVersions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPlayerStatisticVersions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPlayerStatisticVersionsResult(CallRequestContainer& request)
@@ -994,7 +999,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPlayerTags(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPlayerTags(
         GetPlayerTagsRequest& request,
         ProcessApiCallback<GetPlayerTagsResult> callback,
         ErrorCallback errorCallback,
@@ -1004,7 +1009,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPlayerTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPlayerTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPlayerTagsResult(CallRequestContainer& request)
@@ -1021,7 +1026,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPolicy(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPolicy(
         GetPolicyRequest& request,
         ProcessApiCallback<GetPolicyResponse> callback,
         ErrorCallback errorCallback,
@@ -1031,7 +1036,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPolicy", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPolicyResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPolicy", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPolicyResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPolicyResult(CallRequestContainer& request)
@@ -1048,7 +1053,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetPublisherData(
+    PlayFabRequestHandle PlayFabAdminAPI::GetPublisherData(
         GetPublisherDataRequest& request,
         ProcessApiCallback<GetPublisherDataResult> callback,
         ErrorCallback errorCallback,
@@ -1058,7 +1063,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetPublisherDataResult(CallRequestContainer& request)
@@ -1075,7 +1080,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetRandomResultTables(
+    PlayFabRequestHandle PlayFabAdminAPI::GetRandomResultTables(
         GetRandomResultTablesRequest& request,
         ProcessApiCallback<GetRandomResultTablesResult> callback,
         ErrorCallback errorCallback,
@@ -1085,7 +1090,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetRandomResultTables", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetRandomResultTablesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetRandomResultTables", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetRandomResultTablesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetRandomResultTablesResult(CallRequestContainer& request)
@@ -1102,7 +1107,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetServerBuildInfo(
+    PlayFabRequestHandle PlayFabAdminAPI::GetServerBuildInfo(
         GetServerBuildInfoRequest& request,
         ProcessApiCallback<GetServerBuildInfoResult> callback,
         ErrorCallback errorCallback,
@@ -1112,7 +1117,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetServerBuildInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetServerBuildInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildInfoResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetServerBuildInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetServerBuildInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetServerBuildInfoResult(CallRequestContainer& request)
@@ -1129,7 +1134,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetServerBuildUploadUrl(
+    PlayFabRequestHandle PlayFabAdminAPI::GetServerBuildUploadUrl(
         GetServerBuildUploadURLRequest& request,
         ProcessApiCallback<GetServerBuildUploadURLResult> callback,
         ErrorCallback errorCallback,
@@ -1139,7 +1144,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetServerBuildUploadUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetServerBuildUploadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildUploadURLResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetServerBuildUploadUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetServerBuildUploadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildUploadURLResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetServerBuildUploadUrlResult(CallRequestContainer& request)
@@ -1156,7 +1161,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetStoreItems(
+    PlayFabRequestHandle PlayFabAdminAPI::GetStoreItems(
         GetStoreItemsRequest& request,
         ProcessApiCallback<GetStoreItemsResult> callback,
         ErrorCallback errorCallback,
@@ -1166,7 +1171,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetStoreItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetStoreItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetStoreItemsResult(CallRequestContainer& request)
@@ -1183,7 +1188,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetTaskInstances(
+    PlayFabRequestHandle PlayFabAdminAPI::GetTaskInstances(
         GetTaskInstancesRequest& request,
         ProcessApiCallback<GetTaskInstancesResult> callback,
         ErrorCallback errorCallback,
@@ -1193,7 +1198,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetTaskInstances", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTaskInstancesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTaskInstancesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetTaskInstances", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTaskInstancesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTaskInstancesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetTaskInstancesResult(CallRequestContainer& request)
@@ -1210,7 +1215,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetTasks(
+    PlayFabRequestHandle PlayFabAdminAPI::GetTasks(
         GetTasksRequest& request,
         ProcessApiCallback<GetTasksResult> callback,
         ErrorCallback errorCallback,
@@ -1220,7 +1225,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetTasks", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTasksResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTasksResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetTasks", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTasksResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTasksResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetTasksResult(CallRequestContainer& request)
@@ -1237,7 +1242,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetTitleData(
+    PlayFabRequestHandle PlayFabAdminAPI::GetTitleData(
         GetTitleDataRequest& request,
         ProcessApiCallback<GetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -1247,7 +1252,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetTitleDataResult(CallRequestContainer& request)
@@ -1264,7 +1269,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetTitleInternalData(
+    PlayFabRequestHandle PlayFabAdminAPI::GetTitleInternalData(
         GetTitleDataRequest& request,
         ProcessApiCallback<GetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -1274,7 +1279,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetTitleInternalDataResult(CallRequestContainer& request)
@@ -1291,7 +1296,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetUserAccountInfo(
+    PlayFabRequestHandle PlayFabAdminAPI::GetUserAccountInfo(
         LookupUserAccountInfoRequest& request,
         ProcessApiCallback<LookupUserAccountInfoResult> callback,
         ErrorCallback errorCallback,
@@ -1301,7 +1306,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserAccountInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserAccountInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LookupUserAccountInfoResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetUserAccountInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserAccountInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LookupUserAccountInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetUserAccountInfoResult(CallRequestContainer& request)
@@ -1318,7 +1323,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetUserBans(
+    PlayFabRequestHandle PlayFabAdminAPI::GetUserBans(
         GetUserBansRequest& request,
         ProcessApiCallback<GetUserBansResult> callback,
         ErrorCallback errorCallback,
@@ -1328,7 +1333,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetUserBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetUserBansResult(CallRequestContainer& request)
@@ -1345,7 +1350,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetUserData(
+    PlayFabRequestHandle PlayFabAdminAPI::GetUserData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1355,7 +1360,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetUserDataResult(CallRequestContainer& request)
@@ -1372,7 +1377,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetUserInternalData(
+    PlayFabRequestHandle PlayFabAdminAPI::GetUserInternalData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1382,7 +1387,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetUserInternalDataResult(CallRequestContainer& request)
@@ -1399,7 +1404,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetUserInventory(
+    PlayFabRequestHandle PlayFabAdminAPI::GetUserInventory(
         GetUserInventoryRequest& request,
         ProcessApiCallback<GetUserInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -1409,7 +1414,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserInventory", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetUserInventory", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetUserInventoryResult(CallRequestContainer& request)
@@ -1426,7 +1431,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetUserPublisherData(
+    PlayFabRequestHandle PlayFabAdminAPI::GetUserPublisherData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1436,7 +1441,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetUserPublisherDataResult(CallRequestContainer& request)
@@ -1453,7 +1458,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetUserPublisherInternalData(
+    PlayFabRequestHandle PlayFabAdminAPI::GetUserPublisherInternalData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1463,7 +1468,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetUserPublisherInternalDataResult(CallRequestContainer& request)
@@ -1480,7 +1485,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetUserPublisherReadOnlyData(
+    PlayFabRequestHandle PlayFabAdminAPI::GetUserPublisherReadOnlyData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1490,7 +1495,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetUserPublisherReadOnlyDataResult(CallRequestContainer& request)
@@ -1507,7 +1512,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GetUserReadOnlyData(
+    PlayFabRequestHandle PlayFabAdminAPI::GetUserReadOnlyData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1517,7 +1522,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GetUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GetUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGetUserReadOnlyDataResult(CallRequestContainer& request)
@@ -1534,7 +1539,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::GrantItemsToUsers(
+    PlayFabRequestHandle PlayFabAdminAPI::GrantItemsToUsers(
         GrantItemsToUsersRequest& request,
         ProcessApiCallback<GrantItemsToUsersResult> callback,
         ErrorCallback errorCallback,
@@ -1544,7 +1549,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/GrantItemsToUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/GrantItemsToUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnGrantItemsToUsersResult(CallRequestContainer& request)
@@ -1561,7 +1566,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::IncrementLimitedEditionItemAvailability(
+    PlayFabRequestHandle PlayFabAdminAPI::IncrementLimitedEditionItemAvailability(
         IncrementLimitedEditionItemAvailabilityRequest& request,
         ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult> callback,
         ErrorCallback errorCallback,
@@ -1571,7 +1576,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/IncrementLimitedEditionItemAvailability", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnIncrementLimitedEditionItemAvailabilityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/IncrementLimitedEditionItemAvailability", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnIncrementLimitedEditionItemAvailabilityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnIncrementLimitedEditionItemAvailabilityResult(CallRequestContainer& request)
@@ -1588,7 +1593,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::IncrementPlayerStatisticVersion(
+    PlayFabRequestHandle PlayFabAdminAPI::IncrementPlayerStatisticVersion(
         IncrementPlayerStatisticVersionRequest& request,
         ProcessApiCallback<IncrementPlayerStatisticVersionResult> callback,
         ErrorCallback errorCallback,
@@ -1598,7 +1603,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/IncrementPlayerStatisticVersion", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnIncrementPlayerStatisticVersionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementPlayerStatisticVersionResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/IncrementPlayerStatisticVersion", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnIncrementPlayerStatisticVersionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementPlayerStatisticVersionResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnIncrementPlayerStatisticVersionResult(CallRequestContainer& request)
@@ -1615,7 +1620,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::ListServerBuilds(
+    PlayFabRequestHandle PlayFabAdminAPI::ListServerBuilds(
         ListBuildsRequest& request,
         ProcessApiCallback<ListBuildsResult> callback,
         ErrorCallback errorCallback,
@@ -1625,7 +1630,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ListServerBuilds", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnListServerBuildsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListBuildsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/ListServerBuilds", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnListServerBuildsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListBuildsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnListServerBuildsResult(CallRequestContainer& request)
@@ -1642,7 +1647,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::ListVirtualCurrencyTypes(
+    PlayFabRequestHandle PlayFabAdminAPI::ListVirtualCurrencyTypes(
         ListVirtualCurrencyTypesRequest& request,
         ProcessApiCallback<ListVirtualCurrencyTypesResult> callback,
         ErrorCallback errorCallback,
@@ -1652,7 +1657,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ListVirtualCurrencyTypes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnListVirtualCurrencyTypesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListVirtualCurrencyTypesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/ListVirtualCurrencyTypes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnListVirtualCurrencyTypesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListVirtualCurrencyTypesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnListVirtualCurrencyTypesResult(CallRequestContainer& request)
@@ -1669,7 +1674,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::ModifyMatchmakerGameModes(
+    PlayFabRequestHandle PlayFabAdminAPI::ModifyMatchmakerGameModes(
         ModifyMatchmakerGameModesRequest& request,
         ProcessApiCallback<ModifyMatchmakerGameModesResult> callback,
         ErrorCallback errorCallback,
@@ -1679,7 +1684,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ModifyMatchmakerGameModes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnModifyMatchmakerGameModesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyMatchmakerGameModesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/ModifyMatchmakerGameModes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnModifyMatchmakerGameModesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyMatchmakerGameModesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnModifyMatchmakerGameModesResult(CallRequestContainer& request)
@@ -1696,7 +1701,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::ModifyServerBuild(
+    PlayFabRequestHandle PlayFabAdminAPI::ModifyServerBuild(
         ModifyServerBuildRequest& request,
         ProcessApiCallback<ModifyServerBuildResult> callback,
         ErrorCallback errorCallback,
@@ -1706,7 +1711,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ModifyServerBuild", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnModifyServerBuildResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyServerBuildResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/ModifyServerBuild", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnModifyServerBuildResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyServerBuildResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnModifyServerBuildResult(CallRequestContainer& request)
@@ -1723,7 +1728,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::RefundPurchase(
+    PlayFabRequestHandle PlayFabAdminAPI::RefundPurchase(
         RefundPurchaseRequest& request,
         ProcessApiCallback<RefundPurchaseResponse> callback,
         ErrorCallback errorCallback,
@@ -1733,7 +1738,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RefundPurchase", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRefundPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RefundPurchaseResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/RefundPurchase", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRefundPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RefundPurchaseResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnRefundPurchaseResult(CallRequestContainer& request)
@@ -1750,7 +1755,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::RemovePlayerTag(
+    PlayFabRequestHandle PlayFabAdminAPI::RemovePlayerTag(
         RemovePlayerTagRequest& request,
         ProcessApiCallback<RemovePlayerTagResult> callback,
         ErrorCallback errorCallback,
@@ -1760,7 +1765,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RemovePlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemovePlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/RemovePlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemovePlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnRemovePlayerTagResult(CallRequestContainer& request)
@@ -1777,7 +1782,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::RemoveServerBuild(
+    PlayFabRequestHandle PlayFabAdminAPI::RemoveServerBuild(
         RemoveServerBuildRequest& request,
         ProcessApiCallback<RemoveServerBuildResult> callback,
         ErrorCallback errorCallback,
@@ -1787,7 +1792,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RemoveServerBuild", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveServerBuildResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveServerBuildResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/RemoveServerBuild", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveServerBuildResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveServerBuildResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnRemoveServerBuildResult(CallRequestContainer& request)
@@ -1804,7 +1809,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::RemoveVirtualCurrencyTypes(
+    PlayFabRequestHandle PlayFabAdminAPI::RemoveVirtualCurrencyTypes(
         RemoveVirtualCurrencyTypesRequest& request,
         ProcessApiCallback<BlankResult> callback,
         ErrorCallback errorCallback,
@@ -1814,7 +1819,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RemoveVirtualCurrencyTypes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveVirtualCurrencyTypesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/RemoveVirtualCurrencyTypes", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveVirtualCurrencyTypesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnRemoveVirtualCurrencyTypesResult(CallRequestContainer& request)
@@ -1831,7 +1836,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::ResetCharacterStatistics(
+    PlayFabRequestHandle PlayFabAdminAPI::ResetCharacterStatistics(
         ResetCharacterStatisticsRequest& request,
         ProcessApiCallback<ResetCharacterStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -1841,7 +1846,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ResetCharacterStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResetCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetCharacterStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/ResetCharacterStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResetCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnResetCharacterStatisticsResult(CallRequestContainer& request)
@@ -1858,7 +1863,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::ResetPassword(
+    PlayFabRequestHandle PlayFabAdminAPI::ResetPassword(
         ResetPasswordRequest& request,
         ProcessApiCallback<ResetPasswordResult> callback,
         ErrorCallback errorCallback,
@@ -1868,7 +1873,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ResetPassword", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResetPasswordResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetPasswordResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/ResetPassword", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResetPasswordResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetPasswordResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnResetPasswordResult(CallRequestContainer& request)
@@ -1885,7 +1890,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::ResetUserStatistics(
+    PlayFabRequestHandle PlayFabAdminAPI::ResetUserStatistics(
         ResetUserStatisticsRequest& request,
         ProcessApiCallback<ResetUserStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -1895,7 +1900,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ResetUserStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResetUserStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetUserStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/ResetUserStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResetUserStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetUserStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnResetUserStatisticsResult(CallRequestContainer& request)
@@ -1912,7 +1917,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::ResolvePurchaseDispute(
+    PlayFabRequestHandle PlayFabAdminAPI::ResolvePurchaseDispute(
         ResolvePurchaseDisputeRequest& request,
         ProcessApiCallback<ResolvePurchaseDisputeResponse> callback,
         ErrorCallback errorCallback,
@@ -1922,7 +1927,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/ResolvePurchaseDispute", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResolvePurchaseDisputeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResolvePurchaseDisputeResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/ResolvePurchaseDispute", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnResolvePurchaseDisputeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ResolvePurchaseDisputeResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnResolvePurchaseDisputeResult(CallRequestContainer& request)
@@ -1939,7 +1944,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::RevokeAllBansForUser(
+    PlayFabRequestHandle PlayFabAdminAPI::RevokeAllBansForUser(
         RevokeAllBansForUserRequest& request,
         ProcessApiCallback<RevokeAllBansForUserResult> callback,
         ErrorCallback errorCallback,
@@ -1949,7 +1954,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RevokeAllBansForUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeAllBansForUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/RevokeAllBansForUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeAllBansForUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnRevokeAllBansForUserResult(CallRequestContainer& request)
@@ -1966,7 +1971,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::RevokeBans(
+    PlayFabRequestHandle PlayFabAdminAPI::RevokeBans(
         RevokeBansRequest& request,
         ProcessApiCallback<RevokeBansResult> callback,
         ErrorCallback errorCallback,
@@ -1976,7 +1981,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RevokeBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/RevokeBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnRevokeBansResult(CallRequestContainer& request)
@@ -1993,7 +1998,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::RevokeInventoryItem(
+    PlayFabRequestHandle PlayFabAdminAPI::RevokeInventoryItem(
         RevokeInventoryItemRequest& request,
         ProcessApiCallback<RevokeInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -2003,7 +2008,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RevokeInventoryItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/RevokeInventoryItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnRevokeInventoryItemResult(CallRequestContainer& request)
@@ -2020,7 +2025,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::RevokeInventoryItems(
+    PlayFabRequestHandle PlayFabAdminAPI::RevokeInventoryItems(
         RevokeInventoryItemsRequest& request,
         ProcessApiCallback<RevokeInventoryItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2030,7 +2035,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RevokeInventoryItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/RevokeInventoryItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnRevokeInventoryItemsResult(CallRequestContainer& request)
@@ -2047,7 +2052,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::RunTask(
+    PlayFabRequestHandle PlayFabAdminAPI::RunTask(
         RunTaskRequest& request,
         ProcessApiCallback<RunTaskResult> callback,
         ErrorCallback errorCallback,
@@ -2057,7 +2062,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/RunTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRunTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RunTaskResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/RunTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRunTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RunTaskResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnRunTaskResult(CallRequestContainer& request)
@@ -2074,7 +2079,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SendAccountRecoveryEmail(
+    PlayFabRequestHandle PlayFabAdminAPI::SendAccountRecoveryEmail(
         SendAccountRecoveryEmailRequest& request,
         ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
         ErrorCallback errorCallback,
@@ -2084,7 +2089,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SendAccountRecoveryEmail", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendAccountRecoveryEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SendAccountRecoveryEmail", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendAccountRecoveryEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSendAccountRecoveryEmailResult(CallRequestContainer& request)
@@ -2101,7 +2106,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SetCatalogItems(
+    PlayFabRequestHandle PlayFabAdminAPI::SetCatalogItems(
         UpdateCatalogItemsRequest& request,
         ProcessApiCallback<UpdateCatalogItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2111,7 +2116,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SetCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSetCatalogItemsResult(CallRequestContainer& request)
@@ -2128,7 +2133,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SetPlayerSecret(
+    PlayFabRequestHandle PlayFabAdminAPI::SetPlayerSecret(
         SetPlayerSecretRequest& request,
         ProcessApiCallback<SetPlayerSecretResult> callback,
         ErrorCallback errorCallback,
@@ -2138,7 +2143,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetPlayerSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPlayerSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SetPlayerSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPlayerSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSetPlayerSecretResult(CallRequestContainer& request)
@@ -2155,7 +2160,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SetPublishedRevision(
+    PlayFabRequestHandle PlayFabAdminAPI::SetPublishedRevision(
         SetPublishedRevisionRequest& request,
         ProcessApiCallback<SetPublishedRevisionResult> callback,
         ErrorCallback errorCallback,
@@ -2165,7 +2170,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetPublishedRevision", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPublishedRevisionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublishedRevisionResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SetPublishedRevision", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPublishedRevisionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublishedRevisionResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSetPublishedRevisionResult(CallRequestContainer& request)
@@ -2182,7 +2187,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SetPublisherData(
+    PlayFabRequestHandle PlayFabAdminAPI::SetPublisherData(
         SetPublisherDataRequest& request,
         ProcessApiCallback<SetPublisherDataResult> callback,
         ErrorCallback errorCallback,
@@ -2192,7 +2197,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSetPublisherDataResult(CallRequestContainer& request)
@@ -2209,7 +2214,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SetStoreItems(
+    PlayFabRequestHandle PlayFabAdminAPI::SetStoreItems(
         UpdateStoreItemsRequest& request,
         ProcessApiCallback<UpdateStoreItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2219,7 +2224,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetStoreItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SetStoreItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSetStoreItemsResult(CallRequestContainer& request)
@@ -2236,7 +2241,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SetTitleData(
+    PlayFabRequestHandle PlayFabAdminAPI::SetTitleData(
         SetTitleDataRequest& request,
         ProcessApiCallback<SetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -2246,7 +2251,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSetTitleDataResult(CallRequestContainer& request)
@@ -2263,7 +2268,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SetTitleInternalData(
+    PlayFabRequestHandle PlayFabAdminAPI::SetTitleInternalData(
         SetTitleDataRequest& request,
         ProcessApiCallback<SetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -2273,7 +2278,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSetTitleInternalDataResult(CallRequestContainer& request)
@@ -2290,7 +2295,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SetupPushNotification(
+    PlayFabRequestHandle PlayFabAdminAPI::SetupPushNotification(
         SetupPushNotificationRequest& request,
         ProcessApiCallback<SetupPushNotificationResult> callback,
         ErrorCallback errorCallback,
@@ -2300,7 +2305,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SetupPushNotification", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetupPushNotificationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetupPushNotificationResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SetupPushNotification", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetupPushNotificationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetupPushNotificationResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSetupPushNotificationResult(CallRequestContainer& request)
@@ -2317,7 +2322,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::SubtractUserVirtualCurrency(
+    PlayFabRequestHandle PlayFabAdminAPI::SubtractUserVirtualCurrency(
         SubtractUserVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -2327,7 +2332,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/SubtractUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSubtractUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/SubtractUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSubtractUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnSubtractUserVirtualCurrencyResult(CallRequestContainer& request)
@@ -2344,7 +2349,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateBans(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateBans(
         UpdateBansRequest& request,
         ProcessApiCallback<UpdateBansResult> callback,
         ErrorCallback errorCallback,
@@ -2354,7 +2359,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateBansResult(CallRequestContainer& request)
@@ -2371,7 +2376,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateCatalogItems(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateCatalogItems(
         UpdateCatalogItemsRequest& request,
         ProcessApiCallback<UpdateCatalogItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2381,7 +2386,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateCatalogItemsResult(CallRequestContainer& request)
@@ -2398,7 +2403,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateCloudScript(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateCloudScript(
         UpdateCloudScriptRequest& request,
         ProcessApiCallback<UpdateCloudScriptResult> callback,
         ErrorCallback errorCallback,
@@ -2408,7 +2413,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateCloudScript", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCloudScriptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCloudScriptResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateCloudScript", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCloudScriptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCloudScriptResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateCloudScriptResult(CallRequestContainer& request)
@@ -2425,7 +2430,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdatePlayerSharedSecret(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdatePlayerSharedSecret(
         UpdatePlayerSharedSecretRequest& request,
         ProcessApiCallback<UpdatePlayerSharedSecretResult> callback,
         ErrorCallback errorCallback,
@@ -2435,7 +2440,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdatePlayerSharedSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePlayerSharedSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerSharedSecretResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdatePlayerSharedSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePlayerSharedSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerSharedSecretResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdatePlayerSharedSecretResult(CallRequestContainer& request)
@@ -2452,7 +2457,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdatePlayerStatisticDefinition(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdatePlayerStatisticDefinition(
         UpdatePlayerStatisticDefinitionRequest& request,
         ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> callback,
         ErrorCallback errorCallback,
@@ -2462,7 +2467,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdatePlayerStatisticDefinition", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePlayerStatisticDefinitionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticDefinitionResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdatePlayerStatisticDefinition", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePlayerStatisticDefinitionResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticDefinitionResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdatePlayerStatisticDefinitionResult(CallRequestContainer& request)
@@ -2479,7 +2484,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdatePolicy(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdatePolicy(
         UpdatePolicyRequest& request,
         ProcessApiCallback<UpdatePolicyResponse> callback,
         ErrorCallback errorCallback,
@@ -2489,7 +2494,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdatePolicy", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePolicyResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdatePolicy", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePolicyResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdatePolicyResult(CallRequestContainer& request)
@@ -2506,7 +2511,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateRandomResultTables(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateRandomResultTables(
         UpdateRandomResultTablesRequest& request,
         ProcessApiCallback<UpdateRandomResultTablesResult> callback,
         ErrorCallback errorCallback,
@@ -2516,7 +2521,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateRandomResultTables", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateRandomResultTablesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateRandomResultTablesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateRandomResultTables", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateRandomResultTablesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateRandomResultTablesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateRandomResultTablesResult(CallRequestContainer& request)
@@ -2533,7 +2538,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateStoreItems(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateStoreItems(
         UpdateStoreItemsRequest& request,
         ProcessApiCallback<UpdateStoreItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2543,7 +2548,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateStoreItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateStoreItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateStoreItemsResult(CallRequestContainer& request)
@@ -2560,7 +2565,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateTask(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateTask(
         UpdateTaskRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -2570,7 +2575,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateTask", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateTaskResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateTaskResult(CallRequestContainer& request)
@@ -2587,7 +2592,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateUserData(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateUserData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2597,7 +2602,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateUserDataResult(CallRequestContainer& request)
@@ -2614,7 +2619,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateUserInternalData(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateUserInternalData(
         UpdateUserInternalDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2624,7 +2629,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateUserInternalDataResult(CallRequestContainer& request)
@@ -2641,7 +2646,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateUserPublisherData(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateUserPublisherData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2651,7 +2656,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateUserPublisherDataResult(CallRequestContainer& request)
@@ -2668,7 +2673,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateUserPublisherInternalData(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateUserPublisherInternalData(
         UpdateUserInternalDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2678,7 +2683,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateUserPublisherInternalDataResult(CallRequestContainer& request)
@@ -2695,7 +2700,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateUserPublisherReadOnlyData(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateUserPublisherReadOnlyData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2705,7 +2710,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateUserPublisherReadOnlyDataResult(CallRequestContainer& request)
@@ -2722,7 +2727,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateUserReadOnlyData(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateUserReadOnlyData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2732,7 +2737,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateUserReadOnlyDataResult(CallRequestContainer& request)
@@ -2749,7 +2754,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabAdminAPI::UpdateUserTitleDisplayName(
+    PlayFabRequestHandle PlayFabAdminAPI::UpdateUserTitleDisplayName(
         UpdateUserTitleDisplayNameRequest& request,
         ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
         ErrorCallback errorCallback,
@@ -2759,7 +2764,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Admin/UpdateUserTitleDisplayName", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserTitleDisplayNameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Admin/UpdateUserTitleDisplayName", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserTitleDisplayNameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabAdminAPI::OnUpdateUserTitleDisplayNameResult(CallRequestContainer& request)
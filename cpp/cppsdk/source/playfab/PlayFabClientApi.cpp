@@ -15,6 +15,11 @@ namespace PlayFab
         return PlayFabHttp::Get().Update();
     }
 
+    size_t PlayFabClientAPI::Update(size_t maxResults, std::chrono::microseconds timeBudget)
+    {
+        return PlayFabHttp::Get().Update(maxResults, timeBudget);
+    }
+
     void PlayFabClientAPI::ForgetAllCredentials()
     {
         return PlayFabSettings::ForgetAllCredentials();
@@ -22,7 +27,7 @@ namespace PlayFab
 
     // PlayFabClient APIs
 
-    void PlayFabClientAPI::AcceptTrade(
+    PlayFabRequestHandle PlayFabClientAPI::AcceptTrade(
         AcceptTradeRequest& request,
         ProcessApiCallback<AcceptTradeResponse> callback,
         ErrorCallback errorCallback,
@@ -32,7 +37,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AcceptTrade", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAcceptTradeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AcceptTradeResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/AcceptTrade", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAcceptTradeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AcceptTradeResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnAcceptTradeResult(CallRequestContainer& request)
@@ -49,7 +54,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::AddFriend(
+    PlayFabRequestHandle PlayFabClientAPI::AddFriend(
         AddFriendRequest& request,
         ProcessApiCallback<AddFriendResult> callback,
         ErrorCallback errorCallback,
@@ -59,7 +64,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddFriend", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddFriendResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/AddFriend", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddFriendResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnAddFriendResult(CallRequestContainer& request)
@@ -76,7 +81,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::AddGenericID(
+    PlayFabRequestHandle PlayFabClientAPI::AddGenericID(
         AddGenericIDRequest& request,
         ProcessApiCallback<AddGenericIDResult> callback,
         ErrorCallback errorCallback,
@@ -86,7 +91,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddGenericID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddGenericIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddGenericIDResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/AddGenericID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddGenericIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddGenericIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnAddGenericIDResult(CallRequestContainer& request)
@@ -103,7 +108,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::AddOrUpdateContactEmail(
+    PlayFabRequestHandle PlayFabClientAPI::AddOrUpdateContactEmail(
         AddOrUpdateContactEmailRequest& request,
         ProcessApiCallback<AddOrUpdateContactEmailResult> callback,
         ErrorCallback errorCallback,
@@ -113,7 +118,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddOrUpdateContactEmail", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddOrUpdateContactEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddOrUpdateContactEmailResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/AddOrUpdateContactEmail", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddOrUpdateContactEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddOrUpdateContactEmailResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnAddOrUpdateContactEmailResult(CallRequestContainer& request)
@@ -130,7 +135,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::AddSharedGroupMembers(
+    PlayFabRequestHandle PlayFabClientAPI::AddSharedGroupMembers(
         AddSharedGroupMembersRequest& request,
         ProcessApiCallback<AddSharedGroupMembersResult> callback,
         ErrorCallback errorCallback,
@@ -140,7 +145,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddSharedGroupMembers", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddSharedGroupMembersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/AddSharedGroupMembers", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddSharedGroupMembersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnAddSharedGroupMembersResult(CallRequestContainer& request)
@@ -157,7 +162,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::AddUsernamePassword(
+    PlayFabRequestHandle PlayFabClientAPI::AddUsernamePassword(
         AddUsernamePasswordRequest& request,
         ProcessApiCallback<AddUsernamePasswordResult> callback,
         ErrorCallback errorCallback,
@@ -167,7 +172,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddUsernamePassword", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddUsernamePasswordResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddUsernamePasswordResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/AddUsernamePassword", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddUsernamePasswordResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddUsernamePasswordResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnAddUsernamePasswordResult(CallRequestContainer& request)
@@ -184,7 +189,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::AddUserVirtualCurrency(
+    PlayFabRequestHandle PlayFabClientAPI::AddUserVirtualCurrency(
         AddUserVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -194,7 +199,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AddUserVirtualCurrency", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/AddUserVirtualCurrency", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAddUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnAddUserVirtualCurrencyResult(CallRequestContainer& request)
@@ -211,7 +216,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::AndroidDevicePushNotificationRegistration(
+    PlayFabRequestHandle PlayFabClientAPI::AndroidDevicePushNotificationRegistration(
         AndroidDevicePushNotificationRegistrationRequest& request,
         ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult> callback,
         ErrorCallback errorCallback,
@@ -221,7 +226,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AndroidDevicePushNotificationRegistration", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAndroidDevicePushNotificationRegistrationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/AndroidDevicePushNotificationRegistration", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAndroidDevicePushNotificationRegistrationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult(CallRequestContainer& request)
@@ -238,7 +243,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::AttributeInstall(
+    PlayFabRequestHandle PlayFabClientAPI::AttributeInstall(
         AttributeInstallRequest& request,
         ProcessApiCallback<AttributeInstallResult> callback,
         ErrorCallback errorCallback,
@@ -248,7 +253,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/AttributeInstall", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAttributeInstallResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AttributeInstallResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/AttributeInstall", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnAttributeInstallResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AttributeInstallResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnAttributeInstallResult(CallRequestContainer& request)
@@ -266,7 +271,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::CancelTrade(
+    PlayFabRequestHandle PlayFabClientAPI::CancelTrade(
         CancelTradeRequest& request,
         ProcessApiCallback<CancelTradeResponse> callback,
         ErrorCallback errorCallback,
@@ -276,7 +281,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/CancelTrade", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnCancelTradeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CancelTradeResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/CancelTrade", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnCancelTradeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CancelTradeResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnCancelTradeResult(CallRequestContainer& request)
@@ -293,7 +298,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::ConfirmPurchase(
+    PlayFabRequestHandle PlayFabClientAPI::ConfirmPurchase(
         ConfirmPurchaseRequest& request,
         ProcessApiCallback<ConfirmPurchaseResult> callback,
         ErrorCallback errorCallback,
@@ -303,7 +308,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ConfirmPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnConfirmPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConfirmPurchaseResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/ConfirmPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnConfirmPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConfirmPurchaseResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnConfirmPurchaseResult(CallRequestContainer& request)
@@ -320,7 +325,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::ConsumeItem(
+    PlayFabRequestHandle PlayFabClientAPI::ConsumeItem(
         ConsumeItemRequest& request,
         ProcessApiCallback<ConsumeItemResult> callback,
         ErrorCallback errorCallback,
@@ -330,7 +335,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ConsumeItem", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnConsumeItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeItemResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/ConsumeItem", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnConsumeItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnConsumeItemResult(CallRequestContainer& request)
@@ -347,7 +352,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::CreateSharedGroup(
+    PlayFabRequestHandle PlayFabClientAPI::CreateSharedGroup(
         CreateSharedGroupRequest& request,
         ProcessApiCallback<CreateSharedGroupResult> callback,
         ErrorCallback errorCallback,
@@ -357,7 +362,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/CreateSharedGroup", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnCreateSharedGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSharedGroupResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/CreateSharedGroup", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnCreateSharedGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSharedGroupResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnCreateSharedGroupResult(CallRequestContainer& request)
@@ -374,7 +379,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::ExecuteCloudScript(
+    PlayFabRequestHandle PlayFabClientAPI::ExecuteCloudScript(
         ExecuteCloudScriptRequest& request,
         ProcessApiCallback<ExecuteCloudScriptResult> callback,
         ErrorCallback errorCallback,
@@ -384,7 +389,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ExecuteCloudScript", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnExecuteCloudScriptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ExecuteCloudScriptResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/ExecuteCloudScript", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnExecuteCloudScriptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ExecuteCloudScriptResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnExecuteCloudScriptResult(CallRequestContainer& request)
@@ -401,7 +406,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetAccountInfo(
+    PlayFabRequestHandle PlayFabClientAPI::GetAccountInfo(
         GetAccountInfoRequest& request,
         ProcessApiCallback<GetAccountInfoResult> callback,
         ErrorCallback errorCallback,
@@ -411,7 +416,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetAccountInfo", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetAccountInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAccountInfoResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetAccountInfo", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetAccountInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAccountInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetAccountInfoResult(CallRequestContainer& request)
@@ -428,7 +433,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetAllUsersCharacters(
+    PlayFabRequestHandle PlayFabClientAPI::GetAllUsersCharacters(
         ListUsersCharactersRequest& request,
         ProcessApiCallback<ListUsersCharactersResult> callback,
         ErrorCallback errorCallback,
@@ -438,7 +443,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetAllUsersCharacters", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetAllUsersCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListUsersCharactersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetAllUsersCharacters", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetAllUsersCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListUsersCharactersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetAllUsersCharactersResult(CallRequestContainer& request)
@@ -455,7 +460,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetCatalogItems(
+    PlayFabRequestHandle PlayFabClientAPI::GetCatalogItems(
         GetCatalogItemsRequest& request,
         ProcessApiCallback<GetCatalogItemsResult> callback,
         ErrorCallback errorCallback,
@@ -465,7 +470,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCatalogItems", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetCatalogItems", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetCatalogItemsResult(CallRequestContainer& request)
@@ -482,7 +487,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetCharacterData(
+    PlayFabRequestHandle PlayFabClientAPI::GetCharacterData(
         GetCharacterDataRequest& request,
         ProcessApiCallback<GetCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -492,7 +497,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetCharacterData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetCharacterDataResult(CallRequestContainer& request)
@@ -509,7 +514,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetCharacterInventory(
+    PlayFabRequestHandle PlayFabClientAPI::GetCharacterInventory(
         GetCharacterInventoryRequest& request,
         ProcessApiCallback<GetCharacterInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -519,7 +524,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterInventory", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterInventoryResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetCharacterInventory", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetCharacterInventoryResult(CallRequestContainer& request)
@@ -536,7 +541,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetCharacterLeaderboard(
+    PlayFabRequestHandle PlayFabClientAPI::GetCharacterLeaderboard(
         GetCharacterLeaderboardRequest& request,
         ProcessApiCallback<GetCharacterLeaderboardResult> callback,
         ErrorCallback errorCallback,
@@ -546,7 +551,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterLeaderboard", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterLeaderboardResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetCharacterLeaderboard", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetCharacterLeaderboardResult(CallRequestContainer& request)
@@ -563,7 +568,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetCharacterReadOnlyData(
+    PlayFabRequestHandle PlayFabClientAPI::GetCharacterReadOnlyData(
         GetCharacterDataRequest& request,
         ProcessApiCallback<GetCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -573,7 +578,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterReadOnlyData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetCharacterReadOnlyData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetCharacterReadOnlyDataResult(CallRequestContainer& request)
@@ -590,7 +595,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetCharacterStatistics(
+    PlayFabRequestHandle PlayFabClientAPI::GetCharacterStatistics(
         GetCharacterStatisticsRequest& request,
         ProcessApiCallback<GetCharacterStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -600,7 +605,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCharacterStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetCharacterStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetCharacterStatisticsResult(CallRequestContainer& request)
@@ -617,7 +622,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetContentDownloadUrl(
+    PlayFabRequestHandle PlayFabClientAPI::GetContentDownloadUrl(
         GetContentDownloadUrlRequest& request,
         ProcessApiCallback<GetContentDownloadUrlResult> callback,
         ErrorCallback errorCallback,
@@ -627,7 +632,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetContentDownloadUrl", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetContentDownloadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentDownloadUrlResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetContentDownloadUrl", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetContentDownloadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentDownloadUrlResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetContentDownloadUrlResult(CallRequestContainer& request)
@@ -644,7 +649,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetCurrentGames(
+    PlayFabRequestHandle PlayFabClientAPI::GetCurrentGames(
         CurrentGamesRequest& request,
         ProcessApiCallback<CurrentGamesResult> callback,
         ErrorCallback errorCallback,
@@ -654,7 +659,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetCurrentGames", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCurrentGamesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CurrentGamesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetCurrentGames", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetCurrentGamesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CurrentGamesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetCurrentGamesResult(CallRequestContainer& request)
@@ -671,7 +676,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetFriendLeaderboard(
+    PlayFabRequestHandle PlayFabClientAPI::GetFriendLeaderboard(
         GetFriendLeaderboardRequest& request,
         ProcessApiCallback<GetLeaderboardResult> callback,
         ErrorCallback errorCallback,
@@ -681,7 +686,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetFriendLeaderboard", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetFriendLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetFriendLeaderboard", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetFriendLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetFriendLeaderboardResult(CallRequestContainer& request)
@@ -698,7 +703,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
+    PlayFabRequestHandle PlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
         GetFriendLeaderboardAroundPlayerRequest& request,
         ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult> callback,
         ErrorCallback errorCallback,
@@ -708,7 +713,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetFriendLeaderboardAroundPlayer", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetFriendLeaderboardAroundPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetFriendLeaderboardAroundPlayer", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetFriendLeaderboardAroundPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult(CallRequestContainer& request)
@@ -725,7 +730,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetFriendsList(
+    PlayFabRequestHandle PlayFabClientAPI::GetFriendsList(
         GetFriendsListRequest& request,
         ProcessApiCallback<GetFriendsListResult> callback,
         ErrorCallback errorCallback,
@@ -735,7 +740,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetFriendsList", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetFriendsListResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendsListResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetFriendsList", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetFriendsListResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendsListResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetFriendsListResult(CallRequestContainer& request)
@@ -752,7 +757,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetGameServerRegions(
+    PlayFabRequestHandle PlayFabClientAPI::GetGameServerRegions(
         GameServerRegionsRequest& request,
         ProcessApiCallback<GameServerRegionsResult> callback,
         ErrorCallback errorCallback,
@@ -762,7 +767,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetGameServerRegions", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetGameServerRegionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GameServerRegionsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetGameServerRegions", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetGameServerRegionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GameServerRegionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetGameServerRegionsResult(CallRequestContainer& request)
@@ -779,7 +784,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetLeaderboard(
+    PlayFabRequestHandle PlayFabClientAPI::GetLeaderboard(
         GetLeaderboardRequest& request,
         ProcessApiCallback<GetLeaderboardResult> callback,
         ErrorCallback errorCallback,
@@ -789,7 +794,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetLeaderboard", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetLeaderboard", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetLeaderboardResult(CallRequestContainer& request)
@@ -806,7 +811,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetLeaderboardAroundCharacter(
+    PlayFabRequestHandle PlayFabClientAPI::GetLeaderboardAroundCharacter(
         GetLeaderboardAroundCharacterRequest& request,
         ProcessApiCallback<GetLeaderboardAroundCharacterResult> callback,
         ErrorCallback errorCallback,
@@ -816,7 +821,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetLeaderboardAroundCharacter", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardAroundCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundCharacterResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetLeaderboardAroundCharacter", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardAroundCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundCharacterResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetLeaderboardAroundCharacterResult(CallRequestContainer& request)
@@ -833,7 +838,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetLeaderboardAroundPlayer(
+    PlayFabRequestHandle PlayFabClientAPI::GetLeaderboardAroundPlayer(
         GetLeaderboardAroundPlayerRequest& request,
         ProcessApiCallback<GetLeaderboardAroundPlayerResult> callback,
         ErrorCallback errorCallback,
@@ -843,7 +848,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetLeaderboardAroundPlayer", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardAroundPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundPlayerResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetLeaderboardAroundPlayer", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardAroundPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundPlayerResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetLeaderboardAroundPlayerResult(CallRequestContainer& request)
@@ -860,7 +865,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetLeaderboardForUserCharacters(
+    PlayFabRequestHandle PlayFabClientAPI::GetLeaderboardForUserCharacters(
         GetLeaderboardForUsersCharactersRequest& request,
         ProcessApiCallback<GetLeaderboardForUsersCharactersResult> callback,
         ErrorCallback errorCallback,
@@ -870,7 +875,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetLeaderboardForUserCharacters", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardForUserCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardForUsersCharactersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetLeaderboardForUserCharacters", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetLeaderboardForUserCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardForUsersCharactersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetLeaderboardForUserCharactersResult(CallRequestContainer& request)
@@ -887,7 +892,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPaymentToken(
+    PlayFabRequestHandle PlayFabClientAPI::GetPaymentToken(
         GetPaymentTokenRequest& request,
         ProcessApiCallback<GetPaymentTokenResult> callback,
         ErrorCallback errorCallback,
@@ -897,7 +902,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPaymentToken", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPaymentTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPaymentTokenResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPaymentToken", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPaymentTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPaymentTokenResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPaymentTokenResult(CallRequestContainer& request)
@@ -914,7 +919,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPhotonAuthenticationToken(
+    PlayFabRequestHandle PlayFabClientAPI::GetPhotonAuthenticationToken(
         GetPhotonAuthenticationTokenRequest& request,
         ProcessApiCallback<GetPhotonAuthenticationTokenResult> callback,
         ErrorCallback errorCallback,
@@ -924,7 +929,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPhotonAuthenticationToken", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPhotonAuthenticationTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPhotonAuthenticationTokenResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPhotonAuthenticationToken", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPhotonAuthenticationTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPhotonAuthenticationTokenResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPhotonAuthenticationTokenResult(CallRequestContainer& request)
@@ -941,7 +946,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayerCombinedInfo(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayerCombinedInfo(
         GetPlayerCombinedInfoRequest& request,
         ProcessApiCallback<GetPlayerCombinedInfoResult> callback,
         ErrorCallback errorCallback,
@@ -951,7 +956,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerCombinedInfo", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerCombinedInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerCombinedInfoResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayerCombinedInfo", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerCombinedInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerCombinedInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayerCombinedInfoResult(CallRequestContainer& request)
@@ -968,7 +973,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayerProfile(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayerProfile(
         GetPlayerProfileRequest& request,
         ProcessApiCallback<GetPlayerProfileResult> callback,
         ErrorCallback errorCallback,
@@ -978,7 +983,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerProfile", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayerProfile", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayerProfileResult(CallRequestContainer& request)
@@ -995,7 +1000,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayerSegments(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayerSegments(
         GetPlayerSegmentsRequest& request,
         ProcessApiCallback<GetPlayerSegmentsResult> callback,
         ErrorCallback errorCallback,
@@ -1005,7 +1010,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerSegments", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayerSegments", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayerSegmentsResult(CallRequestContainer& request)
@@ -1022,7 +1027,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayerStatistics(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayerStatistics(
         GetPlayerStatisticsRequest& request,
         ProcessApiCallback<GetPlayerStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -1032,7 +1037,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayerStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayerStatisticsResult(CallRequestContainer& request)
@@ -1049,7 +1054,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayerStatisticVersions(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayerStatisticVersions(
         GetPlayerStatisticVersionsRequest& request,
         ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
         ErrorCallback errorCallback,
@@ -1059,7 +1064,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerStatisticVersions", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerStatisticVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayerStatisticVersions", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerStatisticVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayerStatisticVersionsResult(CallRequestContainer& request)
@@ -1076,7 +1081,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayerTags(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayerTags(
         GetPlayerTagsRequest& request,
         ProcessApiCallback<GetPlayerTagsResult> callback,
         ErrorCallback errorCallback,
@@ -1086,7 +1091,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerTags", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayerTags", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayerTagsResult(CallRequestContainer& request)
@@ -1103,7 +1108,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayerTrades(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayerTrades(
         GetPlayerTradesRequest& request,
         ProcessApiCallback<GetPlayerTradesResponse> callback,
         ErrorCallback errorCallback,
@@ -1113,7 +1118,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayerTrades", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerTradesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTradesResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayerTrades", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayerTradesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTradesResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayerTradesResult(CallRequestContainer& request)
@@ -1130,7 +1135,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
         GetPlayFabIDsFromFacebookIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1140,7 +1145,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromFacebookIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromFacebookIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayFabIDsFromFacebookIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromFacebookIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult(CallRequestContainer& request)
@@ -1157,7 +1162,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
         GetPlayFabIDsFromGameCenterIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1167,7 +1172,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromGameCenterIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromGameCenterIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayFabIDsFromGameCenterIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromGameCenterIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult(CallRequestContainer& request)
@@ -1184,7 +1189,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
         GetPlayFabIDsFromGenericIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1194,7 +1199,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromGenericIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromGenericIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayFabIDsFromGenericIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromGenericIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult(CallRequestContainer& request)
@@ -1211,7 +1216,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
         GetPlayFabIDsFromGoogleIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1221,7 +1226,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromGoogleIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromGoogleIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayFabIDsFromGoogleIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromGoogleIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult(CallRequestContainer& request)
@@ -1238,7 +1243,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
         GetPlayFabIDsFromKongregateIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1248,7 +1253,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromKongregateIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromKongregateIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayFabIDsFromKongregateIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromKongregateIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult(CallRequestContainer& request)
@@ -1265,7 +1270,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
         GetPlayFabIDsFromSteamIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1275,7 +1280,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromSteamIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromSteamIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayFabIDsFromSteamIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromSteamIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult(CallRequestContainer& request)
@@ -1292,7 +1297,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
+    PlayFabRequestHandle PlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
         GetPlayFabIDsFromTwitchIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1302,7 +1307,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPlayFabIDsFromTwitchIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromTwitchIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPlayFabIDsFromTwitchIDs", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPlayFabIDsFromTwitchIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult(CallRequestContainer& request)
@@ -1319,7 +1324,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPublisherData(
+    PlayFabRequestHandle PlayFabClientAPI::GetPublisherData(
         GetPublisherDataRequest& request,
         ProcessApiCallback<GetPublisherDataResult> callback,
         ErrorCallback errorCallback,
@@ -1329,7 +1334,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPublisherData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPublisherData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPublisherDataResult(CallRequestContainer& request)
@@ -1346,7 +1351,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetPurchase(
+    PlayFabRequestHandle PlayFabClientAPI::GetPurchase(
         GetPurchaseRequest& request,
         ProcessApiCallback<GetPurchaseResult> callback,
         ErrorCallback errorCallback,
@@ -1356,7 +1361,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPurchaseResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPurchaseResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetPurchaseResult(CallRequestContainer& request)
@@ -1373,7 +1378,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetSharedGroupData(
+    PlayFabRequestHandle PlayFabClientAPI::GetSharedGroupData(
         GetSharedGroupDataRequest& request,
         ProcessApiCallback<GetSharedGroupDataResult> callback,
         ErrorCallback errorCallback,
@@ -1383,7 +1388,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetSharedGroupData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSharedGroupDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetSharedGroupData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSharedGroupDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetSharedGroupDataResult(CallRequestContainer& request)
@@ -1400,7 +1405,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetStoreItems(
+    PlayFabRequestHandle PlayFabClientAPI::GetStoreItems(
         GetStoreItemsRequest& request,
         ProcessApiCallback<GetStoreItemsResult> callback,
         ErrorCallback errorCallback,
@@ -1410,7 +1415,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetStoreItems", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetStoreItems", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetStoreItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetStoreItemsResult(CallRequestContainer& request)
@@ -1427,7 +1432,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetTime(
+    PlayFabRequestHandle PlayFabClientAPI::GetTime(
         GetTimeRequest& request,
         ProcessApiCallback<GetTimeResult> callback,
         ErrorCallback errorCallback,
@@ -1437,7 +1442,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTime", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTimeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTimeResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetTime", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTimeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTimeResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetTimeResult(CallRequestContainer& request)
@@ -1454,7 +1459,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetTitleData(
+    PlayFabRequestHandle PlayFabClientAPI::GetTitleData(
         GetTitleDataRequest& request,
         ProcessApiCallback<GetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -1464,7 +1469,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTitleData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetTitleData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetTitleDataResult(CallRequestContainer& request)
@@ -1481,7 +1486,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetTitleNews(
+    PlayFabRequestHandle PlayFabClientAPI::GetTitleNews(
         GetTitleNewsRequest& request,
         ProcessApiCallback<GetTitleNewsResult> callback,
         ErrorCallback errorCallback,
@@ -1491,7 +1496,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTitleNews", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTitleNewsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleNewsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetTitleNews", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTitleNewsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleNewsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetTitleNewsResult(CallRequestContainer& request)
@@ -1508,7 +1513,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetTitlePublicKey(
+    PlayFabRequestHandle PlayFabClientAPI::GetTitlePublicKey(
         GetTitlePublicKeyRequest& request,
         ProcessApiCallback<GetTitlePublicKeyResult> callback,
         ErrorCallback errorCallback,
@@ -1518,7 +1523,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTitlePublicKey", "", "", requestJson, OnGetTitlePublicKeyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitlePublicKeyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetTitlePublicKey", "", "", requestJson, OnGetTitlePublicKeyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitlePublicKeyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetTitlePublicKeyResult(CallRequestContainer& request)
@@ -1535,7 +1540,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetTradeStatus(
+    PlayFabRequestHandle PlayFabClientAPI::GetTradeStatus(
         GetTradeStatusRequest& request,
         ProcessApiCallback<GetTradeStatusResponse> callback,
         ErrorCallback errorCallback,
@@ -1545,7 +1550,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetTradeStatus", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTradeStatusResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTradeStatusResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetTradeStatus", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetTradeStatusResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTradeStatusResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetTradeStatusResult(CallRequestContainer& request)
@@ -1562,7 +1567,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetUserData(
+    PlayFabRequestHandle PlayFabClientAPI::GetUserData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1572,7 +1577,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetUserData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetUserDataResult(CallRequestContainer& request)
@@ -1589,7 +1594,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetUserInventory(
+    PlayFabRequestHandle PlayFabClientAPI::GetUserInventory(
         GetUserInventoryRequest& request,
         ProcessApiCallback<GetUserInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -1599,7 +1604,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserInventory", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetUserInventory", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetUserInventoryResult(CallRequestContainer& request)
@@ -1616,7 +1621,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetUserPublisherData(
+    PlayFabRequestHandle PlayFabClientAPI::GetUserPublisherData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1626,7 +1631,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserPublisherData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetUserPublisherData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetUserPublisherDataResult(CallRequestContainer& request)
@@ -1643,7 +1648,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetUserPublisherReadOnlyData(
+    PlayFabRequestHandle PlayFabClientAPI::GetUserPublisherReadOnlyData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1653,7 +1658,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserPublisherReadOnlyData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetUserPublisherReadOnlyData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult(CallRequestContainer& request)
@@ -1670,7 +1675,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetUserReadOnlyData(
+    PlayFabRequestHandle PlayFabClientAPI::GetUserReadOnlyData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1680,7 +1685,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetUserReadOnlyData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetUserReadOnlyData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGetUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetUserReadOnlyDataResult(CallRequestContainer& request)
@@ -1697,7 +1702,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GetWindowsHelloChallenge(
+    PlayFabRequestHandle PlayFabClientAPI::GetWindowsHelloChallenge(
         GetWindowsHelloChallengeRequest& request,
         ProcessApiCallback<GetWindowsHelloChallengeResponse> callback,
         ErrorCallback errorCallback,
@@ -1707,7 +1712,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GetWindowsHelloChallenge", "", "", requestJson, OnGetWindowsHelloChallengeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetWindowsHelloChallengeResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GetWindowsHelloChallenge", "", "", requestJson, OnGetWindowsHelloChallengeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetWindowsHelloChallengeResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGetWindowsHelloChallengeResult(CallRequestContainer& request)
@@ -1724,7 +1729,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::GrantCharacterToUser(
+    PlayFabRequestHandle PlayFabClientAPI::GrantCharacterToUser(
         GrantCharacterToUserRequest& request,
         ProcessApiCallback<GrantCharacterToUserResult> callback,
         ErrorCallback errorCallback,
@@ -1734,7 +1739,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/GrantCharacterToUser", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGrantCharacterToUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantCharacterToUserResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/GrantCharacterToUser", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnGrantCharacterToUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantCharacterToUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnGrantCharacterToUserResult(CallRequestContainer& request)
@@ -1751,7 +1756,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkAndroidDeviceID(
+    PlayFabRequestHandle PlayFabClientAPI::LinkAndroidDeviceID(
         LinkAndroidDeviceIDRequest& request,
         ProcessApiCallback<LinkAndroidDeviceIDResult> callback,
         ErrorCallback errorCallback,
@@ -1761,7 +1766,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkAndroidDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkAndroidDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkAndroidDeviceIDResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkAndroidDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkAndroidDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkAndroidDeviceIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkAndroidDeviceIDResult(CallRequestContainer& request)
@@ -1778,7 +1783,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkCustomID(
+    PlayFabRequestHandle PlayFabClientAPI::LinkCustomID(
         LinkCustomIDRequest& request,
         ProcessApiCallback<LinkCustomIDResult> callback,
         ErrorCallback errorCallback,
@@ -1788,7 +1793,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkCustomID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkCustomIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkCustomIDResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkCustomID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkCustomIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkCustomIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkCustomIDResult(CallRequestContainer& request)
@@ -1805,7 +1810,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkFacebookAccount(
+    PlayFabRequestHandle PlayFabClientAPI::LinkFacebookAccount(
         LinkFacebookAccountRequest& request,
         ProcessApiCallback<LinkFacebookAccountResult> callback,
         ErrorCallback errorCallback,
@@ -1815,7 +1820,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkFacebookAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkFacebookAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkFacebookAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkFacebookAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkFacebookAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkFacebookAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkFacebookAccountResult(CallRequestContainer& request)
@@ -1832,7 +1837,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkGameCenterAccount(
+    PlayFabRequestHandle PlayFabClientAPI::LinkGameCenterAccount(
         LinkGameCenterAccountRequest& request,
         ProcessApiCallback<LinkGameCenterAccountResult> callback,
         ErrorCallback errorCallback,
@@ -1842,7 +1847,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkGameCenterAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkGameCenterAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGameCenterAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkGameCenterAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkGameCenterAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGameCenterAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkGameCenterAccountResult(CallRequestContainer& request)
@@ -1859,7 +1864,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkGoogleAccount(
+    PlayFabRequestHandle PlayFabClientAPI::LinkGoogleAccount(
         LinkGoogleAccountRequest& request,
         ProcessApiCallback<LinkGoogleAccountResult> callback,
         ErrorCallback errorCallback,
@@ -1869,7 +1874,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkGoogleAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkGoogleAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGoogleAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkGoogleAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkGoogleAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGoogleAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkGoogleAccountResult(CallRequestContainer& request)
@@ -1886,7 +1891,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkIOSDeviceID(
+    PlayFabRequestHandle PlayFabClientAPI::LinkIOSDeviceID(
         LinkIOSDeviceIDRequest& request,
         ProcessApiCallback<LinkIOSDeviceIDResult> callback,
         ErrorCallback errorCallback,
@@ -1896,7 +1901,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkIOSDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkIOSDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkIOSDeviceIDResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkIOSDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkIOSDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkIOSDeviceIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkIOSDeviceIDResult(CallRequestContainer& request)
@@ -1913,7 +1918,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkKongregate(
+    PlayFabRequestHandle PlayFabClientAPI::LinkKongregate(
         LinkKongregateAccountRequest& request,
         ProcessApiCallback<LinkKongregateAccountResult> callback,
         ErrorCallback errorCallback,
@@ -1923,7 +1928,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkKongregate", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkKongregateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkKongregateAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkKongregate", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkKongregateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkKongregateAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkKongregateResult(CallRequestContainer& request)
@@ -1940,7 +1945,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkSteamAccount(
+    PlayFabRequestHandle PlayFabClientAPI::LinkSteamAccount(
         LinkSteamAccountRequest& request,
         ProcessApiCallback<LinkSteamAccountResult> callback,
         ErrorCallback errorCallback,
@@ -1950,7 +1955,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkSteamAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkSteamAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkSteamAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkSteamAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkSteamAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkSteamAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkSteamAccountResult(CallRequestContainer& request)
@@ -1967,7 +1972,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkTwitch(
+    PlayFabRequestHandle PlayFabClientAPI::LinkTwitch(
         LinkTwitchAccountRequest& request,
         ProcessApiCallback<LinkTwitchAccountResult> callback,
         ErrorCallback errorCallback,
@@ -1977,7 +1982,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkTwitch", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkTwitchResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkTwitchAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkTwitch", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkTwitchResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkTwitchAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkTwitchResult(CallRequestContainer& request)
@@ -1994,7 +1999,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LinkWindowsHello(
+    PlayFabRequestHandle PlayFabClientAPI::LinkWindowsHello(
         LinkWindowsHelloAccountRequest& request,
         ProcessApiCallback<LinkWindowsHelloAccountResponse> callback,
         ErrorCallback errorCallback,
@@ -2004,7 +2009,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LinkWindowsHello", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkWindowsHelloAccountResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LinkWindowsHello", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnLinkWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkWindowsHelloAccountResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLinkWindowsHelloResult(CallRequestContainer& request)
@@ -2021,7 +2026,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithAndroidDeviceID(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithAndroidDeviceID(
         LoginWithAndroidDeviceIDRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2032,7 +2037,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithAndroidDeviceID", "", "", requestJson, OnLoginWithAndroidDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithAndroidDeviceID", "", "", requestJson, OnLoginWithAndroidDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithAndroidDeviceIDResult(CallRequestContainer& request)
@@ -2055,7 +2060,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithCustomID(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithCustomID(
         LoginWithCustomIDRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2066,7 +2071,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithCustomID", "", "", requestJson, OnLoginWithCustomIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithCustomID", "", "", requestJson, OnLoginWithCustomIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithCustomIDResult(CallRequestContainer& request)
@@ -2089,7 +2094,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithEmailAddress(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithEmailAddress(
         LoginWithEmailAddressRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2100,7 +2105,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithEmailAddress", "", "", requestJson, OnLoginWithEmailAddressResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithEmailAddress", "", "", requestJson, OnLoginWithEmailAddressResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithEmailAddressResult(CallRequestContainer& request)
@@ -2123,7 +2128,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithFacebook(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithFacebook(
         LoginWithFacebookRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2134,7 +2139,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithFacebook", "", "", requestJson, OnLoginWithFacebookResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithFacebook", "", "", requestJson, OnLoginWithFacebookResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithFacebookResult(CallRequestContainer& request)
@@ -2157,7 +2162,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithGameCenter(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithGameCenter(
         LoginWithGameCenterRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2168,7 +2173,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithGameCenter", "", "", requestJson, OnLoginWithGameCenterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithGameCenter", "", "", requestJson, OnLoginWithGameCenterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithGameCenterResult(CallRequestContainer& request)
@@ -2191,7 +2196,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithGoogleAccount(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithGoogleAccount(
         LoginWithGoogleAccountRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2202,7 +2207,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithGoogleAccount", "", "", requestJson, OnLoginWithGoogleAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithGoogleAccount", "", "", requestJson, OnLoginWithGoogleAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithGoogleAccountResult(CallRequestContainer& request)
@@ -2225,7 +2230,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithIOSDeviceID(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithIOSDeviceID(
         LoginWithIOSDeviceIDRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2236,7 +2241,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithIOSDeviceID", "", "", requestJson, OnLoginWithIOSDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithIOSDeviceID", "", "", requestJson, OnLoginWithIOSDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithIOSDeviceIDResult(CallRequestContainer& request)
@@ -2259,7 +2264,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithKongregate(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithKongregate(
         LoginWithKongregateRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2270,7 +2275,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithKongregate", "", "", requestJson, OnLoginWithKongregateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithKongregate", "", "", requestJson, OnLoginWithKongregateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithKongregateResult(CallRequestContainer& request)
@@ -2293,7 +2298,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithPlayFab(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithPlayFab(
         LoginWithPlayFabRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2304,7 +2309,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithPlayFab", "", "", requestJson, OnLoginWithPlayFabResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithPlayFab", "", "", requestJson, OnLoginWithPlayFabResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithPlayFabResult(CallRequestContainer& request)
@@ -2327,7 +2332,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithSteam(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithSteam(
         LoginWithSteamRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2338,7 +2343,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithSteam", "", "", requestJson, OnLoginWithSteamResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithSteam", "", "", requestJson, OnLoginWithSteamResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithSteamResult(CallRequestContainer& request)
@@ -2361,7 +2366,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithTwitch(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithTwitch(
         LoginWithTwitchRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2372,7 +2377,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithTwitch", "", "", requestJson, OnLoginWithTwitchResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithTwitch", "", "", requestJson, OnLoginWithTwitchResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithTwitchResult(CallRequestContainer& request)
@@ -2395,7 +2400,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::LoginWithWindowsHello(
+    PlayFabRequestHandle PlayFabClientAPI::LoginWithWindowsHello(
         LoginWithWindowsHelloRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2406,7 +2411,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/LoginWithWindowsHello", "", "", requestJson, OnLoginWithWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/LoginWithWindowsHello", "", "", requestJson, OnLoginWithWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnLoginWithWindowsHelloResult(CallRequestContainer& request)
@@ -2429,7 +2434,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::Matchmake(
+    PlayFabRequestHandle PlayFabClientAPI::Matchmake(
         MatchmakeRequest& request,
         ProcessApiCallback<MatchmakeResult> callback,
         ErrorCallback errorCallback,
@@ -2439,7 +2444,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/Matchmake", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnMatchmakeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MatchmakeResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/Matchmake", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnMatchmakeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MatchmakeResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnMatchmakeResult(CallRequestContainer& request)
@@ -2456,7 +2461,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::OpenTrade(
+    PlayFabRequestHandle PlayFabClientAPI::OpenTrade(
         OpenTradeRequest& request,
         ProcessApiCallback<OpenTradeResponse> callback,
         ErrorCallback errorCallback,
@@ -2466,7 +2471,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/OpenTrade", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnOpenTradeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<OpenTradeResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/OpenTrade", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnOpenTradeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<OpenTradeResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnOpenTradeResult(CallRequestContainer& request)
@@ -2483,7 +2488,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::PayForPurchase(
+    PlayFabRequestHandle PlayFabClientAPI::PayForPurchase(
         PayForPurchaseRequest& request,
         ProcessApiCallback<PayForPurchaseResult> callback,
         ErrorCallback errorCallback,
@@ -2493,7 +2498,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/PayForPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnPayForPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PayForPurchaseResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/PayForPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnPayForPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PayForPurchaseResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnPayForPurchaseResult(CallRequestContainer& request)
@@ -2510,7 +2515,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::PurchaseItem(
+    PlayFabRequestHandle PlayFabClientAPI::PurchaseItem(
         PurchaseItemRequest& request,
         ProcessApiCallback<PurchaseItemResult> callback,
         ErrorCallback errorCallback,
@@ -2520,7 +2525,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/PurchaseItem", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnPurchaseItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PurchaseItemResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/PurchaseItem", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnPurchaseItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PurchaseItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnPurchaseItemResult(CallRequestContainer& request)
@@ -2537,7 +2542,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::RedeemCoupon(
+    PlayFabRequestHandle PlayFabClientAPI::RedeemCoupon(
         RedeemCouponRequest& request,
         ProcessApiCallback<RedeemCouponResult> callback,
         ErrorCallback errorCallback,
@@ -2547,7 +2552,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RedeemCoupon", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRedeemCouponResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemCouponResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/RedeemCoupon", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRedeemCouponResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemCouponResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnRedeemCouponResult(CallRequestContainer& request)
@@ -2564,7 +2569,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::RegisterForIOSPushNotification(
+    PlayFabRequestHandle PlayFabClientAPI::RegisterForIOSPushNotification(
         RegisterForIOSPushNotificationRequest& request,
         ProcessApiCallback<RegisterForIOSPushNotificationResult> callback,
         ErrorCallback errorCallback,
@@ -2574,7 +2579,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RegisterForIOSPushNotification", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRegisterForIOSPushNotificationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterForIOSPushNotificationResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/RegisterForIOSPushNotification", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRegisterForIOSPushNotificationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterForIOSPushNotificationResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnRegisterForIOSPushNotificationResult(CallRequestContainer& request)
@@ -2591,7 +2596,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::RegisterPlayFabUser(
+    PlayFabRequestHandle PlayFabClientAPI::RegisterPlayFabUser(
         RegisterPlayFabUserRequest& request,
         ProcessApiCallback<RegisterPlayFabUserResult> callback,
         ErrorCallback errorCallback,
@@ -2602,7 +2607,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RegisterPlayFabUser", "", "", requestJson, OnRegisterPlayFabUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterPlayFabUserResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/RegisterPlayFabUser", "", "", requestJson, OnRegisterPlayFabUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterPlayFabUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnRegisterPlayFabUserResult(CallRequestContainer& request)
@@ -2624,7 +2629,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::RegisterWithWindowsHello(
+    PlayFabRequestHandle PlayFabClientAPI::RegisterWithWindowsHello(
         RegisterWithWindowsHelloRequest& request,
         ProcessApiCallback<LoginResult> callback,
         ErrorCallback errorCallback,
@@ -2635,7 +2640,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RegisterWithWindowsHello", "", "", requestJson, OnRegisterWithWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/RegisterWithWindowsHello", "", "", requestJson, OnRegisterWithWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnRegisterWithWindowsHelloResult(CallRequestContainer& request)
@@ -2658,7 +2663,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::RemoveContactEmail(
+    PlayFabRequestHandle PlayFabClientAPI::RemoveContactEmail(
         RemoveContactEmailRequest& request,
         ProcessApiCallback<RemoveContactEmailResult> callback,
         ErrorCallback errorCallback,
@@ -2668,7 +2673,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RemoveContactEmail", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveContactEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveContactEmailResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/RemoveContactEmail", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveContactEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveContactEmailResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnRemoveContactEmailResult(CallRequestContainer& request)
@@ -2685,7 +2690,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::RemoveFriend(
+    PlayFabRequestHandle PlayFabClientAPI::RemoveFriend(
         RemoveFriendRequest& request,
         ProcessApiCallback<RemoveFriendResult> callback,
         ErrorCallback errorCallback,
@@ -2695,7 +2700,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RemoveFriend", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveFriendResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/RemoveFriend", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveFriendResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnRemoveFriendResult(CallRequestContainer& request)
@@ -2712,7 +2717,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::RemoveGenericID(
+    PlayFabRequestHandle PlayFabClientAPI::RemoveGenericID(
         RemoveGenericIDRequest& request,
         ProcessApiCallback<RemoveGenericIDResult> callback,
         ErrorCallback errorCallback,
@@ -2722,7 +2727,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RemoveGenericID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveGenericIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveGenericIDResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/RemoveGenericID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveGenericIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveGenericIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnRemoveGenericIDResult(CallRequestContainer& request)
@@ -2739,7 +2744,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::RemoveSharedGroupMembers(
+    PlayFabRequestHandle PlayFabClientAPI::RemoveSharedGroupMembers(
         RemoveSharedGroupMembersRequest& request,
         ProcessApiCallback<RemoveSharedGroupMembersResult> callback,
         ErrorCallback errorCallback,
@@ -2749,7 +2754,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RemoveSharedGroupMembers", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveSharedGroupMembersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/RemoveSharedGroupMembers", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRemoveSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveSharedGroupMembersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnRemoveSharedGroupMembersResult(CallRequestContainer& request)
@@ -2766,7 +2771,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::ReportDeviceInfo(
+    PlayFabRequestHandle PlayFabClientAPI::ReportDeviceInfo(
         DeviceInfoRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -2776,7 +2781,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ReportDeviceInfo", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnReportDeviceInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/ReportDeviceInfo", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnReportDeviceInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnReportDeviceInfoResult(CallRequestContainer& request)
@@ -2793,7 +2798,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::ReportPlayer(
+    PlayFabRequestHandle PlayFabClientAPI::ReportPlayer(
         ReportPlayerClientRequest& request,
         ProcessApiCallback<ReportPlayerClientResult> callback,
         ErrorCallback errorCallback,
@@ -2803,7 +2808,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ReportPlayer", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnReportPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportPlayerClientResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/ReportPlayer", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnReportPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportPlayerClientResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnReportPlayerResult(CallRequestContainer& request)
@@ -2820,7 +2825,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::RestoreIOSPurchases(
+    PlayFabRequestHandle PlayFabClientAPI::RestoreIOSPurchases(
         RestoreIOSPurchasesRequest& request,
         ProcessApiCallback<RestoreIOSPurchasesResult> callback,
         ErrorCallback errorCallback,
@@ -2830,7 +2835,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/RestoreIOSPurchases", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRestoreIOSPurchasesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RestoreIOSPurchasesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/RestoreIOSPurchases", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnRestoreIOSPurchasesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RestoreIOSPurchasesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnRestoreIOSPurchasesResult(CallRequestContainer& request)
@@ -2847,7 +2852,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::SendAccountRecoveryEmail(
+    PlayFabRequestHandle PlayFabClientAPI::SendAccountRecoveryEmail(
         SendAccountRecoveryEmailRequest& request,
         ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
         ErrorCallback errorCallback,
@@ -2857,7 +2862,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/SendAccountRecoveryEmail", "", "", requestJson, OnSendAccountRecoveryEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/SendAccountRecoveryEmail", "", "", requestJson, OnSendAccountRecoveryEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnSendAccountRecoveryEmailResult(CallRequestContainer& request)
@@ -2874,7 +2879,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::SetFriendTags(
+    PlayFabRequestHandle PlayFabClientAPI::SetFriendTags(
         SetFriendTagsRequest& request,
         ProcessApiCallback<SetFriendTagsResult> callback,
         ErrorCallback errorCallback,
@@ -2884,7 +2889,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/SetFriendTags", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnSetFriendTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetFriendTagsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/SetFriendTags", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnSetFriendTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetFriendTagsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnSetFriendTagsResult(CallRequestContainer& request)
@@ -2901,7 +2906,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::SetPlayerSecret(
+    PlayFabRequestHandle PlayFabClientAPI::SetPlayerSecret(
         SetPlayerSecretRequest& request,
         ProcessApiCallback<SetPlayerSecretResult> callback,
         ErrorCallback errorCallback,
@@ -2911,7 +2916,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/SetPlayerSecret", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnSetPlayerSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/SetPlayerSecret", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnSetPlayerSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnSetPlayerSecretResult(CallRequestContainer& request)
@@ -2928,7 +2933,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::StartGame(
+    PlayFabRequestHandle PlayFabClientAPI::StartGame(
         StartGameRequest& request,
         ProcessApiCallback<StartGameResult> callback,
         ErrorCallback errorCallback,
@@ -2938,7 +2943,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/StartGame", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnStartGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartGameResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/StartGame", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnStartGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartGameResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnStartGameResult(CallRequestContainer& request)
@@ -2955,7 +2960,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::StartPurchase(
+    PlayFabRequestHandle PlayFabClientAPI::StartPurchase(
         StartPurchaseRequest& request,
         ProcessApiCallback<StartPurchaseResult> callback,
         ErrorCallback errorCallback,
@@ -2965,7 +2970,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/StartPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnStartPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartPurchaseResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/StartPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnStartPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartPurchaseResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnStartPurchaseResult(CallRequestContainer& request)
@@ -2982,7 +2987,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::SubtractUserVirtualCurrency(
+    PlayFabRequestHandle PlayFabClientAPI::SubtractUserVirtualCurrency(
         SubtractUserVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -2992,7 +2997,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/SubtractUserVirtualCurrency", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnSubtractUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/SubtractUserVirtualCurrency", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnSubtractUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnSubtractUserVirtualCurrencyResult(CallRequestContainer& request)
@@ -3009,7 +3014,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkAndroidDeviceID(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkAndroidDeviceID(
         UnlinkAndroidDeviceIDRequest& request,
         ProcessApiCallback<UnlinkAndroidDeviceIDResult> callback,
         ErrorCallback errorCallback,
@@ -3019,7 +3024,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkAndroidDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkAndroidDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkAndroidDeviceIDResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkAndroidDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkAndroidDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkAndroidDeviceIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkAndroidDeviceIDResult(CallRequestContainer& request)
@@ -3036,7 +3041,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkCustomID(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkCustomID(
         UnlinkCustomIDRequest& request,
         ProcessApiCallback<UnlinkCustomIDResult> callback,
         ErrorCallback errorCallback,
@@ -3046,7 +3051,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkCustomID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkCustomIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkCustomIDResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkCustomID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkCustomIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkCustomIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkCustomIDResult(CallRequestContainer& request)
@@ -3063,7 +3068,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkFacebookAccount(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkFacebookAccount(
         UnlinkFacebookAccountRequest& request,
         ProcessApiCallback<UnlinkFacebookAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3073,7 +3078,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkFacebookAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkFacebookAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkFacebookAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkFacebookAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkFacebookAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkFacebookAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkFacebookAccountResult(CallRequestContainer& request)
@@ -3090,7 +3095,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkGameCenterAccount(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkGameCenterAccount(
         UnlinkGameCenterAccountRequest& request,
         ProcessApiCallback<UnlinkGameCenterAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3100,7 +3105,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkGameCenterAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkGameCenterAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGameCenterAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkGameCenterAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkGameCenterAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGameCenterAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkGameCenterAccountResult(CallRequestContainer& request)
@@ -3117,7 +3122,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkGoogleAccount(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkGoogleAccount(
         UnlinkGoogleAccountRequest& request,
         ProcessApiCallback<UnlinkGoogleAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3127,7 +3132,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkGoogleAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkGoogleAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGoogleAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkGoogleAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkGoogleAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGoogleAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkGoogleAccountResult(CallRequestContainer& request)
@@ -3144,7 +3149,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkIOSDeviceID(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkIOSDeviceID(
         UnlinkIOSDeviceIDRequest& request,
         ProcessApiCallback<UnlinkIOSDeviceIDResult> callback,
         ErrorCallback errorCallback,
@@ -3154,7 +3159,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkIOSDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkIOSDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkIOSDeviceIDResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkIOSDeviceID", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkIOSDeviceIDResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkIOSDeviceIDResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkIOSDeviceIDResult(CallRequestContainer& request)
@@ -3171,7 +3176,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkKongregate(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkKongregate(
         UnlinkKongregateAccountRequest& request,
         ProcessApiCallback<UnlinkKongregateAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3181,7 +3186,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkKongregate", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkKongregateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkKongregateAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkKongregate", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkKongregateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkKongregateAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkKongregateResult(CallRequestContainer& request)
@@ -3198,7 +3203,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkSteamAccount(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkSteamAccount(
         UnlinkSteamAccountRequest& request,
         ProcessApiCallback<UnlinkSteamAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3208,7 +3213,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkSteamAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkSteamAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkSteamAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkSteamAccount", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkSteamAccountResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkSteamAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkSteamAccountResult(CallRequestContainer& request)
@@ -3225,7 +3230,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkTwitch(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkTwitch(
         UnlinkTwitchAccountRequest& request,
         ProcessApiCallback<UnlinkTwitchAccountResult> callback,
         ErrorCallback errorCallback,
@@ -3235,7 +3240,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkTwitch", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkTwitchResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkTwitchAccountResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkTwitch", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkTwitchResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkTwitchAccountResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkTwitchResult(CallRequestContainer& request)
@@ -3252,7 +3257,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlinkWindowsHello(
+    PlayFabRequestHandle PlayFabClientAPI::UnlinkWindowsHello(
         UnlinkWindowsHelloAccountRequest& request,
         ProcessApiCallback<UnlinkWindowsHelloAccountResponse> callback,
         ErrorCallback errorCallback,
@@ -3262,7 +3267,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlinkWindowsHello", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkWindowsHelloAccountResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlinkWindowsHello", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlinkWindowsHelloResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkWindowsHelloAccountResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlinkWindowsHelloResult(CallRequestContainer& request)
@@ -3279,7 +3284,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlockContainerInstance(
+    PlayFabRequestHandle PlayFabClientAPI::UnlockContainerInstance(
         UnlockContainerInstanceRequest& request,
         ProcessApiCallback<UnlockContainerItemResult> callback,
         ErrorCallback errorCallback,
@@ -3289,7 +3294,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlockContainerInstance", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlockContainerInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlockContainerInstance", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlockContainerInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlockContainerInstanceResult(CallRequestContainer& request)
@@ -3306,7 +3311,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UnlockContainerItem(
+    PlayFabRequestHandle PlayFabClientAPI::UnlockContainerItem(
         UnlockContainerItemRequest& request,
         ProcessApiCallback<UnlockContainerItemResult> callback,
         ErrorCallback errorCallback,
@@ -3316,7 +3321,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UnlockContainerItem", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlockContainerItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UnlockContainerItem", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUnlockContainerItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUnlockContainerItemResult(CallRequestContainer& request)
@@ -3333,7 +3338,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UpdateAvatarUrl(
+    PlayFabRequestHandle PlayFabClientAPI::UpdateAvatarUrl(
         UpdateAvatarUrlRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -3343,7 +3348,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateAvatarUrl", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateAvatarUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UpdateAvatarUrl", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateAvatarUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUpdateAvatarUrlResult(CallRequestContainer& request)
@@ -3360,7 +3365,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UpdateCharacterData(
+    PlayFabRequestHandle PlayFabClientAPI::UpdateCharacterData(
         UpdateCharacterDataRequest& request,
         ProcessApiCallback<UpdateCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -3370,7 +3375,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateCharacterData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UpdateCharacterData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUpdateCharacterDataResult(CallRequestContainer& request)
@@ -3387,7 +3392,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UpdateCharacterStatistics(
+    PlayFabRequestHandle PlayFabClientAPI::UpdateCharacterStatistics(
         UpdateCharacterStatisticsRequest& request,
         ProcessApiCallback<UpdateCharacterStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -3397,7 +3402,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateCharacterStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UpdateCharacterStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUpdateCharacterStatisticsResult(CallRequestContainer& request)
@@ -3414,7 +3419,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UpdatePlayerStatistics(
+    PlayFabRequestHandle PlayFabClientAPI::UpdatePlayerStatistics(
         UpdatePlayerStatisticsRequest& request,
         ProcessApiCallback<UpdatePlayerStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -3424,7 +3429,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdatePlayerStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdatePlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UpdatePlayerStatistics", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdatePlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUpdatePlayerStatisticsResult(CallRequestContainer& request)
@@ -3441,7 +3446,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UpdateSharedGroupData(
+    PlayFabRequestHandle PlayFabClientAPI::UpdateSharedGroupData(
         UpdateSharedGroupDataRequest& request,
         ProcessApiCallback<UpdateSharedGroupDataResult> callback,
         ErrorCallback errorCallback,
@@ -3451,7 +3456,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateSharedGroupData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSharedGroupDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UpdateSharedGroupData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSharedGroupDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUpdateSharedGroupDataResult(CallRequestContainer& request)
@@ -3468,7 +3473,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UpdateUserData(
+    PlayFabRequestHandle PlayFabClientAPI::UpdateUserData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -3478,7 +3483,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateUserData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UpdateUserData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUpdateUserDataResult(CallRequestContainer& request)
@@ -3495,7 +3500,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UpdateUserPublisherData(
+    PlayFabRequestHandle PlayFabClientAPI::UpdateUserPublisherData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -3505,7 +3510,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateUserPublisherData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UpdateUserPublisherData", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUpdateUserPublisherDataResult(CallRequestContainer& request)
@@ -3522,7 +3527,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::UpdateUserTitleDisplayName(
+    PlayFabRequestHandle PlayFabClientAPI::UpdateUserTitleDisplayName(
         UpdateUserTitleDisplayNameRequest& request,
         ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
         ErrorCallback errorCallback,
@@ -3532,7 +3537,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/UpdateUserTitleDisplayName", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateUserTitleDisplayNameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/UpdateUserTitleDisplayName", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnUpdateUserTitleDisplayNameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnUpdateUserTitleDisplayNameResult(CallRequestContainer& request)
@@ -3549,7 +3554,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::ValidateAmazonIAPReceipt(
+    PlayFabRequestHandle PlayFabClientAPI::ValidateAmazonIAPReceipt(
         ValidateAmazonReceiptRequest& request,
         ProcessApiCallback<ValidateAmazonReceiptResult> callback,
         ErrorCallback errorCallback,
@@ -3559,7 +3564,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ValidateAmazonIAPReceipt", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateAmazonIAPReceiptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateAmazonReceiptResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/ValidateAmazonIAPReceipt", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateAmazonIAPReceiptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateAmazonReceiptResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnValidateAmazonIAPReceiptResult(CallRequestContainer& request)
@@ -3576,7 +3581,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::ValidateGooglePlayPurchase(
+    PlayFabRequestHandle PlayFabClientAPI::ValidateGooglePlayPurchase(
         ValidateGooglePlayPurchaseRequest& request,
         ProcessApiCallback<ValidateGooglePlayPurchaseResult> callback,
         ErrorCallback errorCallback,
@@ -3586,7 +3591,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ValidateGooglePlayPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateGooglePlayPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateGooglePlayPurchaseResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/ValidateGooglePlayPurchase", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateGooglePlayPurchaseResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateGooglePlayPurchaseResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnValidateGooglePlayPurchaseResult(CallRequestContainer& request)
@@ -3603,7 +3608,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::ValidateIOSReceipt(
+    PlayFabRequestHandle PlayFabClientAPI::ValidateIOSReceipt(
         ValidateIOSReceiptRequest& request,
         ProcessApiCallback<ValidateIOSReceiptResult> callback,
         ErrorCallback errorCallback,
@@ -3613,7 +3618,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ValidateIOSReceipt", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateIOSReceiptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateIOSReceiptResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/ValidateIOSReceipt", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateIOSReceiptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateIOSReceiptResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnValidateIOSReceiptResult(CallRequestContainer& request)
@@ -3630,7 +3635,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::ValidateWindowsStoreReceipt(
+    PlayFabRequestHandle PlayFabClientAPI::ValidateWindowsStoreReceipt(
         ValidateWindowsReceiptRequest& request,
         ProcessApiCallback<ValidateWindowsReceiptResult> callback,
         ErrorCallback errorCallback,
@@ -3640,7 +3645,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/ValidateWindowsStoreReceipt", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateWindowsStoreReceiptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateWindowsReceiptResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/ValidateWindowsStoreReceipt", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnValidateWindowsStoreReceiptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateWindowsReceiptResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnValidateWindowsStoreReceiptResult(CallRequestContainer& request)
@@ -3657,7 +3662,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::WriteCharacterEvent(
+    PlayFabRequestHandle PlayFabClientAPI::WriteCharacterEvent(
         WriteClientCharacterEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -3667,7 +3672,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/WriteCharacterEvent", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnWriteCharacterEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/WriteCharacterEvent", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnWriteCharacterEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnWriteCharacterEventResult(CallRequestContainer& request)
@@ -3684,7 +3689,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::WritePlayerEvent(
+    PlayFabRequestHandle PlayFabClientAPI::WritePlayerEvent(
         WriteClientPlayerEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -3694,7 +3699,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/WritePlayerEvent", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnWritePlayerEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/WritePlayerEvent", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnWritePlayerEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnWritePlayerEventResult(CallRequestContainer& request)
@@ -3711,7 +3716,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabClientAPI::WriteTitleEvent(
+    PlayFabRequestHandle PlayFabClientAPI::WriteTitleEvent(
         WriteTitleEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -3721,7 +3726,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Client/WriteTitleEvent", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnWriteTitleEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Client/WriteTitleEvent", "X-Authorization", PlayFabSettings::clientSessionTicket, requestJson, OnWriteTitleEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabClientAPI::OnWriteTitleEventResult(CallRequestContainer& request)
@@ -15,6 +15,11 @@ namespace PlayFab
         return PlayFabHttp::Get().Update();
     }
 
+    size_t PlayFabEntityAPI::Update(size_t maxResults, std::chrono::microseconds timeBudget)
+    {
+        return PlayFabHttp::Get().Update(maxResults, timeBudget);
+    }
+
     void PlayFabEntityAPI::ForgetAllCredentials()
     {
         return PlayFabSettings::ForgetAllCredentials();
@@ -22,7 +27,7 @@ namespace PlayFab
 
     // PlayFabEntity APIs
 
-    void PlayFabEntityAPI::AbortFileUploads(
+    PlayFabRequestHandle PlayFabEntityAPI::AbortFileUploads(
         AbortFileUploadsRequest& request,
         ProcessApiCallback<AbortFileUploadsResponse> callback,
         ErrorCallback errorCallback,
@@ -32,7 +37,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/File/AbortFileUploads", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAbortFileUploadsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AbortFileUploadsResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/File/AbortFileUploads", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAbortFileUploadsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AbortFileUploadsResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnAbortFileUploadsResult(CallRequestContainer& request)
@@ -49,7 +54,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::AcceptGroupApplication(
+    PlayFabRequestHandle PlayFabEntityAPI::AcceptGroupApplication(
         AcceptGroupApplicationRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -59,7 +64,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/AcceptGroupApplication", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAcceptGroupApplicationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/AcceptGroupApplication", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAcceptGroupApplicationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnAcceptGroupApplicationResult(CallRequestContainer& request)
@@ -76,7 +81,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::AcceptGroupInvitation(
+    PlayFabRequestHandle PlayFabEntityAPI::AcceptGroupInvitation(
         AcceptGroupInvitationRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -86,7 +91,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/AcceptGroupInvitation", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAcceptGroupInvitationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/AcceptGroupInvitation", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAcceptGroupInvitationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnAcceptGroupInvitationResult(CallRequestContainer& request)
@@ -103,7 +108,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::AddMembers(
+    PlayFabRequestHandle PlayFabEntityAPI::AddMembers(
         AddMembersRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -113,7 +118,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/AddMembers", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAddMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/AddMembers", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnAddMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnAddMembersResult(CallRequestContainer& request)
@@ -130,7 +135,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::ApplyToGroup(
+    PlayFabRequestHandle PlayFabEntityAPI::ApplyToGroup(
         ApplyToGroupRequest& request,
         ProcessApiCallback<ApplyToGroupResponse> callback,
         ErrorCallback errorCallback,
@@ -140,7 +145,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ApplyToGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnApplyToGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ApplyToGroupResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/ApplyToGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnApplyToGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ApplyToGroupResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnApplyToGroupResult(CallRequestContainer& request)
@@ -157,7 +162,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::BlockEntity(
+    PlayFabRequestHandle PlayFabEntityAPI::BlockEntity(
         BlockEntityRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -167,7 +172,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/BlockEntity", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnBlockEntityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/BlockEntity", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnBlockEntityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnBlockEntityResult(CallRequestContainer& request)
@@ -184,7 +189,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::ChangeMemberRole(
+    PlayFabRequestHandle PlayFabEntityAPI::ChangeMemberRole(
         ChangeMemberRoleRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -194,7 +199,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ChangeMemberRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnChangeMemberRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/ChangeMemberRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnChangeMemberRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnChangeMemberRoleResult(CallRequestContainer& request)
@@ -211,7 +216,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::CreateGroup(
+    PlayFabRequestHandle PlayFabEntityAPI::CreateGroup(
         CreateGroupRequest& request,
         ProcessApiCallback<CreateGroupResponse> callback,
         ErrorCallback errorCallback,
@@ -221,7 +226,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/CreateGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnCreateGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateGroupResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/CreateGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnCreateGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateGroupResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnCreateGroupResult(CallRequestContainer& request)
@@ -238,7 +243,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::CreateRole(
+    PlayFabRequestHandle PlayFabEntityAPI::CreateRole(
         CreateGroupRoleRequest& request,
         ProcessApiCallback<CreateGroupRoleResponse> callback,
         ErrorCallback errorCallback,
@@ -248,7 +253,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/CreateRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnCreateRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateGroupRoleResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/CreateRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnCreateRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateGroupRoleResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnCreateRoleResult(CallRequestContainer& request)
@@ -265,7 +270,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::DeleteFiles(
+    PlayFabRequestHandle PlayFabEntityAPI::DeleteFiles(
         DeleteFilesRequest& request,
         ProcessApiCallback<DeleteFilesResponse> callback,
         ErrorCallback errorCallback,
@@ -275,7 +280,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/File/DeleteFiles", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnDeleteFilesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteFilesResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/File/DeleteFiles", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnDeleteFilesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteFilesResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnDeleteFilesResult(CallRequestContainer& request)
@@ -292,7 +297,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::DeleteGroup(
+    PlayFabRequestHandle PlayFabEntityAPI::DeleteGroup(
         DeleteGroupRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -302,7 +307,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/DeleteGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnDeleteGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/DeleteGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnDeleteGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnDeleteGroupResult(CallRequestContainer& request)
@@ -319,7 +324,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::DeleteRole(
+    PlayFabRequestHandle PlayFabEntityAPI::DeleteRole(
         DeleteRoleRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -329,7 +334,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/DeleteRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnDeleteRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/DeleteRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnDeleteRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnDeleteRoleResult(CallRequestContainer& request)
@@ -346,7 +351,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::FinalizeFileUploads(
+    PlayFabRequestHandle PlayFabEntityAPI::FinalizeFileUploads(
         FinalizeFileUploadsRequest& request,
         ProcessApiCallback<FinalizeFileUploadsResponse> callback,
         ErrorCallback errorCallback,
@@ -356,7 +361,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/File/FinalizeFileUploads", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnFinalizeFileUploadsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<FinalizeFileUploadsResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/File/FinalizeFileUploads", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnFinalizeFileUploadsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<FinalizeFileUploadsResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnFinalizeFileUploadsResult(CallRequestContainer& request)
@@ -373,7 +378,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::GetEntityToken(
+    PlayFabRequestHandle PlayFabEntityAPI::GetEntityToken(
         GetEntityTokenRequest& request,
         ProcessApiCallback<GetEntityTokenResponse> callback,
         ErrorCallback errorCallback,
@@ -391,7 +396,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Authentication/GetEntityToken", authKey, authValue, requestJson, OnGetEntityTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityTokenResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Authentication/GetEntityToken", authKey, authValue, requestJson, OnGetEntityTokenResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityTokenResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnGetEntityTokenResult(CallRequestContainer& request)
@@ -409,7 +414,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::GetFiles(
+    PlayFabRequestHandle PlayFabEntityAPI::GetFiles(
         GetFilesRequest& request,
         ProcessApiCallback<GetFilesResponse> callback,
         ErrorCallback errorCallback,
@@ -419,7 +424,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/File/GetFiles", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetFilesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFilesResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/File/GetFiles", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetFilesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFilesResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnGetFilesResult(CallRequestContainer& request)
@@ -436,7 +441,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::GetGlobalPolicy(
+    PlayFabRequestHandle PlayFabEntityAPI::GetGlobalPolicy(
         GetGlobalPolicyRequest& request,
         ProcessApiCallback<GetGlobalPolicyResponse> callback,
         ErrorCallback errorCallback,
@@ -446,7 +451,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Profile/GetGlobalPolicy", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetGlobalPolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetGlobalPolicyResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Profile/GetGlobalPolicy", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetGlobalPolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetGlobalPolicyResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnGetGlobalPolicyResult(CallRequestContainer& request)
@@ -463,7 +468,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::GetGroup(
+    PlayFabRequestHandle PlayFabEntityAPI::GetGroup(
         GetGroupRequest& request,
         ProcessApiCallback<GetGroupResponse> callback,
         ErrorCallback errorCallback,
@@ -473,7 +478,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/GetGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetGroupResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/GetGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetGroupResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnGetGroupResult(CallRequestContainer& request)
@@ -490,7 +495,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::GetObjects(
+    PlayFabRequestHandle PlayFabEntityAPI::GetObjects(
         GetObjectsRequest& request,
         ProcessApiCallback<GetObjectsResponse> callback,
         ErrorCallback errorCallback,
@@ -500,7 +505,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Object/GetObjects", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetObjectsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetObjectsResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Object/GetObjects", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetObjectsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetObjectsResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnGetObjectsResult(CallRequestContainer& request)
@@ -517,7 +522,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::GetProfile(
+    PlayFabRequestHandle PlayFabEntityAPI::GetProfile(
         GetEntityProfileRequest& request,
         ProcessApiCallback<GetEntityProfileResponse> callback,
         ErrorCallback errorCallback,
@@ -527,7 +532,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Profile/GetProfile", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityProfileResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Profile/GetProfile", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnGetProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityProfileResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnGetProfileResult(CallRequestContainer& request)
@@ -544,7 +549,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::InitiateFileUploads(
+    PlayFabRequestHandle PlayFabEntityAPI::InitiateFileUploads(
         InitiateFileUploadsRequest& request,
         ProcessApiCallback<InitiateFileUploadsResponse> callback,
         ErrorCallback errorCallback,
@@ -554,7 +559,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/File/InitiateFileUploads", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnInitiateFileUploadsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<InitiateFileUploadsResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/File/InitiateFileUploads", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnInitiateFileUploadsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<InitiateFileUploadsResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnInitiateFileUploadsResult(CallRequestContainer& request)
@@ -571,7 +576,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::InviteToGroup(
+    PlayFabRequestHandle PlayFabEntityAPI::InviteToGroup(
         InviteToGroupRequest& request,
         ProcessApiCallback<InviteToGroupResponse> callback,
         ErrorCallback errorCallback,
@@ -581,7 +586,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/InviteToGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnInviteToGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<InviteToGroupResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/InviteToGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnInviteToGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<InviteToGroupResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnInviteToGroupResult(CallRequestContainer& request)
@@ -598,7 +603,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::IsMember(
+    PlayFabRequestHandle PlayFabEntityAPI::IsMember(
         IsMemberRequest& request,
         ProcessApiCallback<IsMemberResponse> callback,
         ErrorCallback errorCallback,
@@ -608,7 +613,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/IsMember", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnIsMemberResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IsMemberResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/IsMember", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnIsMemberResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<IsMemberResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnIsMemberResult(CallRequestContainer& request)
@@ -625,7 +630,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::ListGroupApplications(
+    PlayFabRequestHandle PlayFabEntityAPI::ListGroupApplications(
         ListGroupApplicationsRequest& request,
         ProcessApiCallback<ListGroupApplicationsResponse> callback,
         ErrorCallback errorCallback,
@@ -635,7 +640,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListGroupApplications", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupApplicationsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupApplicationsResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/ListGroupApplications", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupApplicationsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupApplicationsResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnListGroupApplicationsResult(CallRequestContainer& request)
@@ -652,7 +657,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::ListGroupBlocks(
+    PlayFabRequestHandle PlayFabEntityAPI::ListGroupBlocks(
         ListGroupBlocksRequest& request,
         ProcessApiCallback<ListGroupBlocksResponse> callback,
         ErrorCallback errorCallback,
@@ -662,7 +667,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListGroupBlocks", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupBlocksResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupBlocksResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/ListGroupBlocks", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupBlocksResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupBlocksResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnListGroupBlocksResult(CallRequestContainer& request)
@@ -679,7 +684,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::ListGroupInvitations(
+    PlayFabRequestHandle PlayFabEntityAPI::ListGroupInvitations(
         ListGroupInvitationsRequest& request,
         ProcessApiCallback<ListGroupInvitationsResponse> callback,
         ErrorCallback errorCallback,
@@ -689,7 +694,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListGroupInvitations", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupInvitationsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupInvitationsResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/ListGroupInvitations", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupInvitationsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupInvitationsResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnListGroupInvitationsResult(CallRequestContainer& request)
@@ -706,7 +711,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::ListGroupMembers(
+    PlayFabRequestHandle PlayFabEntityAPI::ListGroupMembers(
         ListGroupMembersRequest& request,
         ProcessApiCallback<ListGroupMembersResponse> callback,
         ErrorCallback errorCallback,
@@ -716,7 +721,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListGroupMembers", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupMembersResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/ListGroupMembers", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListGroupMembersResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnListGroupMembersResult(CallRequestContainer& request)
@@ -733,7 +738,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::ListMembership(
+    PlayFabRequestHandle PlayFabEntityAPI::ListMembership(
         ListMembershipRequest& request,
         ProcessApiCallback<ListMembershipResponse> callback,
         ErrorCallback errorCallback,
@@ -743,7 +748,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListMembership", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListMembershipResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListMembershipResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/ListMembership", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListMembershipResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListMembershipResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnListMembershipResult(CallRequestContainer& request)
@@ -760,7 +765,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::ListMembershipOpportunities(
+    PlayFabRequestHandle PlayFabEntityAPI::ListMembershipOpportunities(
         ListMembershipOpportunitiesRequest& request,
         ProcessApiCallback<ListMembershipOpportunitiesResponse> callback,
         ErrorCallback errorCallback,
@@ -770,7 +775,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/ListMembershipOpportunities", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListMembershipOpportunitiesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListMembershipOpportunitiesResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/ListMembershipOpportunities", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnListMembershipOpportunitiesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListMembershipOpportunitiesResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnListMembershipOpportunitiesResult(CallRequestContainer& request)
@@ -787,7 +792,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::RemoveGroupApplication(
+    PlayFabRequestHandle PlayFabEntityAPI::RemoveGroupApplication(
         RemoveGroupApplicationRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -797,7 +802,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/RemoveGroupApplication", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnRemoveGroupApplicationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/RemoveGroupApplication", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnRemoveGroupApplicationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnRemoveGroupApplicationResult(CallRequestContainer& request)
@@ -814,7 +819,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::RemoveGroupInvitation(
+    PlayFabRequestHandle PlayFabEntityAPI::RemoveGroupInvitation(
         RemoveGroupInvitationRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -824,7 +829,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/RemoveGroupInvitation", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnRemoveGroupInvitationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/RemoveGroupInvitation", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnRemoveGroupInvitationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnRemoveGroupInvitationResult(CallRequestContainer& request)
@@ -841,7 +846,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::RemoveMembers(
+    PlayFabRequestHandle PlayFabEntityAPI::RemoveMembers(
         RemoveMembersRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -851,7 +856,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/RemoveMembers", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnRemoveMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/RemoveMembers", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnRemoveMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnRemoveMembersResult(CallRequestContainer& request)
@@ -868,7 +873,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::SetGlobalPolicy(
+    PlayFabRequestHandle PlayFabEntityAPI::SetGlobalPolicy(
         SetGlobalPolicyRequest& request,
         ProcessApiCallback<SetGlobalPolicyResponse> callback,
         ErrorCallback errorCallback,
@@ -878,7 +883,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Profile/SetGlobalPolicy", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnSetGlobalPolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGlobalPolicyResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Profile/SetGlobalPolicy", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnSetGlobalPolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGlobalPolicyResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnSetGlobalPolicyResult(CallRequestContainer& request)
@@ -895,7 +900,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::SetObjects(
+    PlayFabRequestHandle PlayFabEntityAPI::SetObjects(
         SetObjectsRequest& request,
         ProcessApiCallback<SetObjectsResponse> callback,
         ErrorCallback errorCallback,
@@ -905,7 +910,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Object/SetObjects", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnSetObjectsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetObjectsResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Object/SetObjects", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnSetObjectsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetObjectsResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnSetObjectsResult(CallRequestContainer& request)
@@ -922,7 +927,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::SetProfilePolicy(
+    PlayFabRequestHandle PlayFabEntityAPI::SetProfilePolicy(
         SetEntityProfilePolicyRequest& request,
         ProcessApiCallback<SetEntityProfilePolicyResponse> callback,
         ErrorCallback errorCallback,
@@ -932,7 +937,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Profile/SetProfilePolicy", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnSetProfilePolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetEntityProfilePolicyResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Profile/SetProfilePolicy", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnSetProfilePolicyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetEntityProfilePolicyResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnSetProfilePolicyResult(CallRequestContainer& request)
@@ -949,7 +954,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::UnblockEntity(
+    PlayFabRequestHandle PlayFabEntityAPI::UnblockEntity(
         UnblockEntityRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -959,7 +964,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/UnblockEntity", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnUnblockEntityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/UnblockEntity", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnUnblockEntityResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnUnblockEntityResult(CallRequestContainer& request)
@@ -976,7 +981,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::UpdateGroup(
+    PlayFabRequestHandle PlayFabEntityAPI::UpdateGroup(
         UpdateGroupRequest& request,
         ProcessApiCallback<UpdateGroupResponse> callback,
         ErrorCallback errorCallback,
@@ -986,7 +991,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/UpdateGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnUpdateGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateGroupResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/UpdateGroup", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnUpdateGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateGroupResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnUpdateGroupResult(CallRequestContainer& request)
@@ -1003,7 +1008,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEntityAPI::UpdateRole(
+    PlayFabRequestHandle PlayFabEntityAPI::UpdateRole(
         UpdateGroupRoleRequest& request,
         ProcessApiCallback<UpdateGroupRoleResponse> callback,
         ErrorCallback errorCallback,
@@ -1013,7 +1018,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Group/UpdateRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnUpdateRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateGroupRoleResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Group/UpdateRole", "X-EntityToken", PlayFabSettings::entityToken, requestJson, OnUpdateRoleResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateGroupRoleResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabEntityAPI::OnUpdateRoleResult(CallRequestContainer& request)
@@ -0,0 +1,409 @@
+#include <gsdkCommonPch.h>
+
+#ifdef ENABLE_PLAYFABSERVER_API
+
+#include <playfab/PlayFabEventPipeline.h>
+#include <playfab/PlayFabSettings.h>
+#include <gsdkInternal.h>
+#include <algorithm>
+
+namespace PlayFab
+{
+    constexpr unsigned int PlayFabEventPipeline::c_maxBatchSize;
+
+    std::atomic<uint64_t> PlayFabEventPipeline::statEventsQueued(0);
+    std::atomic<uint64_t> PlayFabEventPipeline::statEventsDropped(0);
+    std::atomic<uint64_t> PlayFabEventPipeline::statEventsSent(0);
+    std::atomic<uint64_t> PlayFabEventPipeline::statEventsSucceeded(0);
+    std::atomic<uint64_t> PlayFabEventPipeline::statEventsFailed(0);
+    std::atomic<uint64_t> PlayFabEventPipeline::statBatchesSent(0);
+    std::atomic<uint64_t> PlayFabEventPipeline::statLatencyTotalMicroseconds(0);
+    std::atomic<uint64_t> PlayFabEventPipeline::statLatencyMaxMicroseconds(0);
+
+    PlayFabEventPipeline& PlayFabEventPipeline::Get()
+    {
+        static PlayFabEventPipeline instance;
+        return instance;
+    }
+
+    PlayFabEventPipeline::PlayFabEventPipeline() :
+        enqueuePosition(0),
+        dequeuePosition(0),
+        queuedEvents(0),
+        accepting(true),
+        activeProducers(0),
+        flushRequested(false),
+        stopRequested(false),
+        abandonRequested(false),
+        shutdownDeadline(),
+        undelivered(0),
+        droppedReported(0)
+    {
+        size_t capacity = 2;
+        while (capacity < PlayFabSettings::eventQueueCapacity)
+            capacity <<= 1;
+        queueMask = capacity - 1;
+        batchSize = std::max(1u, std::min(PlayFabSettings::eventBatchSize, c_maxBatchSize));
+        flushInterval = std::chrono::milliseconds(std::max(1u, PlayFabSettings::eventFlushIntervalMs));
+        requestsInFlight = std::max(1u, PlayFabSettings::eventBatchesInFlight);
+
+        slots.reset(new QueueSlot[capacity]);
+        for (size_t i = 0; i < capacity; ++i)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        batch.reserve(batchSize);
+
+        flushThread = std::thread(&PlayFabEventPipeline::FlushThread, this);
+    }
+
+    PlayFabEventPipeline::~PlayFabEventPipeline()
+    {
+        // Shutdown() is what sends the queue; at exit PlayFabHttp may already be gone
+        { // LOCK pipelineMutex
+            std::unique_lock<std::mutex> lock(pipelineMutex);
+            abandonRequested = true;
+        } // UNLOCK pipelineMutex
+        flushNeeded.notify_all();
+        if (flushThread.joinable())
+            flushThread.join();
+    }
+
+    bool PlayFabEventPipeline::WritePlayerEvent(ServerModels::WriteServerPlayerEventRequest& request)
+    {
+        QueuedEvent event;
+        event.playerEvent = true;
+        event.eventName.swap(request.EventName);
+        event.playFabId.swap(request.PlayFabId);
+        event.body.swap(request.Body);
+        event.timestamp = request.Timestamp.notNull() ? request.Timestamp.mValue : time(nullptr);
+        return Enqueue(event);
+    }
+
+    bool PlayFabEventPipeline::WriteTitleEvent(ServerModels::WriteTitleEventRequest& request)
+    {
+        QueuedEvent event;
+        event.playerEvent = false;
+        event.eventName.swap(request.EventName);
+        event.body.swap(request.Body);
+        event.timestamp = request.Timestamp.notNull() ? request.Timestamp.mValue : time(nullptr);
+        return Enqueue(event);
+    }
+
+    bool PlayFabEventPipeline::Enqueue(QueuedEvent& event)
+    {
+        // Counted before the check (both sequentially consistent), so once Shutdown has stopped accepting, the flush
+        // thread sees every producer that got past it and waits for its event before the final drain
+        ++activeProducers;
+        if (!accepting)
+        {
+            --activeProducers;
+            ++statEventsDropped;
+            return false;
+        }
+        event.enqueueMicroseconds = NowMicroseconds();
+
+        QueueSlot* slot;
+        size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            slot = &slots[position & queueMask];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0)
+            {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+            {
+                --activeProducers;
+                ++statEventsDropped; // full: the flush thread hasn't taken this slot's previous event yet
+                return false;
+            }
+            else
+            {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->event.playerEvent = event.playerEvent;
+        slot->event.eventName.swap(event.eventName);
+        slot->event.playFabId.swap(event.playFabId);
+        slot->event.body.swap(event.body);
+        slot->event.timestamp = event.timestamp;
+        slot->event.enqueueMicroseconds = event.enqueueMicroseconds;
+        slot->sequence.store(position + 1, std::memory_order_release);
+        ++statEventsQueued;
+
+        if (queuedEvents.fetch_add(1) + 1 == batchSize)
+        {
+            { // LOCK pipelineMutex, so the flush thread can't miss the notification between its check and its wait
+                std::unique_lock<std::mutex> lock(pipelineMutex);
+            } // UNLOCK pipelineMutex
+            flushNeeded.notify_one();
+        }
+        --activeProducers;
+        return true;
+    }
+
+    bool PlayFabEventPipeline::Dequeue(QueuedEvent& event)
+    {
+        QueueSlot& slot = slots[dequeuePosition & queueMask];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1)
+            return false;
+
+        event.playerEvent = slot.event.playerEvent;
+        event.eventName.swap(slot.event.eventName);
+        event.playFabId.swap(slot.event.playFabId);
+        event.body.swap(slot.event.body);
+        event.timestamp = slot.event.timestamp;
+        event.enqueueMicroseconds = slot.event.enqueueMicroseconds;
+        slot.sequence.store(dequeuePosition + queueMask + 1, std::memory_order_release);
+        ++dequeuePosition;
+        --queuedEvents;
+        return true;
+    }
+
+    void PlayFabEventPipeline::Flush()
+    {
+        { // LOCK pipelineMutex
+            std::unique_lock<std::mutex> lock(pipelineMutex);
+            flushRequested = true;
+        } // UNLOCK pipelineMutex
+        flushNeeded.notify_one();
+    }
+
+    size_t PlayFabEventPipeline::Shutdown(std::chrono::milliseconds timeout)
+    {
+        accepting = false;
+        { // LOCK pipelineMutex
+            std::unique_lock<std::mutex> lock(pipelineMutex);
+            if (!stopRequested)
+            {
+                stopRequested = true;
+                shutdownDeadline = std::chrono::steady_clock::now() + timeout;
+            }
+        } // UNLOCK pipelineMutex
+        flushNeeded.notify_all();
+        if (flushThread.joinable())
+            flushThread.join();
+
+        std::unique_lock<std::mutex> lock(pipelineMutex);
+        return undelivered;
+    }
+
+    void PlayFabEventPipeline::FlushThread()
+    {
+        bool flushDue = false;
+        auto nextFlush = std::chrono::steady_clock::now() + flushInterval;
+        for (;;)
+        {
+            const size_t outstanding = ReapRequests();
+            bool stop;
+            std::chrono::steady_clock::time_point deadline;
+            { // LOCK pipelineMutex
+                std::unique_lock<std::mutex> lock(pipelineMutex);
+                if (abandonRequested)
+                    return;
+                flushDue = flushDue || flushRequested;
+                flushRequested = false;
+                stop = stopRequested;
+                deadline = shutdownDeadline;
+            } // UNLOCK pipelineMutex
+
+            const uint64_t dropped = statEventsDropped;
+            if (dropped != droppedReported)
+            {
+                GSDK_LOG_THROTTLED(Warning, PlayFabEventsDropped, static_cast<unsigned int>(dropped - droppedReported), static_cast<unsigned int>(queueMask + 1));
+                droppedReported = dropped;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= nextFlush)
+            {
+                flushDue = true;
+                nextFlush = now + flushInterval;
+            }
+            if (stop && now >= deadline)
+                break;
+
+            const size_t queued = queuedEvents;
+            if (queued > 0 && (queued >= batchSize || flushDue || stop) && outstanding < requestsInFlight)
+            {
+                const size_t sent = SendBatch(requestsInFlight - outstanding);
+                // Sending one event per request can run out of requests first: the rest goes out as they complete
+                flushDue = (flushDue || (sent < batchSize && sent < queued)) && queuedEvents > 0;
+                continue;
+            }
+            if (queued == 0)
+                flushDue = false;
+            if (stop && queued == 0 && outstanding == 0)
+                break;
+
+            // Only a request completing can let anything more be sent before the next flush
+            const auto wakeAt = stop ? std::min(nextFlush, deadline) : nextFlush;
+            if (outstanding >= requestsInFlight || stop)
+            {
+                const auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(wakeAt - now) + std::chrono::milliseconds(1);
+                inFlightRequests.front().handle.Wait(timeout);
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lock(pipelineMutex);
+                flushNeeded.wait_until(lock, wakeAt, [this]
+                {
+                    return abandonRequested || stopRequested || flushRequested || queuedEvents >= batchSize;
+                });
+            }
+        }
+
+        // Shutting down: cancel what is still outstanding, and drop what never got sent
+        size_t notDelivered = 0;
+        ReapRequests();
+        for (InFlightRequest& inFlight : inFlightRequests)
+        {
+            if (!inFlight.handle.IsDone())
+            {
+                inFlight.handle.Cancel();
+                notDelivered += inFlight.eventCount;
+            }
+        }
+        inFlightRequests.clear();
+
+        // A producer that got past the accepting check before Shutdown may still be publishing its event
+        while (activeProducers != 0)
+            std::this_thread::yield();
+
+        QueuedEvent event;
+        while (Dequeue(event))
+        {
+            ++statEventsDropped;
+            ++notDelivered;
+        }
+
+        std::unique_lock<std::mutex> lock(pipelineMutex);
+        undelivered = notDelivered;
+    }
+
+    size_t PlayFabEventPipeline::SendBatch(size_t maxRequests)
+    {
+        IPlayFabHttp& http = IPlayFabHttp::Get();
+        const std::string eventNamespace = PlayFabSettings::eventNamespace;
+        const std::string entityToken = PlayFabSettings::entityToken;
+        const bool writeEvents = !eventNamespace.empty() && !entityToken.empty();
+
+        // Without Event/WriteEvents every event is a request of its own
+        const size_t maxEvents = writeEvents ? batchSize : std::min(batchSize, maxRequests);
+        batch.clear();
+        while (batch.size() < maxEvents)
+        {
+            batch.emplace_back();
+            if (!Dequeue(batch.back()))
+            {
+                batch.pop_back();
+                break;
+            }
+        }
+        if (batch.empty())
+            return 0;
+
+        const size_t requestsBefore = inFlightRequests.size();
+        if (writeEvents)
+        {
+            std::shared_ptr<BatchInfo> batchInfo = std::make_shared<BatchInfo>();
+            batchInfo->eventCount = batch.size();
+            batchInfo->enqueueMicrosecondsTotal = 0;
+            batchInfo->oldestEnqueueMicroseconds = batch.front().enqueueMicroseconds;
+
+            Json::Value requestJson;
+            Json::Value& events = requestJson["Events"];
+            events = Json::Value(Json::arrayValue);
+            for (QueuedEvent& queued : batch)
+            {
+                Json::Value& each = events.append(Json::Value(Json::objectValue));
+                Json::Value& entity = each["Entity"];
+                entity["Id"] = queued.playerEvent ? queued.playFabId : PlayFabSettings::titleId;
+                entity["Type"] = queued.playerEvent ? "master_player_account" : "title";
+                each["EventNamespace"] = eventNamespace;
+                each["Name"] = queued.eventName;
+                ToJsonUtilT(queued.timestamp, each["OriginalTimestamp"]);
+                each["Payload"].swap(queued.body);
+                batchInfo->enqueueMicrosecondsTotal += queued.enqueueMicroseconds;
+            }
+
+            inFlightRequests.push_back({ http.AddRequestWithHandle("/Event/WriteEvents", "X-EntityToken", entityToken, requestJson, OnWriteEventsResult, batchInfo,
+                [batchInfo](const PlayFabError&, void*) { RecordResult(*batchInfo, false); }, nullptr), batch.size() });
+        }
+        else
+        {
+            for (QueuedEvent& queued : batch)
+            {
+                std::shared_ptr<BatchInfo> batchInfo = std::make_shared<BatchInfo>();
+                batchInfo->eventCount = 1;
+                batchInfo->enqueueMicrosecondsTotal = queued.enqueueMicroseconds;
+                batchInfo->oldestEnqueueMicroseconds = queued.enqueueMicroseconds;
+
+                Json::Value requestJson;
+                requestJson["Body"].swap(queued.body);
+                requestJson["EventName"] = queued.eventName;
+                if (queued.playerEvent)
+                    requestJson["PlayFabId"] = queued.playFabId;
+                ToJsonUtilT(queued.timestamp, requestJson["Timestamp"]);
+
+                inFlightRequests.push_back({ http.AddRequestWithHandle(queued.playerEvent ? "/Server/WritePlayerEvent" : "/Server/WriteTitleEvent", "X-SecretKey", PlayFabSettings::developerSecretKey,
+                    requestJson, OnWriteEventsResult, batchInfo, [batchInfo](const PlayFabError&, void*) { RecordResult(*batchInfo, false); }, nullptr), 1 });
+            }
+        }
+
+        statEventsSent += batch.size();
+        statBatchesSent += inFlightRequests.size() - requestsBefore;
+        return batch.size();
+    }
+
+    size_t PlayFabEventPipeline::ReapRequests()
+    {
+        inFlightRequests.erase(std::remove_if(inFlightRequests.begin(), inFlightRequests.end(), [](const InFlightRequest& inFlight)
+        {
+            return inFlight.handle.IsDone();
+        }), inFlightRequests.end());
+        return inFlightRequests.size();
+    }
+
+    int64_t PlayFabEventPipeline::NowMicroseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void PlayFabEventPipeline::RecordResult(const BatchInfo& batchInfo, bool succeeded)
+    {
+        const int64_t now = NowMicroseconds();
+        (succeeded ? statEventsSucceeded : statEventsFailed) += batchInfo.eventCount;
+        statLatencyTotalMicroseconds += static_cast<uint64_t>(now * static_cast<int64_t>(batchInfo.eventCount) - batchInfo.enqueueMicrosecondsTotal);
+
+        const uint64_t latency = static_cast<uint64_t>(now - batchInfo.oldestEnqueueMicroseconds);
+        uint64_t maxLatency = statLatencyMaxMicroseconds;
+        while (latency > maxLatency && !statLatencyMaxMicroseconds.compare_exchange_weak(maxLatency, latency))
+        {
+        }
+    }
+
+    void PlayFabEventPipeline::OnWriteEventsResult(CallRequestContainer& request)
+    {
+        RecordResult(*static_cast<BatchInfo*>(request.successCallback.get()), true);
+    }
+
+    PlayFabEventPipelineStats PlayFabEventPipeline::GetStats()
+    {
+        PlayFabEventPipelineStats stats;
+        stats.eventsQueued = statEventsQueued;
+        stats.eventsDropped = statEventsDropped;
+        stats.eventsSent = statEventsSent;
+        stats.eventsSucceeded = statEventsSucceeded;
+        stats.eventsFailed = statEventsFailed;
+        stats.batchesSent = statBatchesSent;
+        stats.latencyTotalMicroseconds = statLatencyTotalMicroseconds;
+        stats.latencyMaxMicroseconds = statLatencyMaxMicroseconds;
+        return stats;
+    }
+}
+
+#endif
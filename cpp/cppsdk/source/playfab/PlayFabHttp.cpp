@@ -2,7 +2,22 @@
 
 #include <playfab/PlayFabHttp.h>
 #include <playfab/PlayFabSettings.h>
+#include <gsdkInternal.h>
+#include <gsdkTrace.h>
 #include <exception>
+#ifdef ENABLE_PLAYFAB_GZIP_REQUESTS
+#include <zlib.h>
+#endif
+
+#ifdef GSDK_LINUX
+#include <time.h>
+#endif
+
+// curl_multi_poll and curl_multi_wakeup need libcurl 7.68. Before that (Ubuntu 18.04 has 7.58) nothing can interrupt
+// a busy worker's curl_multi_wait, so it waits at most c_pollWithoutWakeupMs before looking for new requests.
+#if LIBCURL_VERSION_NUM >= 0x074400
+#define PLAYFAB_CURL_MULTI_WAKEUP
+#endif
 
 namespace PlayFab
 {
@@ -16,18 +31,144 @@ namespace PlayFab
         errorWrapper(),
         internalCallback(nullptr),
         successCallback(nullptr),
-        errorCallback(nullptr)
+        errorCallback(nullptr),
+        queueWaitMicroseconds(0),
+        traceStartNs(0),
+        retryCount(0),
+        circuitProbe(0),
+        cacheTtl(0),
+        cachedResult(false),
+        nextResult(nullptr)
     {
     }
 
     CallRequestContainer::~CallRequestContainer()
     {
-        curl_easy_reset(curlHandle);
+        curlHandle = nullptr;
         curlHttpHeaders = nullptr;
     }
 
+    PlayFabRequestState::PlayFabRequestState() :
+        http(nullptr),
+        cancelled(false),
+        deadlineNs(0),
+        done(false)
+    {
+    }
+
+    void PlayFabRequestState::MarkDone()
+    {
+        { // LOCK doneMutex
+            std::unique_lock<std::mutex> lock(doneMutex);
+            done = true;
+        } // UNLOCK doneMutex
+        doneCondition.notify_all();
+    }
+
+    PlayFabRequestHandle::PlayFabRequestHandle()
+    {
+    }
+
+    PlayFabRequestHandle::PlayFabRequestHandle(std::shared_ptr<PlayFabRequestState> state) : state(std::move(state))
+    {
+    }
+
+    bool PlayFabRequestHandle::IsValid() const
+    {
+        return state != nullptr;
+    }
+
+    void PlayFabRequestHandle::Cancel()
+    {
+        if (state == nullptr || IsDone())
+            return;
+        state->cancelled = true;
+        if (state->http != nullptr)
+            state->http->RequestSweep();
+    }
+
+    void PlayFabRequestHandle::SetDeadline(std::chrono::steady_clock::time_point deadline)
+    {
+        if (state == nullptr || IsDone())
+            return;
+        state->deadlineNs = std::max<int64_t>(1, std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count());
+        if (state->http != nullptr)
+            state->http->RequestSweep();
+    }
+
+    void PlayFabRequestHandle::SetTimeout(std::chrono::milliseconds timeout)
+    {
+        SetDeadline(std::chrono::steady_clock::now() + timeout);
+    }
+
+    bool PlayFabRequestHandle::IsDone() const
+    {
+        if (state == nullptr)
+            return true;
+        std::unique_lock<std::mutex> lock(state->doneMutex);
+        return state->done;
+    }
+
+    bool PlayFabRequestHandle::Wait(std::chrono::milliseconds timeout) const
+    {
+        if (state == nullptr)
+            return true;
+        std::unique_lock<std::mutex> lock(state->doneMutex);
+        return state->doneCondition.wait_for(lock, timeout, [this]() { return state->done; });
+    }
+
+    constexpr int64_t PlayFabHttp::c_maxResponseReserve;
+    constexpr int PlayFabHttp::c_pollWithoutWakeupMs;
+    constexpr int64_t PlayFabHttp::c_cancelWaitMs;
+
+    std::atomic<uint64_t> PlayFabHttp::statRequests(0);
+    std::atomic<uint64_t> PlayFabHttp::statRequestsCompressed(0);
+    std::atomic<uint64_t> PlayFabHttp::statRequestBodyBytes(0);
+    std::atomic<uint64_t> PlayFabHttp::statRequestWireBytes(0);
+    std::atomic<uint64_t> PlayFabHttp::statResponseBodyBytes(0);
+    std::atomic<uint64_t> PlayFabHttp::statResponseWireBytes(0);
+    std::atomic<uint64_t> PlayFabHttp::statSerializeMicroseconds(0);
+    std::atomic<uint64_t> PlayFabHttp::statCompressMicroseconds(0);
+    std::atomic<uint64_t> PlayFabHttp::statParseMicroseconds(0);
+    std::atomic<uint64_t> PlayFabHttp::statWorkerCpuMicroseconds(0);
+    std::atomic<uint64_t> PlayFabHttp::statRetries(0);
+    std::atomic<uint64_t> PlayFabHttp::statFailedFast(0);
+    std::atomic<uint64_t> PlayFabHttp::statCacheHits(0);
+    std::atomic<uint64_t> PlayFabHttp::statCacheMisses(0);
+    std::atomic<uint64_t> PlayFabHttp::statCacheJoined(0);
+
+    namespace
+    {
+        uint64_t MicrosecondsSince(std::chrono::steady_clock::time_point start)
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        }
+    }
+
     std::unique_ptr<IPlayFabHttp> IPlayFabHttp::httpInstance = nullptr;
     IPlayFabHttp::~IPlayFabHttp() = default;
+
+    PlayFabRequestHandle IPlayFabHttp::AddRequestWithHandle(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData)
+    {
+        AddRequest(urlPath, authKey, authValue, requestBody, internalCallback, successCallback, errorCallback, customData);
+        return PlayFabRequestHandle();
+    }
+
+    size_t IPlayFabHttp::Update(size_t maxResults, std::chrono::microseconds timeBudget)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        size_t remaining = 0;
+        for (size_t handled = 0; handled < maxResults; ++handled)
+        {
+            remaining = Update(); // how many were waiting, including the one it handled
+            if (remaining == 0)
+                break;
+            --remaining;
+            if (std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start) >= timeBudget)
+                break;
+        }
+        return remaining;
+    }
     IPlayFabHttp& IPlayFabHttp::Get()
     {
         // In the future we could make it easier to override this instance with a sub-type, for now it defaults to the only one we have
@@ -36,22 +177,57 @@ namespace PlayFab
         return *httpInstance.get();
     }
 
-    PlayFabHttp::PlayFabHttp()
+    PlayFabHttp::PlayFabHttp() : activeRequests(0), resultsHead(&resultsStub), resultsTail(&resultsStub), pendingResultCount(0), queueSweepRequested(false), nextQueueDeadline(std::chrono::steady_clock::time_point::max()), cancelAddedBeforeNs(0)
     {
+        curl_global_init(CURL_GLOBAL_GSDK_INIT_FLAGS);
+
+        curlShare = curl_share_init();
+        curl_share_setopt(curlShare, CURLSHOPT_LOCKFUNC, CurlShareLock);
+        curl_share_setopt(curlShare, CURLSHOPT_UNLOCKFUNC, CurlShareUnlock);
+        curl_share_setopt(curlShare, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(curlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(curlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
         threadRunning = true;
-        pfHttpWorkerThread = std::thread(&PlayFabHttp::WorkerThread, this);
+        const unsigned int workerCount = std::max(PlayFabSettings::httpWorkerThreads, 1u);
+        for (unsigned int i = 0; i < workerCount; ++i)
+        {
+            std::unique_ptr<HttpWorker> worker(new HttpWorker());
+            worker->curlMulti = curl_multi_init();
+            curl_multi_setopt(worker->curlMulti, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+            worker->jsonReader.reset(Json::CharReaderBuilder().newCharReader());
+            Json::StreamWriterBuilder jsonWriterFactory;
+            jsonWriterFactory["indentation"] = "";
+            worker->jsonWriter.reset(jsonWriterFactory.newStreamWriter());
+            pfHttpWorkers.push_back(std::move(worker));
+        }
+        for (std::unique_ptr<HttpWorker>& worker : pfHttpWorkers)
+            worker->thread = std::thread(&PlayFabHttp::WorkerThread, this, std::ref(*worker));
     };
 
     PlayFabHttp::~PlayFabHttp()
     {
-        threadRunning = false;
-        pfHttpWorkerThread.join();
+        { // LOCK httpRequestMutex
+            std::unique_lock<std::mutex> lock(httpRequestMutex);
+            threadRunning = false;
+        } // UNLOCK httpRequestMutex
+        requestAvailable.notify_all();
+        WakeWorkers();
+        for (std::unique_ptr<HttpWorker>& worker : pfHttpWorkers)
+            worker->thread.join();
+        pfHttpWorkers.clear();
+        curl_share_cleanup(curlShare);
+
         for (size_t i = 0; i < pendingRequests.size(); ++i)
             delete pendingRequests[i];
         pendingRequests.clear();
-        for (size_t i = 0; i < pendingResults.size(); ++i)
-            delete pendingResults[i];
-        pendingResults.clear();
+        while (CallRequestContainer* reqContainer = PopResult())
+            delete reqContainer;
+        readCache.RemoveWaiters([](CallRequestContainer& reqContainer)
+        {
+            delete &reqContainer;
+            return true;
+        });
     }
 
     void PlayFabHttp::MakeInstance()
@@ -64,85 +240,216 @@ namespace PlayFab
         }
     }
 
-    void PlayFabHttp::WorkerThread()
+    void PlayFabHttp::CurlShareLock(CURL*, curl_lock_data data, curl_lock_access, void* userData)
     {
-        size_t queueSize;
+        reinterpret_cast<PlayFabHttp*>(userData)->curlShareMutexes[data].lock();
+    }
 
-        while (this->threadRunning)
+    void PlayFabHttp::CurlShareUnlock(CURL*, curl_lock_data data, void* userData)
+    {
+        reinterpret_cast<PlayFabHttp*>(userData)->curlShareMutexes[data].unlock();
+    }
+
+    void PlayFabHttp::WorkerThread(HttpWorker& worker)
+    {
+        Microsoft::Azure::Gaming::GSDKTrace::setThreadName("PlayFab HTTP");
+        std::vector<CallRequestContainer*> startedRequests;
+        std::vector<CallRequestContainer*> abandonedRequests;
+        auto queueDeadline = std::chrono::steady_clock::time_point::max();
+        uint64_t cpuMicroseconds = GetThreadCpuMicroseconds();
+
+        while (true)
         {
-            CallRequestContainer* reqContainer = nullptr;
+            const uint64_t cpuMicrosecondsNow = GetThreadCpuMicroseconds();
+            statWorkerCpuMicroseconds += cpuMicrosecondsNow - cpuMicroseconds;
+            cpuMicroseconds = cpuMicrosecondsNow;
 
             { // LOCK httpRequestMutex
                 std::unique_lock<std::mutex> lock(this->httpRequestMutex);
+                const size_t maxActiveRequests = std::max(PlayFabSettings::maxConcurrentRequests, 1u);
+                if (worker.activeRequests.empty() && worker.retryRequests.empty())
+                {
+                    this->requestAvailable.wait(lock, [this, maxActiveRequests]()
+                    {
+                        return !this->threadRunning || this->queueSweepRequested || (!this->pendingRequests.empty() && this->activeRequests < maxActiveRequests);
+                    });
+                }
+                if (!this->threadRunning)
+                    break;
+
+                const auto now = std::chrono::steady_clock::now();
+                if (this->queueSweepRequested || now >= this->nextQueueDeadline)
+                    SweepQueue(now, abandonedRequests);
+                queueDeadline = this->nextQueueDeadline;
 
-                queueSize = this->pendingRequests.size();
-                if (queueSize != 0)
+                while (!this->pendingRequests.empty() && this->activeRequests < maxActiveRequests)
                 {
-                    reqContainer = this->pendingRequests[this->pendingRequests.size() - 1];
-                    this->pendingRequests.pop_back();
+                    startedRequests.push_back(this->pendingRequests.front());
+                    this->pendingRequests.pop_front();
+                    ++this->activeRequests;
                 }
             } // UNLOCK httpRequestMutex
 
-            if (queueSize == 0)
+            for (CallRequestContainer* reqContainer : abandonedRequests)
+                AbandonRequest(*reqContainer, false);
+            abandonedRequests.clear();
+
+            const auto dequeueTime = std::chrono::steady_clock::now();
+            while (!worker.retryRequests.empty() && worker.retryRequests.begin()->first <= dequeueTime)
             {
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                continue;
+                CallRequestContainer* reqContainer = worker.retryRequests.begin()->second;
+                worker.retryRequests.erase(worker.retryRequests.begin());
+                if (IsAbandoned(*reqContainer, dequeueTime))
+                    AbandonRequest(*reqContainer, true);
+                else if (retryPolicy.AllowRequest(dequeueTime, reqContainer->circuitProbe))
+                    StartRequest(worker, *reqContainer);
+                else
+                    FailFast(*reqContainer);
+            }
+
+            for (CallRequestContainer* reqContainer : startedRequests)
+            {
+                reqContainer->queueWaitMicroseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(dequeueTime - reqContainer->enqueueTime).count());
+                if (Microsoft::Azure::Gaming::GSDKTrace::isEnabled()) // GSDKTrace::now() reads the same steady clock
+                {
+                    Microsoft::Azure::Gaming::GSDKTrace::record("PlayFabHttp::QueueWait", "playfab",
+                        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(reqContainer->enqueueTime.time_since_epoch()).count()),
+                        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(dequeueTime.time_since_epoch()).count()));
+                }
+                if (IsAbandoned(*reqContainer, dequeueTime))
+                    AbandonRequest(*reqContainer, true);
+                else if (reqContainer->cachedResult)
+                    CompleteRequest(*reqContainer);
+                else if (retryPolicy.AllowRequest(dequeueTime, reqContainer->circuitProbe))
+                    StartRequest(worker, *reqContainer);
+                else
+                    FailFast(*reqContainer);
+            }
+            startedRequests.clear();
+
+            int runningHandles = 0;
+            curl_multi_perform(worker.curlMulti, &runningHandles);
+
+            int messagesLeft = 0;
+            while (CURLMsg* message = curl_multi_info_read(worker.curlMulti, &messagesLeft))
+            {
+                if (message->msg == CURLMSG_DONE)
+                    FinishRequest(worker, message->easy_handle, message->data.result);
+            }
+
+            // Wake up for the next retry or deadline, if it comes first
+            const auto now = std::chrono::steady_clock::now();
+            auto wakeTime = std::min(queueDeadline, SweepWorker(worker, now));
+            if (!worker.retryRequests.empty())
+                wakeTime = std::min(wakeTime, worker.retryRequests.begin()->first);
+            int pollTimeoutMs = 1000;
+            if (wakeTime != std::chrono::steady_clock::time_point::max())
+            {
+                const auto untilWake = std::chrono::duration_cast<std::chrono::milliseconds>(wakeTime - now).count();
+                pollTimeoutMs = static_cast<int>(std::max<int64_t>(0, std::min<int64_t>(pollTimeoutMs, untilWake + 1)));
+            }
+            if (!worker.activeRequests.empty() || !worker.retryRequests.empty())
+            {
+#ifdef PLAYFAB_CURL_MULTI_WAKEUP
+                curl_multi_poll(worker.curlMulti, nullptr, 0, pollTimeoutMs, nullptr);
+#else
+                // Unlike curl_multi_poll, curl_multi_wait returns at once when there is nothing to wait on
+                if (worker.activeRequests.empty())
+                    std::this_thread::sleep_for(std::chrono::milliseconds(std::min<int>(pollTimeoutMs, c_pollWithoutWakeupMs)));
+                else
+                    curl_multi_wait(worker.curlMulti, nullptr, 0, std::min<int>(pollTimeoutMs, c_pollWithoutWakeupMs), nullptr);
+#endif
             }
+        }
 
-            if (reqContainer != nullptr)
-                ExecuteRequest(*reqContainer);
+        // Shutting down, anything still in flight is dropped
+        for (CallRequestContainer* reqContainer : worker.activeRequests)
+        {
+            curl_multi_remove_handle(worker.curlMulti, reqContainer->curlHandle);
+            curl_easy_cleanup(reqContainer->curlHandle);
+            delete reqContainer;
         }
+        worker.activeRequests.clear();
+        for (auto& retryRequest : worker.retryRequests)
+            delete retryRequest.second;
+        worker.retryRequests.clear();
+        for (CURL* handle : worker.idleHandles)
+            curl_easy_cleanup(handle);
+        worker.idleHandles.clear();
+        for (auto& headerList : worker.headerLists)
+            curl_slist_free_all(headerList.second);
+        worker.headerLists.clear();
+        curl_multi_cleanup(worker.curlMulti);
     }
 
     void PlayFabHttp::HandleCallback(CallRequestContainer& reqContainer)
     {
         reqContainer.finished = true;
+        const std::shared_ptr<PlayFabRequestState> requestState = reqContainer.requestState; // Update() may delete the container
         if (PlayFabSettings::threadedCallbacks)
+        {
             HandleResults(reqContainer);
+            delete &reqContainer;
+            requestState->MarkDone();
+            return;
+        }
 
         PlayFabHttp& instance = reinterpret_cast<PlayFabHttp&>(Get());
-        if (!PlayFabSettings::threadedCallbacks)
-        {
-            { // LOCK httpRequestMutex
-                std::unique_lock<std::mutex> lock(instance.httpRequestMutex);
-                instance.pendingResults.push_back(&reqContainer);
-            } // UNLOCK httpRequestMutex
-        }
+        instance.PushResult(reqContainer);
+        requestState->MarkDone();
     }
 
     size_t PlayFabHttp::CurlReceiveData(char* buffer, size_t blockSize, size_t blockCount, void* userData)
     {
         CallRequestContainer* reqContainer = reinterpret_cast<CallRequestContainer*>(userData);
-        reqContainer->responseString.assign(buffer, blockSize * blockCount);
+        const size_t dataSize = blockSize * blockCount;
 
-        Json::CharReaderBuilder jsonReaderFactory;
-        Json::CharReader* jsonReader(jsonReaderFactory.newCharReader());
+        // Size the buffer once from Content-Length rather than growing it chunk by chunk
+        if (reqContainer->responseString.empty())
+        {
+            curl_off_t contentLength = -1;
+            if (curl_easy_getinfo(reqContainer->curlHandle, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &contentLength) == CURLE_OK &&
+                contentLength > static_cast<curl_off_t>(dataSize))
+            {
+                reqContainer->responseString.reserve(static_cast<size_t>(std::min<curl_off_t>(contentLength, c_maxResponseReserve)));
+            }
+        }
+        reqContainer->responseString.append(buffer, dataSize);
+        return dataSize;
+    }
+
+    void PlayFabHttp::ParseResponse(HttpWorker& worker, CallRequestContainer& reqContainer)
+    {
         JSONCPP_STRING jsonParseErrors;
-        const bool parsedSuccessfully = jsonReader->parse(reqContainer->responseString.c_str(), reqContainer->responseString.c_str() + reqContainer->responseString.length(), &reqContainer->responseJson, &jsonParseErrors);
+        const bool parsedSuccessfully = worker.jsonReader->parse(reqContainer.responseString.c_str(), reqContainer.responseString.c_str() + reqContainer.responseString.length(), &reqContainer.responseJson, &jsonParseErrors);
 
         if (parsedSuccessfully)
         {
-            reqContainer->errorWrapper.HttpCode = reqContainer->responseJson.get("code", Json::Value::null).asInt();
-            reqContainer->errorWrapper.HttpStatus = reqContainer->responseJson.get("status", Json::Value::null).asString();
-            reqContainer->errorWrapper.Data = reqContainer->responseJson.get("data", Json::Value::null);
-            reqContainer->errorWrapper.ErrorName = reqContainer->responseJson.get("error", Json::Value::null).asString();
-            reqContainer->errorWrapper.ErrorMessage = reqContainer->responseJson.get("errorMessage", Json::Value::null).asString();
-            reqContainer->errorWrapper.ErrorDetails = reqContainer->responseJson.get("errorDetails", Json::Value::null);
+            reqContainer.errorWrapper.HttpCode = reqContainer.responseJson.get("code", Json::Value::null).asInt();
+            reqContainer.errorWrapper.HttpStatus = reqContainer.responseJson.get("status", Json::Value::null).asString();
+            reqContainer.errorWrapper.ErrorCode = static_cast<PlayFabErrorCode>(reqContainer.responseJson.get("errorCode", PlayFabErrorSuccess).asInt());
+            reqContainer.errorWrapper.ErrorName = reqContainer.responseJson.get("error", Json::Value::null).asString();
+            reqContainer.errorWrapper.ErrorMessage = reqContainer.responseJson.get("errorMessage", Json::Value::null).asString();
+            reqContainer.errorWrapper.ErrorDetails = reqContainer.responseJson.get("errorDetails", Json::Value::null);
+            if (reqContainer.responseJson.isObject() && reqContainer.responseJson.isMember("data"))
+                reqContainer.errorWrapper.Data.swap(reqContainer.responseJson["data"]); // can be megabytes, don't copy it
         }
         else
         {
-            reqContainer->errorWrapper.HttpCode = 408;
-            reqContainer->errorWrapper.HttpStatus = reqContainer->responseString;
-            reqContainer->errorWrapper.ErrorCode = PlayFabErrorConnectionTimeout;
-            reqContainer->errorWrapper.ErrorName = "Failed to parse PlayFab response";
-            reqContainer->errorWrapper.ErrorMessage = jsonParseErrors;
+            reqContainer.errorWrapper.HttpCode = 408;
+            reqContainer.errorWrapper.HttpStatus = reqContainer.responseString;
+            reqContainer.errorWrapper.ErrorCode = PlayFabErrorConnectionTimeout;
+            reqContainer.errorWrapper.ErrorName = "Failed to parse PlayFab response";
+            reqContainer.errorWrapper.ErrorMessage = jsonParseErrors;
         }
-
-        HandleCallback(*reqContainer);
-        return (blockSize * blockCount);
     }
 
     void PlayFabHttp::AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData)
+    {
+        AddRequestWithHandle(urlPath, authKey, authValue, requestBody, internalCallback, successCallback, errorCallback, customData);
+    }
+
+    PlayFabRequestHandle PlayFabHttp::AddRequestWithHandle(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, RequestCompleteCallback internalCallback, SharedVoidPointer successCallback, ErrorCallback errorCallback, void* customData)
     {
         CallRequestContainer* reqContainer = new CallRequestContainer();
         reqContainer->errorWrapper.UrlPath = urlPath;
@@ -153,64 +460,530 @@ namespace PlayFab
         reqContainer->successCallback = successCallback;
         reqContainer->errorCallback = errorCallback;
         reqContainer->customData = customData;
+        reqContainer->enqueueTime = std::chrono::steady_clock::now();
+        if (PlayFabSettings::readCacheEnabled)
+            reqContainer->cacheTtl = PlayFabReadCache::GetTtl(urlPath); // the workers don't read the settings
+        reqContainer->requestState = std::make_shared<PlayFabRequestState>();
+        reqContainer->requestState->http = this;
+        PlayFabRequestHandle handle(reqContainer->requestState);
+
+        QueueRequest(reqContainer); // may complete, and delete, the request before it returns
+        return handle;
+    }
+
+    void PlayFabHttp::QueueRequest(CallRequestContainer* reqContainer)
+    {
+        if (reqContainer->cacheTtl.count() > 0)
+        {
+            const std::string cacheKey = PlayFabReadCache::MakeKey(reqContainer->errorWrapper.UrlPath, reqContainer->authValue, reqContainer->errorWrapper.Request);
+            switch (readCache.Find(cacheKey, *reqContainer, std::chrono::steady_clock::now()))
+            {
+            case PlayFabReadCache::Lookup::Hit:
+                ++statCacheHits;
+                reqContainer->cachedResult = true; // still queued, so callbacks keep the order the calls were made in
+                break;
+            case PlayFabReadCache::Lookup::Joined:
+                ++statCacheJoined;
+                return; // CompleteCachedRequest completes it along with the request in flight
+            case PlayFabReadCache::Lookup::Miss:
+                ++statCacheMisses;
+                reqContainer->cacheKey = cacheKey;
+                break;
+            }
+        }
 
         { // LOCK httpRequestMutex
             std::unique_lock<std::mutex> lock(httpRequestMutex);
             pendingRequests.push_back(reqContainer);
         } // UNLOCK httpRequestMutex
+        requestAvailable.notify_one();
+        WakeWorkers();
+    }
+
+    void PlayFabHttp::CompleteCachedRequest(CallRequestContainer& reqContainer)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        std::string cacheKey;
+        cacheKey.swap(reqContainer.cacheKey);
+        const std::vector<CallRequestContainer*> waiters = readCache.Complete(cacheKey, reqContainer.errorWrapper, reqContainer.cacheTtl, now);
+
+        // A cancellation or deadline of the request in flight isn't the waiters', one of them is sent instead
+        const bool abandoned = reqContainer.errorWrapper.HttpCode != 200 && IsAbandoned(reqContainer, now);
+        for (CallRequestContainer* waiter : waiters)
+        {
+            if (IsAbandoned(*waiter, now))
+            {
+                AbandonRequest(*waiter, false);
+            }
+            else if (abandoned)
+            {
+                QueueRequest(waiter);
+            }
+            else
+            {
+                PlayFabReadCache::CopyResult(reqContainer.errorWrapper, waiter->errorWrapper);
+                HandleCallback(*waiter);
+            }
+        }
+    }
+
+    void PlayFabHttp::WakeWorkers()
+    {
+#ifdef PLAYFAB_CURL_MULTI_WAKEUP
+        for (std::unique_ptr<HttpWorker>& worker : pfHttpWorkers)
+            curl_multi_wakeup(worker->curlMulti);
+#endif
+    }
+
+    void PlayFabHttp::RequestSweep()
+    {
+        { // LOCK httpRequestMutex
+            std::unique_lock<std::mutex> lock(httpRequestMutex);
+            queueSweepRequested = true;
+        } // UNLOCK httpRequestMutex
+        requestAvailable.notify_all();
+        WakeWorkers();
+    }
+
+    bool PlayFabHttp::IsAbandoned(const CallRequestContainer& reqContainer, std::chrono::steady_clock::time_point now) const
+    {
+        if (reqContainer.requestState->cancelled)
+            return true;
+        const int64_t deadlineNs = reqContainer.requestState->deadlineNs;
+        return deadlineNs != 0 && std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count() >= deadlineNs;
+    }
+
+    void PlayFabHttp::SweepQueue(std::chrono::steady_clock::time_point now, std::vector<CallRequestContainer*>& abandonedRequests)
+    {
+        // Called with httpRequestMutex held; the read cache never takes it while holding its own mutex
+        queueSweepRequested = false;
+        nextQueueDeadline = std::chrono::steady_clock::time_point::max();
+        auto kept = pendingRequests.begin();
+        for (CallRequestContainer* reqContainer : pendingRequests)
+        {
+            if (IsAbandoned(*reqContainer, now))
+            {
+                abandonedRequests.push_back(reqContainer);
+                continue;
+            }
+            const int64_t deadlineNs = reqContainer->requestState->deadlineNs;
+            if (deadlineNs != 0)
+                nextQueueDeadline = std::min(nextQueueDeadline, std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(deadlineNs))));
+            *kept++ = reqContainer;
+        }
+        pendingRequests.erase(kept, pendingRequests.end());
+
+        readCache.RemoveWaiters([this, now, &abandonedRequests](CallRequestContainer& reqContainer)
+        {
+            if (IsAbandoned(reqContainer, now))
+            {
+                abandonedRequests.push_back(&reqContainer);
+                return true;
+            }
+            const int64_t deadlineNs = reqContainer.requestState->deadlineNs;
+            if (deadlineNs != 0)
+                nextQueueDeadline = std::min(nextQueueDeadline, std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(deadlineNs))));
+            return false;
+        });
     }
 
-    void PlayFabHttp::ExecuteRequest(CallRequestContainer& reqContainer)
+    std::chrono::steady_clock::time_point PlayFabHttp::SweepWorker(HttpWorker& worker, std::chrono::steady_clock::time_point now)
     {
-        // Set up curl handle
-        reqContainer.curlHandle = curl_easy_init();
-        curl_easy_reset(reqContainer.curlHandle);
+        auto nextDeadline = std::chrono::steady_clock::time_point::max();
+        const auto checkDeadline = [&nextDeadline](const CallRequestContainer& reqContainer)
+        {
+            const int64_t deadlineNs = reqContainer.requestState->deadlineNs;
+            if (deadlineNs != 0)
+                nextDeadline = std::min(nextDeadline, std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(deadlineNs))));
+        };
+
+        // DrainOrCancel cancels the queue itself, the requests workers already took are theirs to cancel
+        const int64_t cancelBeforeNs = cancelAddedBeforeNs;
+        const auto cancelIfDrained = [cancelBeforeNs](const CallRequestContainer& reqContainer)
+        {
+            if (cancelBeforeNs != 0 && std::chrono::duration_cast<std::chrono::nanoseconds>(reqContainer.enqueueTime.time_since_epoch()).count() <= cancelBeforeNs)
+                reqContainer.requestState->cancelled = true;
+        };
+
+        for (size_t i = 0; i < worker.activeRequests.size(); )
+        {
+            CallRequestContainer& reqContainer = *worker.activeRequests[i];
+            cancelIfDrained(reqContainer);
+            if (!IsAbandoned(reqContainer, now))
+            {
+                checkDeadline(reqContainer);
+                ++i;
+                continue;
+            }
+
+            // Aborts the transfer; the handle goes back to the pool, curl_easy_reset clears it before reuse
+            curl_multi_remove_handle(worker.curlMulti, reqContainer.curlHandle);
+            worker.idleHandles.push_back(reqContainer.curlHandle);
+            reqContainer.curlHandle = nullptr;
+            reqContainer.curlHttpHeaders = nullptr;
+            worker.activeRequests.erase(worker.activeRequests.begin() + i);
+            AbandonRequest(reqContainer, true);
+        }
+
+        for (auto retryRequest = worker.retryRequests.begin(); retryRequest != worker.retryRequests.end(); )
+        {
+            CallRequestContainer& reqContainer = *retryRequest->second;
+            cancelIfDrained(reqContainer);
+            if (!IsAbandoned(reqContainer, now))
+            {
+                checkDeadline(reqContainer);
+                ++retryRequest;
+                continue;
+            }
+            retryRequest = worker.retryRequests.erase(retryRequest);
+            AbandonRequest(reqContainer, true);
+        }
+        return nextDeadline;
+    }
+
+    void PlayFabHttp::AbandonRequest(CallRequestContainer& reqContainer, bool counted)
+    {
+        // Without an outcome the circuit would wait for this probe forever
+        if (reqContainer.circuitProbe != 0)
+        {
+            retryPolicy.AbandonProbe(reqContainer.circuitProbe, std::chrono::steady_clock::now());
+            reqContainer.circuitProbe = 0;
+        }
+
+        if (reqContainer.requestState->cancelled)
+        {
+            reqContainer.errorWrapper.HttpCode = 0;
+            reqContainer.errorWrapper.HttpStatus = "Cancelled";
+            reqContainer.errorWrapper.ErrorName = "Cancelled";
+            reqContainer.errorWrapper.ErrorMessage = "The request was cancelled";
+        }
+        else
+        {
+            reqContainer.errorWrapper.HttpCode = 408;
+            reqContainer.errorWrapper.HttpStatus = "DeadlineExceeded";
+            reqContainer.errorWrapper.ErrorName = "DeadlineExceeded";
+            reqContainer.errorWrapper.ErrorMessage = "The request did not complete before its deadline";
+        }
+        reqContainer.errorWrapper.ErrorCode = PlayFabErrorConnectionTimeout;
+        reqContainer.errorWrapper.ErrorDetails = Json::Value::null;
+        reqContainer.errorWrapper.Data = Json::Value::null;
+
+        if (counted)
+        {
+            CompleteRequest(reqContainer);
+        }
+        else
+        {
+            if (!reqContainer.cacheKey.empty())
+                CompleteCachedRequest(reqContainer);
+            HandleCallback(reqContainer);
+            requestsFinished.notify_all();
+        }
+    }
+
+    size_t PlayFabHttp::DrainOrCancel(std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(httpRequestMutex);
+        const auto allFinished = [this]() { return pendingRequests.empty() && activeRequests == 0; };
+        if (requestsFinished.wait_for(lock, timeout, allFinished))
+            return 0;
+
+        // Cancel each request added until now, and only those: the queue and the requests waiting on the read cache
+        // here, the ones the workers have taken (counted in activeRequests) by each worker in SweepWorker
+        size_t cancelledRequests = activeRequests + pendingRequests.size();
+        for (CallRequestContainer* reqContainer : pendingRequests)
+            reqContainer->requestState->cancelled = true;
+        readCache.RemoveWaiters([&cancelledRequests](CallRequestContainer& reqContainer)
+        {
+            reqContainer.requestState->cancelled = true;
+            ++cancelledRequests;
+            return false;
+        });
+        cancelAddedBeforeNs = std::max<int64_t>(cancelAddedBeforeNs, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        queueSweepRequested = true;
+        lock.unlock();
+        requestAvailable.notify_all();
+        WakeWorkers();
+        lock.lock();
+
+        requestsFinished.wait_for(lock, std::chrono::milliseconds(c_cancelWaitMs), allFinished);
+        return cancelledRequests;
+    }
+
+    void PlayFabHttp::StartRequest(HttpWorker& worker, CallRequestContainer& reqContainer)
+    {
+        if (Microsoft::Azure::Gaming::GSDKTrace::isEnabled())
+            reqContainer.traceStartNs = Microsoft::Azure::Gaming::GSDKTrace::now();
+
+        // Reuse a handle from the pool, curl_easy_reset keeps its connection and DNS caches
+        if (worker.idleHandles.empty())
+        {
+            reqContainer.curlHandle = curl_easy_init();
+        }
+        else
+        {
+            reqContainer.curlHandle = worker.idleHandles.back();
+            worker.idleHandles.pop_back();
+            curl_easy_reset(reqContainer.curlHandle);
+        }
         curl_easy_setopt(reqContainer.curlHandle, CURLOPT_URL, PlayFabSettings::GetUrl(reqContainer.errorWrapper.UrlPath).c_str());
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_SHARE, curlShare);
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_PRIVATE, &reqContainer);
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_NOSIGNAL, 1L);
 
-        // Set up headers
-        reqContainer.curlHttpHeaders = nullptr;
-        reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, "Accept: application/json");
-        reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, "Content-Type: application/json; charset=utf-8");
-        reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, ("X-PlayFabSDK: " + PlayFabSettings::versionString).c_str());
-        reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, "X-ReportErrorAsSuccess: true");
+        // Use HTTP/2 when the server offers it, and wait for a connection that can multiplex rather than opening another
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_PIPEWAIT, 1L);
+
+        // Set up post & payload, compact and gzipped past PlayFabSettings::requestCompressionThreshold
+        const auto serializeStart = std::chrono::steady_clock::now();
+        worker.jsonStream.str(std::string());
+        worker.jsonStream.clear();
+        worker.jsonWriter->write(reqContainer.errorWrapper.Request, &worker.jsonStream);
+        reqContainer.requestString = worker.jsonStream.str();
+        statSerializeMicroseconds += MicrosecondsSince(serializeStart);
+        statRequestBodyBytes += reqContainer.requestString.size();
+        ++statRequests;
+
+        bool compressed = false;
+#ifdef ENABLE_PLAYFAB_GZIP_REQUESTS
+        if (PlayFabSettings::requestCompressionThreshold != 0 && reqContainer.requestString.size() >= PlayFabSettings::requestCompressionThreshold)
+        {
+            const auto compressStart = std::chrono::steady_clock::now();
+            std::string compressedBody;
+            if (GzipCompress(reqContainer.requestString, compressedBody) && compressedBody.size() < reqContainer.requestString.size())
+            {
+                reqContainer.requestString.swap(compressedBody);
+                compressed = true;
+                ++statRequestsCompressed;
+            }
+            statCompressMicroseconds += MicrosecondsSince(compressStart);
+        }
+#endif
+        statRequestWireBytes += reqContainer.requestString.size();
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_POSTFIELDSIZE, static_cast<long>(reqContainer.requestString.size()));
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_POSTFIELDS, reqContainer.requestString.c_str());
+        if (PlayFabSettings::acceptCompressedResponses)
+            curl_easy_setopt(reqContainer.curlHandle, CURLOPT_ACCEPT_ENCODING, ""); // everything this curl can decode
+
+        // Set up headers, the lists only differ by the auth and Content-Encoding headers so they're built once per combination
+        std::string authHeader;
         if (reqContainer.authKey.length() != 0 && reqContainer.authValue.length() != 0)
-            reqContainer.curlHttpHeaders = curl_slist_append(reqContainer.curlHttpHeaders, (reqContainer.authKey + ": " + reqContainer.authValue).c_str());
+            authHeader = reqContainer.authKey + ": " + reqContainer.authValue;
+        auto headerList = worker.headerLists.find(compressed ? authHeader + "\ngzip" : authHeader);
+        if (headerList == worker.headerLists.end())
+        {
+            curl_slist* headers = nullptr;
+            headers = curl_slist_append(headers, "Accept: application/json");
+            headers = curl_slist_append(headers, "Content-Type: application/json; charset=utf-8");
+            headers = curl_slist_append(headers, ("X-PlayFabSDK: " + PlayFabSettings::versionString).c_str());
+            headers = curl_slist_append(headers, "X-ReportErrorAsSuccess: true");
+            if (!authHeader.empty())
+                headers = curl_slist_append(headers, authHeader.c_str());
+            if (compressed)
+                headers = curl_slist_append(headers, "Content-Encoding: gzip");
+            headerList = worker.headerLists.emplace(compressed ? authHeader + "\ngzip" : authHeader, headers).first;
+        }
+        reqContainer.curlHttpHeaders = headerList->second;
         curl_easy_setopt(reqContainer.curlHandle, CURLOPT_HTTPHEADER, reqContainer.curlHttpHeaders);
 
-        // Set up post & payload
-        std::string payload = reqContainer.errorWrapper.Request.toStyledString();
-        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_POST, nullptr);
-        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_POSTFIELDS, payload.c_str());
-
         // Process result
         // TODO: CURLOPT_ERRORBUFFER ?
-        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_TIMEOUT_MS, 10000L);
+        int64_t timeoutMs = PlayFabSettings::requestTimeoutMs;
+        if (reqContainer.requestState->deadlineNs != 0)
+        {
+            // Rounded up and a little late, so the worker's own deadline check reports it as DeadlineExceeded
+            const int64_t untilDeadlineMs = (reqContainer.requestState->deadlineNs - std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() + 999999) / 1000000 + 5;
+            timeoutMs = std::max<int64_t>(1, std::min(timeoutMs, untilDeadlineMs));
+        }
+        curl_easy_setopt(reqContainer.curlHandle, CURLOPT_TIMEOUT_MS, static_cast<long>(timeoutMs));
         curl_easy_setopt(reqContainer.curlHandle, CURLOPT_WRITEDATA, &reqContainer);
         curl_easy_setopt(reqContainer.curlHandle, CURLOPT_WRITEFUNCTION, CurlReceiveData);
 
         // Send
         curl_easy_setopt(reqContainer.curlHandle, CURLOPT_SSL_VERIFYPEER, false); // TODO: Replace this with a ca-bundle ref???
-        const auto res = curl_easy_perform(reqContainer.curlHandle);
-        if (res != CURLE_OK)
+        worker.activeRequests.push_back(&reqContainer);
+        curl_multi_add_handle(worker.curlMulti, reqContainer.curlHandle);
+    }
+
+    void PlayFabHttp::FinishRequest(HttpWorker& worker, CURL* handle, CURLcode result)
+    {
+        char* privateData = nullptr;
+        curl_easy_getinfo(handle, CURLINFO_PRIVATE, &privateData);
+        CallRequestContainer& reqContainer = *reinterpret_cast<CallRequestContainer*>(privateData);
+        long responseCode = 0;
+        curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &responseCode);
+        curl_off_t retryAfterSeconds = 0;
+#if LIBCURL_VERSION_NUM >= 0x074200 // CURLINFO_RETRY_AFTER is new in 7.66, before that only retryAfterSeconds is read
+        curl_easy_getinfo(handle, CURLINFO_RETRY_AFTER, &retryAfterSeconds);
+#endif
+
+        if (result == CURLE_OK)
+        {
+            curl_off_t wireBytes = 0;
+            curl_easy_getinfo(handle, CURLINFO_SIZE_DOWNLOAD_T, &wireBytes);
+            statResponseWireBytes += static_cast<uint64_t>(wireBytes);
+            statResponseBodyBytes += reqContainer.responseString.size();
+        }
+
+        curl_multi_remove_handle(worker.curlMulti, handle);
+        worker.idleHandles.push_back(handle);
+        worker.activeRequests.erase(std::find(worker.activeRequests.begin(), worker.activeRequests.end(), &reqContainer));
+        reqContainer.curlHandle = nullptr;
+        reqContainer.curlHttpHeaders = nullptr;
+
+        if (reqContainer.traceStartNs != 0)
+            Microsoft::Azure::Gaming::GSDKTrace::record("PlayFabHttp::Request", "playfab", reqContainer.traceStartNs, Microsoft::Azure::Gaming::GSDKTrace::now());
+
+        if (result == CURLE_OK)
+        {
+            const auto parseStart = std::chrono::steady_clock::now();
+            ParseResponse(worker, reqContainer);
+            statParseMicroseconds += MicrosecondsSince(parseStart);
+        }
+        else
         {
             reqContainer.errorWrapper.HttpCode = 408;
             reqContainer.errorWrapper.HttpStatus = "Failed to contact server";
             reqContainer.errorWrapper.ErrorCode = PlayFabErrorConnectionTimeout;
             reqContainer.errorWrapper.ErrorName = "Failed to contact server";
-            reqContainer.errorWrapper.ErrorMessage = "Failed to contact server, curl error: " + std::to_string(res);
-            HandleCallback(reqContainer);
+            reqContainer.errorWrapper.ErrorMessage = "Failed to contact server, curl error: " + std::to_string(result) + " " + curl_easy_strerror(result);
         }
+
+        const auto now = std::chrono::steady_clock::now();
+        const PlayFabRetryPolicy::Outcome outcome = PlayFabRetryPolicy::Classify(result, responseCode, reqContainer.errorWrapper);
+        if (outcome != PlayFabRetryPolicy::Outcome::Success && IsAbandoned(reqContainer, now))
+        {
+            AbandonRequest(reqContainer, true); // curl timed out at the call's deadline, that says nothing about PlayFab
+            return;
+        }
+        retryPolicy.RecordOutcome(outcome, now);
+        reqContainer.circuitProbe = 0;
+        if (PlayFabRetryPolicy::ShouldRetry(outcome, reqContainer.errorWrapper.UrlPath, reqContainer.retryCount))
+        {
+            // Throttling responses say how long to back off, in the Retry-After header or as retryAfterSeconds
+            const std::chrono::milliseconds retryHint = PlayFabRetryPolicy::GetRetryHint(retryAfterSeconds, reqContainer.responseJson);
+            const auto retryTime = now + retryPolicy.GetRetryDelay(reqContainer.retryCount, retryHint);
+            const int64_t deadlineNs = reqContainer.requestState->deadlineNs;
+            if (retryHint.count() <= PlayFabRetryPolicy::c_maxRetryHintMs &&
+                (deadlineNs == 0 || std::chrono::duration_cast<std::chrono::nanoseconds>(retryTime.time_since_epoch()).count() < deadlineNs))
+            {
+                ++reqContainer.retryCount;
+                ++statRetries;
+
+                reqContainer.responseString.clear();
+                reqContainer.responseJson = Json::Value::null;
+                reqContainer.errorWrapper.HttpCode = 0;
+                reqContainer.errorWrapper.HttpStatus.clear();
+                reqContainer.errorWrapper.ErrorCode = PlayFabErrorCode();
+                reqContainer.errorWrapper.ErrorName.clear();
+                reqContainer.errorWrapper.ErrorMessage.clear();
+                reqContainer.errorWrapper.ErrorDetails = Json::Value::null;
+                reqContainer.errorWrapper.Data = Json::Value::null;
+                worker.retryRequests.emplace(retryTime, &reqContainer);
+                return;
+            }
+        }
+
+        CompleteRequest(reqContainer);
+    }
+
+    void PlayFabHttp::FailFast(CallRequestContainer& reqContainer)
+    {
+        ++statFailedFast;
+        reqContainer.errorWrapper.HttpCode = 503;
+        reqContainer.errorWrapper.HttpStatus = "Service Unavailable";
+        reqContainer.errorWrapper.ErrorCode = PlayFabErrorServiceUnavailable;
+        reqContainer.errorWrapper.ErrorName = "ServiceUnavailable";
+        reqContainer.errorWrapper.ErrorMessage = "Not sent, recent PlayFab requests kept failing (circuit breaker open)";
+        CompleteRequest(reqContainer);
+    }
+
+    void PlayFabHttp::CompleteRequest(CallRequestContainer& reqContainer)
+    {
+        if (!reqContainer.cacheKey.empty())
+            CompleteCachedRequest(reqContainer); // before activeRequests drops, so DrainOrCancel sees a waiter sent in its place
+        { // LOCK httpRequestMutex
+            std::unique_lock<std::mutex> lock(httpRequestMutex);
+            --activeRequests;
+        } // UNLOCK httpRequestMutex
+        requestAvailable.notify_one();
+
+        HandleCallback(reqContainer);
+        requestsFinished.notify_all();
+    }
+
+#ifdef ENABLE_PLAYFAB_GZIP_REQUESTS
+    bool PlayFabHttp::GzipCompress(const std::string& input, std::string& output)
+    {
+        z_stream stream = {};
+        if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) // 15 + 16: gzip wrapper
+            return false;
+
+        output.resize(deflateBound(&stream, static_cast<uLong>(input.size())));
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        stream.avail_in = static_cast<uInt>(input.size());
+        stream.next_out = reinterpret_cast<Bytef*>(&output[0]);
+        stream.avail_out = static_cast<uInt>(output.size());
+        const int result = deflate(&stream, Z_FINISH);
+        output.resize(stream.total_out);
+        deflateEnd(&stream);
+        return result == Z_STREAM_END;
+    }
+#endif
+
+    uint64_t PlayFabHttp::GetThreadCpuMicroseconds()
+    {
+#ifdef GSDK_LINUX
+        timespec cpuTime = {};
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime);
+        return static_cast<uint64_t>(cpuTime.tv_sec) * 1000000 + static_cast<uint64_t>(cpuTime.tv_nsec) / 1000;
+#else
+        FILETIME creationTime, exitTime, kernelTime, userTime;
+        if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+            return 0;
+        const uint64_t kernel100ns = (static_cast<uint64_t>(kernelTime.dwHighDateTime) << 32) | kernelTime.dwLowDateTime;
+        const uint64_t user100ns = (static_cast<uint64_t>(userTime.dwHighDateTime) << 32) | userTime.dwLowDateTime;
+        return (kernel100ns + user100ns) / 10;
+#endif
+    }
+
+    PlayFabHttpStats PlayFabHttp::GetStats()
+    {
+        PlayFabHttpStats stats;
+        stats.requests = statRequests;
+        stats.requestsCompressed = statRequestsCompressed;
+        stats.requestBodyBytes = statRequestBodyBytes;
+        stats.requestWireBytes = statRequestWireBytes;
+        stats.responseBodyBytes = statResponseBodyBytes;
+        stats.responseWireBytes = statResponseWireBytes;
+        stats.serializeMicroseconds = statSerializeMicroseconds;
+        stats.compressMicroseconds = statCompressMicroseconds;
+        stats.parseMicroseconds = statParseMicroseconds;
+        stats.workerCpuMicroseconds = statWorkerCpuMicroseconds;
+        stats.retries = statRetries;
+        stats.failedFast = statFailedFast;
+        stats.cacheHits = statCacheHits;
+        stats.cacheMisses = statCacheMisses;
+        stats.cacheJoined = statCacheJoined;
+        return stats;
     }
 
     void PlayFabHttp::HandleResults(CallRequestContainer& reqContainer)
     {
+        Microsoft::Azure::Gaming::GSDKTraceSpan callbackSpan("PlayFabHttp::HandleResults", "callback");
+
         // The success case must be handled by a function which is aware of the ResultType
         if (reqContainer.errorWrapper.HttpCode == 200)
         {
+            Microsoft::Azure::Gaming::GSDKMetricsPage::countPlayFabResult(true);
             reqContainer.internalCallback(reqContainer); // Unpacks the result as ResultType and invokes successCallback according to that type
         }
         else // Process the error case
         {
+            Microsoft::Azure::Gaming::GSDKMetricsPage::countPlayFabResult(false);
+            GSDK_LOG_THROTTLED(Warning, PlayFabRequestFailed, reqContainer.errorWrapper.UrlPath, reqContainer.errorWrapper.HttpCode,
+                               reqContainer.errorWrapper.ErrorName, reqContainer.errorWrapper.ErrorMessage);
             if (PlayFabSettings::globalErrorHandler != nullptr)
                 PlayFabSettings::globalErrorHandler(reqContainer.errorWrapper, reqContainer.customData);
             if (reqContainer.errorCallback != nullptr)
@@ -218,26 +991,76 @@ namespace PlayFab
         }
     }
 
+    void PlayFabHttp::PushResult(CallRequestContainer& reqContainer)
+    {
+        ++pendingResultCount; // before it can be taken, so the count never goes below zero
+        LinkResult(reqContainer);
+    }
+
+    void PlayFabHttp::LinkResult(CallRequestContainer& reqContainer)
+    {
+        reqContainer.nextResult.store(nullptr, std::memory_order_relaxed);
+        CallRequestContainer* previous = resultsHead.exchange(&reqContainer, std::memory_order_acq_rel);
+        previous->nextResult.store(&reqContainer, std::memory_order_release);
+    }
+
+    CallRequestContainer* PlayFabHttp::PopResult()
+    {
+        // Called with updateMutex held, or once the workers have stopped
+        CallRequestContainer* tail = resultsTail;
+        CallRequestContainer* next = tail->nextResult.load(std::memory_order_acquire);
+        if (tail == &resultsStub)
+        {
+            if (next == nullptr)
+                return nullptr;
+            resultsTail = next;
+            tail = next;
+            next = next->nextResult.load(std::memory_order_acquire);
+        }
+        if (next == nullptr)
+        {
+            // tail is the last result unless a worker is between its exchange and its link; then it's taken next time
+            if (tail != resultsHead.load(std::memory_order_acquire))
+                return nullptr;
+            LinkResult(resultsStub); // so tail can be taken without leaving the queue empty of nodes
+            next = tail->nextResult.load(std::memory_order_acquire);
+            if (next == nullptr)
+                return nullptr;
+        }
+        resultsTail = next;
+        --pendingResultCount;
+        return tail;
+    }
+
     size_t PlayFabHttp::Update()
     {
         //if (PlayFabSettings::threadedCallbacks)
         //    throw std::exception("You should not call Update() when PlayFabSettings::threadedCallbacks == true");
 
-        CallRequestContainer* reqContainer;
-        size_t resultCount;
-
-        { // LOCK httpRequestMutex
-            std::unique_lock<std::mutex> lock(httpRequestMutex);
-            resultCount = pendingResults.size();
-            if (resultCount == 0)
-                return resultCount;
+        const size_t resultCount = pendingResultCount;
+        if (resultCount != 0)
+            Update(1, std::chrono::microseconds::max());
+        return resultCount;
+    }
 
-            reqContainer = pendingResults[pendingResults.size() - 1];
-            pendingResults.pop_back();
-        } // UNLOCK httpRequestMutex
+    size_t PlayFabHttp::Update(size_t maxResults, std::chrono::microseconds timeBudget)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t handled = 0; handled < maxResults; ++handled)
+        {
+            CallRequestContainer* reqContainer;
+            { // LOCK updateMutex
+                std::unique_lock<std::mutex> lock(updateMutex);
+                reqContainer = PopResult();
+            } // UNLOCK updateMutex
+            if (reqContainer == nullptr)
+                break;
 
-        HandleResults(*reqContainer);
-        delete reqContainer;
-        return resultCount;
+            HandleResults(*reqContainer);
+            delete reqContainer;
+            if (std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start) >= timeBudget)
+                break;
+        }
+        return pendingResultCount;
     }
 }
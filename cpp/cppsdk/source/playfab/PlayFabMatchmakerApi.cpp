@@ -15,6 +15,11 @@ namespace PlayFab
         return PlayFabHttp::Get().Update();
     }
 
+    size_t PlayFabMatchmakerAPI::Update(size_t maxResults, std::chrono::microseconds timeBudget)
+    {
+        return PlayFabHttp::Get().Update(maxResults, timeBudget);
+    }
+
     void PlayFabMatchmakerAPI::ForgetAllCredentials()
     {
         return PlayFabSettings::ForgetAllCredentials();
@@ -22,7 +27,7 @@ namespace PlayFab
 
     // PlayFabMatchmaker APIs
 
-    void PlayFabMatchmakerAPI::AuthUser(
+    PlayFabRequestHandle PlayFabMatchmakerAPI::AuthUser(
         AuthUserRequest& request,
         ProcessApiCallback<AuthUserResponse> callback,
         ErrorCallback errorCallback,
@@ -32,7 +37,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/AuthUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAuthUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AuthUserResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Matchmaker/AuthUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAuthUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AuthUserResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabMatchmakerAPI::OnAuthUserResult(CallRequestContainer& request)
@@ -49,7 +54,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabMatchmakerAPI::PlayerJoined(
+    PlayFabRequestHandle PlayFabMatchmakerAPI::PlayerJoined(
         PlayerJoinedRequest& request,
         ProcessApiCallback<PlayerJoinedResponse> callback,
         ErrorCallback errorCallback,
@@ -59,7 +64,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/PlayerJoined", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnPlayerJoinedResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PlayerJoinedResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Matchmaker/PlayerJoined", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnPlayerJoinedResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PlayerJoinedResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabMatchmakerAPI::OnPlayerJoinedResult(CallRequestContainer& request)
@@ -76,7 +81,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabMatchmakerAPI::PlayerLeft(
+    PlayFabRequestHandle PlayFabMatchmakerAPI::PlayerLeft(
         PlayerLeftRequest& request,
         ProcessApiCallback<PlayerLeftResponse> callback,
         ErrorCallback errorCallback,
@@ -86,7 +91,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/PlayerLeft", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnPlayerLeftResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PlayerLeftResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Matchmaker/PlayerLeft", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnPlayerLeftResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<PlayerLeftResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabMatchmakerAPI::OnPlayerLeftResult(CallRequestContainer& request)
@@ -103,7 +108,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabMatchmakerAPI::StartGame(
+    PlayFabRequestHandle PlayFabMatchmakerAPI::StartGame(
         StartGameRequest& request,
         ProcessApiCallback<StartGameResponse> callback,
         ErrorCallback errorCallback,
@@ -113,7 +118,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/StartGame", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnStartGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartGameResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Matchmaker/StartGame", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnStartGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<StartGameResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabMatchmakerAPI::OnStartGameResult(CallRequestContainer& request)
@@ -130,7 +135,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabMatchmakerAPI::UserInfo(
+    PlayFabRequestHandle PlayFabMatchmakerAPI::UserInfo(
         UserInfoRequest& request,
         ProcessApiCallback<UserInfoResponse> callback,
         ErrorCallback errorCallback,
@@ -140,7 +145,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Matchmaker/UserInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUserInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UserInfoResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Matchmaker/UserInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUserInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UserInfoResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabMatchmakerAPI::OnUserInfoResult(CallRequestContainer& request)
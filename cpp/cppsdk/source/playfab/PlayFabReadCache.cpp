@@ -0,0 +1,118 @@
+#include <gsdkCommonPch.h>
+
+#include <playfab/PlayFabReadCache.h>
+#include <playfab/PlayFabHttp.h>
+#include <playfab/PlayFabSettings.h>
+
+namespace PlayFab
+{
+    constexpr size_t PlayFabReadCache::c_maxEntries;
+
+    std::chrono::milliseconds PlayFabReadCache::GetTtl(const std::string& urlPath)
+    {
+        const auto ttl = PlayFabSettings::readCacheTtlMs.find(urlPath.substr(urlPath.find_last_of('/') + 1));
+        return std::chrono::milliseconds(ttl == PlayFabSettings::readCacheTtlMs.end() ? 0 : ttl->second);
+    }
+
+    std::string PlayFabReadCache::MakeKey(const std::string& urlPath, const std::string& authValue, const Json::Value& requestBody)
+    {
+        static const Json::StreamWriterBuilder compactWriter = []()
+        {
+            Json::StreamWriterBuilder builder;
+            builder["indentation"] = "";
+            return builder;
+        }();
+        return urlPath + '\n' + authValue + '\n' + Json::writeString(compactWriter, requestBody);
+    }
+
+    PlayFabReadCache::Lookup PlayFabReadCache::Find(const std::string& key, CallRequestContainer& reqContainer, TimePoint now)
+    {
+        std::unique_lock<std::mutex> lock(cacheMutex);
+        auto entry = entries.find(key);
+        if (entry != entries.end())
+        {
+            if (entry->second.inFlight)
+            {
+                entry->second.waiters.push_back(&reqContainer);
+                return Lookup::Joined;
+            }
+            if (now < entry->second.expires)
+            {
+                CopyResult(entry->second.result, reqContainer.errorWrapper);
+                return Lookup::Hit;
+            }
+            entry->second.result = PlayFabError();
+        }
+        else
+        {
+            entry = entries.emplace(key, Entry()).first;
+        }
+        entry->second.inFlight = true;
+        return Lookup::Miss;
+    }
+
+    std::vector<CallRequestContainer*> PlayFabReadCache::Complete(const std::string& key, const PlayFabError& result, std::chrono::milliseconds ttl, TimePoint now)
+    {
+        std::vector<CallRequestContainer*> waiters;
+        std::unique_lock<std::mutex> lock(cacheMutex);
+        auto entry = entries.find(key);
+        if (entry == entries.end())
+            return waiters;
+        waiters.swap(entry->second.waiters);
+
+        if (result.HttpCode != 200)
+        {
+            entries.erase(entry);
+            return waiters;
+        }
+
+        if (entries.size() > c_maxEntries)
+        {
+            for (auto expired = entries.begin(); expired != entries.end(); )
+            {
+                if (!expired->second.inFlight && expired->second.expires <= now)
+                    expired = entries.erase(expired);
+                else
+                    ++expired;
+            }
+            if (entries.size() > c_maxEntries)
+            {
+                entries.erase(key);
+                return waiters;
+            }
+        }
+
+        entry = entries.find(key);
+        entry->second.inFlight = false;
+        entry->second.expires = now + ttl;
+        CopyResult(result, entry->second.result);
+        return waiters;
+    }
+
+    void PlayFabReadCache::RemoveWaiters(const std::function<bool(CallRequestContainer&)>& remove)
+    {
+        std::unique_lock<std::mutex> lock(cacheMutex);
+        for (auto& entry : entries)
+        {
+            std::vector<CallRequestContainer*>& waiters = entry.second.waiters;
+            auto kept = waiters.begin();
+            for (CallRequestContainer* reqContainer : waiters)
+            {
+                if (!remove(*reqContainer))
+                    *kept++ = reqContainer;
+            }
+            waiters.erase(kept, waiters.end());
+        }
+    }
+
+    void PlayFabReadCache::CopyResult(const PlayFabError& from, PlayFabError& to)
+    {
+        to.HttpCode = from.HttpCode;
+        to.HttpStatus = from.HttpStatus;
+        to.ErrorCode = from.ErrorCode;
+        to.ErrorName = from.ErrorName;
+        to.ErrorMessage = from.ErrorMessage;
+        to.ErrorDetails = from.ErrorDetails;
+        to.Data = from.Data;
+    }
+}
@@ -0,0 +1,153 @@
+#include <gsdkCommonPch.h>
+
+#include <playfab/PlayFabRetryPolicy.h>
+#include <playfab/PlayFabSettings.h>
+#include <gsdkInternal.h>
+
+namespace PlayFab
+{
+    constexpr int64_t PlayFabRetryPolicy::c_maxRetryHintMs;
+
+    PlayFabRetryPolicy::PlayFabRetryPolicy() :
+        random(std::random_device()()),
+        circuitState(CircuitState::Closed),
+        consecutiveFailures(0),
+        openUntil(),
+        lastProbe(0)
+    {
+    }
+
+    bool PlayFabRetryPolicy::IsIdempotent(const std::string& urlPath)
+    {
+        const std::string apiName = urlPath.substr(urlPath.find_last_of('/') + 1);
+
+        // These add to aggregated statistics rather than setting them
+        if (apiName == "UpdatePlayerStatistics" || apiName == "UpdateUserStatistics")
+            return false;
+
+        static const char* const idempotentPrefixes[] = { "Get", "List", "Check", "Is", "Set", "Update", "Delete", "Remove", "Revoke", "Validate", "Login", "Authenticate" };
+        for (const char* prefix : idempotentPrefixes)
+        {
+            if (apiName.compare(0, strlen(prefix), prefix) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    PlayFabRetryPolicy::Outcome PlayFabRetryPolicy::Classify(CURLcode result, long responseCode, const PlayFabError& error)
+    {
+        switch (result)
+        {
+        case CURLE_OK:
+            break;
+        case CURLE_COULDNT_RESOLVE_PROXY:
+        case CURLE_COULDNT_RESOLVE_HOST:
+        case CURLE_COULDNT_CONNECT:
+        case CURLE_SSL_CONNECT_ERROR:
+            return Outcome::NotSent;
+        default:
+            return Outcome::NoResponse;
+        }
+
+        // With X-ReportErrorAsSuccess PlayFab errors come back as HTTP 200 with the real code in the body,
+        // anything else (a proxy or load balancer answering) only has the HTTP status
+        const int httpCode = (responseCode == 200 && error.HttpCode != 0) ? error.HttpCode : static_cast<int>(responseCode);
+        if (httpCode == 200)
+            return Outcome::Success;
+        if (httpCode == 429 || error.ErrorCode == PlayFabErrorAPIClientRequestRateLimitExceeded)
+            return Outcome::Throttled;
+        if (httpCode >= 500 || error.ErrorCode == PlayFabErrorServiceUnavailable || error.ErrorCode == PlayFabErrorDownstreamServiceUnavailable)
+            return Outcome::ServerError;
+        return Outcome::Rejected;
+    }
+
+    bool PlayFabRetryPolicy::ShouldRetry(Outcome outcome, const std::string& urlPath, unsigned int retryCount)
+    {
+        if (retryCount >= PlayFabSettings::maxRetries)
+            return false;
+
+        switch (outcome)
+        {
+        case Outcome::Throttled:
+        case Outcome::NotSent:
+            return true;
+        case Outcome::ServerError:
+        case Outcome::NoResponse:
+            return IsIdempotent(urlPath);
+        default:
+            return false;
+        }
+    }
+
+    std::chrono::milliseconds PlayFabRetryPolicy::GetRetryDelay(unsigned int retryCount, std::chrono::milliseconds retryHint)
+    {
+        const uint64_t maxDelayMs = PlayFabSettings::retryMaxDelayMs;
+        const uint64_t backoffMs = std::min<uint64_t>(maxDelayMs, static_cast<uint64_t>(PlayFabSettings::retryBaseDelayMs) << std::min(retryCount, 20u));
+
+        uint64_t delayMs;
+        { // LOCK policyMutex
+            std::unique_lock<std::mutex> lock(policyMutex);
+            delayMs = std::uniform_int_distribution<uint64_t>(0, backoffMs)(random);
+        } // UNLOCK policyMutex
+
+        return std::max(std::chrono::milliseconds(delayMs), retryHint);
+    }
+
+    std::chrono::milliseconds PlayFabRetryPolicy::GetRetryHint(int64_t headerSeconds, const Json::Value& responseJson)
+    {
+        return std::chrono::seconds(std::max<int64_t>(headerSeconds, responseJson.get("retryAfterSeconds", 0).asInt64()));
+    }
+
+    bool PlayFabRetryPolicy::AllowRequest(TimePoint now, uint64_t& probe)
+    {
+        probe = 0;
+        std::unique_lock<std::mutex> lock(policyMutex);
+        switch (circuitState)
+        {
+        case CircuitState::Closed:
+            return true;
+        case CircuitState::Open:
+            if (now < openUntil)
+                return false;
+            circuitState = CircuitState::Probing;
+            probe = ++lastProbe;
+            return true;
+        default:
+            return false; // one probe at a time
+        }
+    }
+
+    void PlayFabRetryPolicy::RecordOutcome(Outcome outcome, TimePoint now)
+    {
+        std::unique_lock<std::mutex> lock(policyMutex);
+        if (outcome == Outcome::Success || outcome == Outcome::Rejected)
+        {
+            if (circuitState != CircuitState::Closed)
+                GSDK_LOG(Info, PlayFabCircuitClosed, consecutiveFailures);
+            circuitState = CircuitState::Closed;
+            consecutiveFailures = 0;
+            return;
+        }
+
+        ++consecutiveFailures;
+        const unsigned int threshold = PlayFabSettings::circuitBreakerThreshold;
+        if (threshold != 0 && (circuitState == CircuitState::Probing || (circuitState == CircuitState::Closed && consecutiveFailures >= threshold)))
+        {
+            if (circuitState == CircuitState::Closed)
+                GSDK_LOG(Warning, PlayFabCircuitOpened, consecutiveFailures, PlayFabSettings::circuitBreakerOpenMs);
+            circuitState = CircuitState::Open;
+            openUntil = now + std::chrono::milliseconds(PlayFabSettings::circuitBreakerOpenMs);
+        }
+    }
+
+    void PlayFabRetryPolicy::AbandonProbe(uint64_t probe, TimePoint now)
+    {
+        std::unique_lock<std::mutex> lock(policyMutex);
+        // A later outcome may already have closed or reopened the circuit, and a later probe may be in flight
+        if (circuitState == CircuitState::Probing && probe == lastProbe)
+        {
+            circuitState = CircuitState::Open;
+            openUntil = now;
+        }
+    }
+}
@@ -15,6 +15,11 @@ namespace PlayFab
         return PlayFabHttp::Get().Update();
     }
 
+    size_t PlayFabServerAPI::Update(size_t maxResults, std::chrono::microseconds timeBudget)
+    {
+        return PlayFabHttp::Get().Update(maxResults, timeBudget);
+    }
+
     void PlayFabServerAPI::ForgetAllCredentials()
     {
         return PlayFabSettings::ForgetAllCredentials();
@@ -22,7 +27,7 @@ namespace PlayFab
 
     // PlayFabServer APIs
 
-    void PlayFabServerAPI::AddCharacterVirtualCurrency(
+    PlayFabRequestHandle PlayFabServerAPI::AddCharacterVirtualCurrency(
         AddCharacterVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyCharacterVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -32,7 +37,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddCharacterVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddCharacterVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyCharacterVirtualCurrencyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/AddCharacterVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddCharacterVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyCharacterVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnAddCharacterVirtualCurrencyResult(CallRequestContainer& request)
@@ -49,7 +54,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::AddFriend(
+    PlayFabRequestHandle PlayFabServerAPI::AddFriend(
         AddFriendRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -59,7 +64,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddFriend", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/AddFriend", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnAddFriendResult(CallRequestContainer& request)
@@ -76,7 +81,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::AddPlayerTag(
+    PlayFabRequestHandle PlayFabServerAPI::AddPlayerTag(
         AddPlayerTagRequest& request,
         ProcessApiCallback<AddPlayerTagResult> callback,
         ErrorCallback errorCallback,
@@ -86,7 +91,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddPlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddPlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/AddPlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddPlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnAddPlayerTagResult(CallRequestContainer& request)
@@ -103,7 +108,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::AddSharedGroupMembers(
+    PlayFabRequestHandle PlayFabServerAPI::AddSharedGroupMembers(
         AddSharedGroupMembersRequest& request,
         ProcessApiCallback<AddSharedGroupMembersResult> callback,
         ErrorCallback errorCallback,
@@ -113,7 +118,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddSharedGroupMembers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddSharedGroupMembersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/AddSharedGroupMembers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AddSharedGroupMembersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnAddSharedGroupMembersResult(CallRequestContainer& request)
@@ -130,7 +135,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::AddUserVirtualCurrency(
+    PlayFabRequestHandle PlayFabServerAPI::AddUserVirtualCurrency(
         AddUserVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -140,7 +145,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AddUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/AddUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAddUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnAddUserVirtualCurrencyResult(CallRequestContainer& request)
@@ -157,7 +162,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::AuthenticateSessionTicket(
+    PlayFabRequestHandle PlayFabServerAPI::AuthenticateSessionTicket(
         AuthenticateSessionTicketRequest& request,
         ProcessApiCallback<AuthenticateSessionTicketResult> callback,
         ErrorCallback errorCallback,
@@ -167,7 +172,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AuthenticateSessionTicket", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAuthenticateSessionTicketResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AuthenticateSessionTicketResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/AuthenticateSessionTicket", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAuthenticateSessionTicketResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AuthenticateSessionTicketResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnAuthenticateSessionTicketResult(CallRequestContainer& request)
@@ -184,7 +189,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::AwardSteamAchievement(
+    PlayFabRequestHandle PlayFabServerAPI::AwardSteamAchievement(
         AwardSteamAchievementRequest& request,
         ProcessApiCallback<AwardSteamAchievementResult> callback,
         ErrorCallback errorCallback,
@@ -194,7 +199,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/AwardSteamAchievement", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAwardSteamAchievementResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AwardSteamAchievementResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/AwardSteamAchievement", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnAwardSteamAchievementResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<AwardSteamAchievementResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnAwardSteamAchievementResult(CallRequestContainer& request)
@@ -211,7 +216,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::BanUsers(
+    PlayFabRequestHandle PlayFabServerAPI::BanUsers(
         BanUsersRequest& request,
         ProcessApiCallback<BanUsersResult> callback,
         ErrorCallback errorCallback,
@@ -221,7 +226,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/BanUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnBanUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/BanUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnBanUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnBanUsersResult(CallRequestContainer& request)
@@ -238,7 +243,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::ConsumeItem(
+    PlayFabRequestHandle PlayFabServerAPI::ConsumeItem(
         ConsumeItemRequest& request,
         ProcessApiCallback<ConsumeItemResult> callback,
         ErrorCallback errorCallback,
@@ -248,7 +253,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/ConsumeItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnConsumeItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeItemResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/ConsumeItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnConsumeItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnConsumeItemResult(CallRequestContainer& request)
@@ -265,7 +270,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::CreateSharedGroup(
+    PlayFabRequestHandle PlayFabServerAPI::CreateSharedGroup(
         CreateSharedGroupRequest& request,
         ProcessApiCallback<CreateSharedGroupResult> callback,
         ErrorCallback errorCallback,
@@ -275,7 +280,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/CreateSharedGroup", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreateSharedGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSharedGroupResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/CreateSharedGroup", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnCreateSharedGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSharedGroupResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnCreateSharedGroupResult(CallRequestContainer& request)
@@ -292,7 +297,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::DeleteCharacterFromUser(
+    PlayFabRequestHandle PlayFabServerAPI::DeleteCharacterFromUser(
         DeleteCharacterFromUserRequest& request,
         ProcessApiCallback<DeleteCharacterFromUserResult> callback,
         ErrorCallback errorCallback,
@@ -302,7 +307,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/DeleteCharacterFromUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteCharacterFromUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteCharacterFromUserResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/DeleteCharacterFromUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteCharacterFromUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteCharacterFromUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnDeleteCharacterFromUserResult(CallRequestContainer& request)
@@ -319,7 +324,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::DeleteSharedGroup(
+    PlayFabRequestHandle PlayFabServerAPI::DeleteSharedGroup(
         DeleteSharedGroupRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -329,7 +334,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/DeleteSharedGroup", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteSharedGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/DeleteSharedGroup", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteSharedGroupResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnDeleteSharedGroupResult(CallRequestContainer& request)
@@ -346,7 +351,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::DeleteUsers(
+    PlayFabRequestHandle PlayFabServerAPI::DeleteUsers(
         DeleteUsersRequest& request,
         ProcessApiCallback<DeleteUsersResult> callback,
         ErrorCallback errorCallback,
@@ -356,7 +361,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/DeleteUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteUsersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/DeleteUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeleteUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteUsersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnDeleteUsersResult(CallRequestContainer& request)
@@ -373,7 +378,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::DeregisterGame(
+    PlayFabRequestHandle PlayFabServerAPI::DeregisterGame(
         DeregisterGameRequest& request,
         ProcessApiCallback<DeregisterGameResponse> callback,
         ErrorCallback errorCallback,
@@ -383,7 +388,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/DeregisterGame", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeregisterGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeregisterGameResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/DeregisterGame", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnDeregisterGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<DeregisterGameResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnDeregisterGameResult(CallRequestContainer& request)
@@ -400,7 +405,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::EvaluateRandomResultTable(
+    PlayFabRequestHandle PlayFabServerAPI::EvaluateRandomResultTable(
         EvaluateRandomResultTableRequest& request,
         ProcessApiCallback<EvaluateRandomResultTableResult> callback,
         ErrorCallback errorCallback,
@@ -410,7 +415,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/EvaluateRandomResultTable", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnEvaluateRandomResultTableResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EvaluateRandomResultTableResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/EvaluateRandomResultTable", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnEvaluateRandomResultTableResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EvaluateRandomResultTableResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnEvaluateRandomResultTableResult(CallRequestContainer& request)
@@ -427,7 +432,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::ExecuteCloudScript(
+    PlayFabRequestHandle PlayFabServerAPI::ExecuteCloudScript(
         ExecuteCloudScriptServerRequest& request,
         ProcessApiCallback<ExecuteCloudScriptResult> callback,
         ErrorCallback errorCallback,
@@ -437,7 +442,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/ExecuteCloudScript", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnExecuteCloudScriptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ExecuteCloudScriptResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/ExecuteCloudScript", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnExecuteCloudScriptResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ExecuteCloudScriptResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnExecuteCloudScriptResult(CallRequestContainer& request)
@@ -454,7 +459,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetAllSegments(
+    PlayFabRequestHandle PlayFabServerAPI::GetAllSegments(
         GetAllSegmentsRequest& request,
         ProcessApiCallback<GetAllSegmentsResult> callback,
         ErrorCallback errorCallback,
@@ -464,7 +469,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetAllSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetAllSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetAllSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetAllSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetAllSegmentsResult(CallRequestContainer& request)
@@ -481,7 +486,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetAllUsersCharacters(
+    PlayFabRequestHandle PlayFabServerAPI::GetAllUsersCharacters(
         ListUsersCharactersRequest& request,
         ProcessApiCallback<ListUsersCharactersResult> callback,
         ErrorCallback errorCallback,
@@ -491,7 +496,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetAllUsersCharacters", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetAllUsersCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListUsersCharactersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetAllUsersCharacters", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetAllUsersCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ListUsersCharactersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetAllUsersCharactersResult(CallRequestContainer& request)
@@ -508,7 +513,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetCatalogItems(
+    PlayFabRequestHandle PlayFabServerAPI::GetCatalogItems(
         GetCatalogItemsRequest& request,
         ProcessApiCallback<GetCatalogItemsResult> callback,
         ErrorCallback errorCallback,
@@ -518,7 +523,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetCatalogItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCatalogItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetCatalogItemsResult(CallRequestContainer& request)
@@ -535,7 +540,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetCharacterData(
+    PlayFabRequestHandle PlayFabServerAPI::GetCharacterData(
         GetCharacterDataRequest& request,
         ProcessApiCallback<GetCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -545,7 +550,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetCharacterData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetCharacterDataResult(CallRequestContainer& request)
@@ -562,7 +567,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetCharacterInternalData(
+    PlayFabRequestHandle PlayFabServerAPI::GetCharacterInternalData(
         GetCharacterDataRequest& request,
         ProcessApiCallback<GetCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -572,7 +577,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetCharacterInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetCharacterInternalDataResult(CallRequestContainer& request)
@@ -589,7 +594,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetCharacterInventory(
+    PlayFabRequestHandle PlayFabServerAPI::GetCharacterInventory(
         GetCharacterInventoryRequest& request,
         ProcessApiCallback<GetCharacterInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -599,7 +604,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterInventory", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterInventoryResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetCharacterInventory", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetCharacterInventoryResult(CallRequestContainer& request)
@@ -616,7 +621,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetCharacterLeaderboard(
+    PlayFabRequestHandle PlayFabServerAPI::GetCharacterLeaderboard(
         GetCharacterLeaderboardRequest& request,
         ProcessApiCallback<GetCharacterLeaderboardResult> callback,
         ErrorCallback errorCallback,
@@ -626,7 +631,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterLeaderboard", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterLeaderboardResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetCharacterLeaderboard", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetCharacterLeaderboardResult(CallRequestContainer& request)
@@ -643,7 +648,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetCharacterReadOnlyData(
+    PlayFabRequestHandle PlayFabServerAPI::GetCharacterReadOnlyData(
         GetCharacterDataRequest& request,
         ProcessApiCallback<GetCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -653,7 +658,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetCharacterReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetCharacterReadOnlyDataResult(CallRequestContainer& request)
@@ -670,7 +675,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetCharacterStatistics(
+    PlayFabRequestHandle PlayFabServerAPI::GetCharacterStatistics(
         GetCharacterStatisticsRequest& request,
         ProcessApiCallback<GetCharacterStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -680,7 +685,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetCharacterStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetCharacterStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetCharacterStatisticsResult(CallRequestContainer& request)
@@ -697,7 +702,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetContentDownloadUrl(
+    PlayFabRequestHandle PlayFabServerAPI::GetContentDownloadUrl(
         GetContentDownloadUrlRequest& request,
         ProcessApiCallback<GetContentDownloadUrlResult> callback,
         ErrorCallback errorCallback,
@@ -707,7 +712,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetContentDownloadUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetContentDownloadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentDownloadUrlResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetContentDownloadUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetContentDownloadUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentDownloadUrlResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetContentDownloadUrlResult(CallRequestContainer& request)
@@ -724,7 +729,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetFriendLeaderboard(
+    PlayFabRequestHandle PlayFabServerAPI::GetFriendLeaderboard(
         GetFriendLeaderboardRequest& request,
         ProcessApiCallback<GetLeaderboardResult> callback,
         ErrorCallback errorCallback,
@@ -734,7 +739,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetFriendLeaderboard", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetFriendLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetFriendLeaderboard", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetFriendLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetFriendLeaderboardResult(CallRequestContainer& request)
@@ -751,7 +756,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetFriendsList(
+    PlayFabRequestHandle PlayFabServerAPI::GetFriendsList(
         GetFriendsListRequest& request,
         ProcessApiCallback<GetFriendsListResult> callback,
         ErrorCallback errorCallback,
@@ -761,7 +766,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetFriendsList", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetFriendsListResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendsListResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetFriendsList", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetFriendsListResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendsListResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetFriendsListResult(CallRequestContainer& request)
@@ -778,7 +783,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetLeaderboard(
+    PlayFabRequestHandle PlayFabServerAPI::GetLeaderboard(
         GetLeaderboardRequest& request,
         ProcessApiCallback<GetLeaderboardResult> callback,
         ErrorCallback errorCallback,
@@ -788,7 +793,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetLeaderboard", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetLeaderboard", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetLeaderboardResult(CallRequestContainer& request)
@@ -805,7 +810,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetLeaderboardAroundCharacter(
+    PlayFabRequestHandle PlayFabServerAPI::GetLeaderboardAroundCharacter(
         GetLeaderboardAroundCharacterRequest& request,
         ProcessApiCallback<GetLeaderboardAroundCharacterResult> callback,
         ErrorCallback errorCallback,
@@ -815,7 +820,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetLeaderboardAroundCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardAroundCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundCharacterResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetLeaderboardAroundCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardAroundCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundCharacterResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetLeaderboardAroundCharacterResult(CallRequestContainer& request)
@@ -832,7 +837,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetLeaderboardAroundUser(
+    PlayFabRequestHandle PlayFabServerAPI::GetLeaderboardAroundUser(
         GetLeaderboardAroundUserRequest& request,
         ProcessApiCallback<GetLeaderboardAroundUserResult> callback,
         ErrorCallback errorCallback,
@@ -842,7 +847,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetLeaderboardAroundUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardAroundUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundUserResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetLeaderboardAroundUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardAroundUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetLeaderboardAroundUserResult(CallRequestContainer& request)
@@ -859,7 +864,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetLeaderboardForUserCharacters(
+    PlayFabRequestHandle PlayFabServerAPI::GetLeaderboardForUserCharacters(
         GetLeaderboardForUsersCharactersRequest& request,
         ProcessApiCallback<GetLeaderboardForUsersCharactersResult> callback,
         ErrorCallback errorCallback,
@@ -869,7 +874,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetLeaderboardForUserCharacters", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardForUserCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardForUsersCharactersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetLeaderboardForUserCharacters", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetLeaderboardForUserCharactersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardForUsersCharactersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetLeaderboardForUserCharactersResult(CallRequestContainer& request)
@@ -886,7 +891,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPlayerCombinedInfo(
+    PlayFabRequestHandle PlayFabServerAPI::GetPlayerCombinedInfo(
         GetPlayerCombinedInfoRequest& request,
         ProcessApiCallback<GetPlayerCombinedInfoResult> callback,
         ErrorCallback errorCallback,
@@ -896,7 +901,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerCombinedInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerCombinedInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerCombinedInfoResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPlayerCombinedInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerCombinedInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerCombinedInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPlayerCombinedInfoResult(CallRequestContainer& request)
@@ -913,7 +918,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPlayerProfile(
+    PlayFabRequestHandle PlayFabServerAPI::GetPlayerProfile(
         GetPlayerProfileRequest& request,
         ProcessApiCallback<GetPlayerProfileResult> callback,
         ErrorCallback errorCallback,
@@ -923,7 +928,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerProfile", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPlayerProfile", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerProfileResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPlayerProfileResult(CallRequestContainer& request)
@@ -940,7 +945,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPlayerSegments(
+    PlayFabRequestHandle PlayFabServerAPI::GetPlayerSegments(
         GetPlayersSegmentsRequest& request,
         ProcessApiCallback<GetPlayerSegmentsResult> callback,
         ErrorCallback errorCallback,
@@ -950,7 +955,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPlayerSegments", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerSegmentsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPlayerSegmentsResult(CallRequestContainer& request)
@@ -967,7 +972,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPlayersInSegment(
+    PlayFabRequestHandle PlayFabServerAPI::GetPlayersInSegment(
         GetPlayersInSegmentRequest& request,
         ProcessApiCallback<GetPlayersInSegmentResult> callback,
         ErrorCallback errorCallback,
@@ -977,7 +982,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayersInSegment", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayersInSegmentResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPlayersInSegment", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayersInSegmentResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPlayersInSegmentResult(CallRequestContainer& request)
@@ -994,7 +999,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPlayerStatistics(
+    PlayFabRequestHandle PlayFabServerAPI::GetPlayerStatistics(
         GetPlayerStatisticsRequest& request,
         ProcessApiCallback<GetPlayerStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -1004,7 +1009,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPlayerStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPlayerStatisticsResult(CallRequestContainer& request)
@@ -1021,7 +1026,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPlayerStatisticVersions(
+    PlayFabRequestHandle PlayFabServerAPI::GetPlayerStatisticVersions(
         GetPlayerStatisticVersionsRequest& request,
         ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
         ErrorCallback errorCallback,
@@ -1031,7 +1036,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerStatisticVersions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPlayerStatisticVersions", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerStatisticVersionsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPlayerStatisticVersionsResult(CallRequestContainer& request)
@@ -1048,7 +1053,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPlayerTags(
+    PlayFabRequestHandle PlayFabServerAPI::GetPlayerTags(
         GetPlayerTagsRequest& request,
         ProcessApiCallback<GetPlayerTagsResult> callback,
         ErrorCallback errorCallback,
@@ -1058,7 +1063,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayerTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPlayerTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayerTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPlayerTagsResult(CallRequestContainer& request)
@@ -1075,7 +1080,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(
+    PlayFabRequestHandle PlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(
         GetPlayFabIDsFromFacebookIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1085,7 +1090,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayFabIDsFromFacebookIDs", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayFabIDsFromFacebookIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPlayFabIDsFromFacebookIDs", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayFabIDsFromFacebookIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPlayFabIDsFromFacebookIDsResult(CallRequestContainer& request)
@@ -1102,7 +1107,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPlayFabIDsFromSteamIDs(
+    PlayFabRequestHandle PlayFabServerAPI::GetPlayFabIDsFromSteamIDs(
         GetPlayFabIDsFromSteamIDsRequest& request,
         ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> callback,
         ErrorCallback errorCallback,
@@ -1112,7 +1117,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPlayFabIDsFromSteamIDs", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayFabIDsFromSteamIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPlayFabIDsFromSteamIDs", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPlayFabIDsFromSteamIDsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPlayFabIDsFromSteamIDsResult(CallRequestContainer& request)
@@ -1129,7 +1134,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetPublisherData(
+    PlayFabRequestHandle PlayFabServerAPI::GetPublisherData(
         GetPublisherDataRequest& request,
         ProcessApiCallback<GetPublisherDataResult> callback,
         ErrorCallback errorCallback,
@@ -1139,7 +1144,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetPublisherDataResult(CallRequestContainer& request)
@@ -1156,7 +1161,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetRandomResultTables(
+    PlayFabRequestHandle PlayFabServerAPI::GetRandomResultTables(
         GetRandomResultTablesRequest& request,
         ProcessApiCallback<GetRandomResultTablesResult> callback,
         ErrorCallback errorCallback,
@@ -1166,7 +1171,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetRandomResultTables", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetRandomResultTablesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetRandomResultTables", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetRandomResultTablesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetRandomResultTablesResult(CallRequestContainer& request)
@@ -1183,7 +1188,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetSharedGroupData(
+    PlayFabRequestHandle PlayFabServerAPI::GetSharedGroupData(
         GetSharedGroupDataRequest& request,
         ProcessApiCallback<GetSharedGroupDataResult> callback,
         ErrorCallback errorCallback,
@@ -1193,7 +1198,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetSharedGroupData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSharedGroupDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetSharedGroupData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSharedGroupDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetSharedGroupDataResult(CallRequestContainer& request)
@@ -1210,7 +1215,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetTime(
+    PlayFabRequestHandle PlayFabServerAPI::GetTime(
         GetTimeRequest& request,
         ProcessApiCallback<GetTimeResult> callback,
         ErrorCallback errorCallback,
@@ -1220,7 +1225,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetTime", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTimeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTimeResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetTime", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTimeResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTimeResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetTimeResult(CallRequestContainer& request)
@@ -1237,7 +1242,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetTitleData(
+    PlayFabRequestHandle PlayFabServerAPI::GetTitleData(
         GetTitleDataRequest& request,
         ProcessApiCallback<GetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -1247,7 +1252,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetTitleDataResult(CallRequestContainer& request)
@@ -1264,7 +1269,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetTitleInternalData(
+    PlayFabRequestHandle PlayFabServerAPI::GetTitleInternalData(
         GetTitleDataRequest& request,
         ProcessApiCallback<GetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -1274,7 +1279,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetTitleInternalDataResult(CallRequestContainer& request)
@@ -1291,7 +1296,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetTitleNews(
+    PlayFabRequestHandle PlayFabServerAPI::GetTitleNews(
         GetTitleNewsRequest& request,
         ProcessApiCallback<GetTitleNewsResult> callback,
         ErrorCallback errorCallback,
@@ -1301,7 +1306,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetTitleNews", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleNewsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleNewsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetTitleNews", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetTitleNewsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleNewsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetTitleNewsResult(CallRequestContainer& request)
@@ -1318,7 +1323,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetUserAccountInfo(
+    PlayFabRequestHandle PlayFabServerAPI::GetUserAccountInfo(
         GetUserAccountInfoRequest& request,
         ProcessApiCallback<GetUserAccountInfoResult> callback,
         ErrorCallback errorCallback,
@@ -1328,7 +1333,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserAccountInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserAccountInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserAccountInfoResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetUserAccountInfo", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserAccountInfoResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserAccountInfoResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetUserAccountInfoResult(CallRequestContainer& request)
@@ -1345,7 +1350,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetUserBans(
+    PlayFabRequestHandle PlayFabServerAPI::GetUserBans(
         GetUserBansRequest& request,
         ProcessApiCallback<GetUserBansResult> callback,
         ErrorCallback errorCallback,
@@ -1355,7 +1360,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetUserBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetUserBansResult(CallRequestContainer& request)
@@ -1372,7 +1377,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetUserData(
+    PlayFabRequestHandle PlayFabServerAPI::GetUserData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1382,7 +1387,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetUserDataResult(CallRequestContainer& request)
@@ -1399,7 +1404,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetUserInternalData(
+    PlayFabRequestHandle PlayFabServerAPI::GetUserInternalData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1409,7 +1414,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetUserInternalDataResult(CallRequestContainer& request)
@@ -1426,7 +1431,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetUserInventory(
+    PlayFabRequestHandle PlayFabServerAPI::GetUserInventory(
         GetUserInventoryRequest& request,
         ProcessApiCallback<GetUserInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -1436,7 +1441,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserInventory", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetUserInventory", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserInventoryResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetUserInventoryResult(CallRequestContainer& request)
@@ -1453,7 +1458,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetUserPublisherData(
+    PlayFabRequestHandle PlayFabServerAPI::GetUserPublisherData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1463,7 +1468,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetUserPublisherDataResult(CallRequestContainer& request)
@@ -1480,7 +1485,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetUserPublisherInternalData(
+    PlayFabRequestHandle PlayFabServerAPI::GetUserPublisherInternalData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1490,7 +1495,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetUserPublisherInternalDataResult(CallRequestContainer& request)
@@ -1507,7 +1512,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetUserPublisherReadOnlyData(
+    PlayFabRequestHandle PlayFabServerAPI::GetUserPublisherReadOnlyData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1517,7 +1522,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetUserPublisherReadOnlyDataResult(CallRequestContainer& request)
@@ -1534,7 +1539,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GetUserReadOnlyData(
+    PlayFabRequestHandle PlayFabServerAPI::GetUserReadOnlyData(
         GetUserDataRequest& request,
         ProcessApiCallback<GetUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -1544,7 +1549,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GetUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GetUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGetUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGetUserReadOnlyDataResult(CallRequestContainer& request)
@@ -1561,7 +1566,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GrantCharacterToUser(
+    PlayFabRequestHandle PlayFabServerAPI::GrantCharacterToUser(
         GrantCharacterToUserRequest& request,
         ProcessApiCallback<GrantCharacterToUserResult> callback,
         ErrorCallback errorCallback,
@@ -1571,7 +1576,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GrantCharacterToUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantCharacterToUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantCharacterToUserResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GrantCharacterToUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantCharacterToUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantCharacterToUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGrantCharacterToUserResult(CallRequestContainer& request)
@@ -1588,7 +1593,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GrantItemsToCharacter(
+    PlayFabRequestHandle PlayFabServerAPI::GrantItemsToCharacter(
         GrantItemsToCharacterRequest& request,
         ProcessApiCallback<GrantItemsToCharacterResult> callback,
         ErrorCallback errorCallback,
@@ -1598,7 +1603,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GrantItemsToCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToCharacterResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GrantItemsToCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToCharacterResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGrantItemsToCharacterResult(CallRequestContainer& request)
@@ -1615,7 +1620,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GrantItemsToUser(
+    PlayFabRequestHandle PlayFabServerAPI::GrantItemsToUser(
         GrantItemsToUserRequest& request,
         ProcessApiCallback<GrantItemsToUserResult> callback,
         ErrorCallback errorCallback,
@@ -1625,7 +1630,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GrantItemsToUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUserResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GrantItemsToUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGrantItemsToUserResult(CallRequestContainer& request)
@@ -1642,7 +1647,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::GrantItemsToUsers(
+    PlayFabRequestHandle PlayFabServerAPI::GrantItemsToUsers(
         GrantItemsToUsersRequest& request,
         ProcessApiCallback<GrantItemsToUsersResult> callback,
         ErrorCallback errorCallback,
@@ -1652,7 +1657,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/GrantItemsToUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/GrantItemsToUsers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnGrantItemsToUsersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnGrantItemsToUsersResult(CallRequestContainer& request)
@@ -1669,7 +1674,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::ModifyItemUses(
+    PlayFabRequestHandle PlayFabServerAPI::ModifyItemUses(
         ModifyItemUsesRequest& request,
         ProcessApiCallback<ModifyItemUsesResult> callback,
         ErrorCallback errorCallback,
@@ -1679,7 +1684,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/ModifyItemUses", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnModifyItemUsesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyItemUsesResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/ModifyItemUses", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnModifyItemUsesResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyItemUsesResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnModifyItemUsesResult(CallRequestContainer& request)
@@ -1696,7 +1701,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::MoveItemToCharacterFromCharacter(
+    PlayFabRequestHandle PlayFabServerAPI::MoveItemToCharacterFromCharacter(
         MoveItemToCharacterFromCharacterRequest& request,
         ProcessApiCallback<MoveItemToCharacterFromCharacterResult> callback,
         ErrorCallback errorCallback,
@@ -1706,7 +1711,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/MoveItemToCharacterFromCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnMoveItemToCharacterFromCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToCharacterFromCharacterResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/MoveItemToCharacterFromCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnMoveItemToCharacterFromCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToCharacterFromCharacterResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnMoveItemToCharacterFromCharacterResult(CallRequestContainer& request)
@@ -1723,7 +1728,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::MoveItemToCharacterFromUser(
+    PlayFabRequestHandle PlayFabServerAPI::MoveItemToCharacterFromUser(
         MoveItemToCharacterFromUserRequest& request,
         ProcessApiCallback<MoveItemToCharacterFromUserResult> callback,
         ErrorCallback errorCallback,
@@ -1733,7 +1738,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/MoveItemToCharacterFromUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnMoveItemToCharacterFromUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToCharacterFromUserResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/MoveItemToCharacterFromUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnMoveItemToCharacterFromUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToCharacterFromUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnMoveItemToCharacterFromUserResult(CallRequestContainer& request)
@@ -1750,7 +1755,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::MoveItemToUserFromCharacter(
+    PlayFabRequestHandle PlayFabServerAPI::MoveItemToUserFromCharacter(
         MoveItemToUserFromCharacterRequest& request,
         ProcessApiCallback<MoveItemToUserFromCharacterResult> callback,
         ErrorCallback errorCallback,
@@ -1760,7 +1765,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/MoveItemToUserFromCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnMoveItemToUserFromCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToUserFromCharacterResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/MoveItemToUserFromCharacter", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnMoveItemToUserFromCharacterResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<MoveItemToUserFromCharacterResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnMoveItemToUserFromCharacterResult(CallRequestContainer& request)
@@ -1777,7 +1782,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::NotifyMatchmakerPlayerLeft(
+    PlayFabRequestHandle PlayFabServerAPI::NotifyMatchmakerPlayerLeft(
         NotifyMatchmakerPlayerLeftRequest& request,
         ProcessApiCallback<NotifyMatchmakerPlayerLeftResult> callback,
         ErrorCallback errorCallback,
@@ -1787,7 +1792,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/NotifyMatchmakerPlayerLeft", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnNotifyMatchmakerPlayerLeftResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<NotifyMatchmakerPlayerLeftResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/NotifyMatchmakerPlayerLeft", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnNotifyMatchmakerPlayerLeftResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<NotifyMatchmakerPlayerLeftResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnNotifyMatchmakerPlayerLeftResult(CallRequestContainer& request)
@@ -1804,7 +1809,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RedeemCoupon(
+    PlayFabRequestHandle PlayFabServerAPI::RedeemCoupon(
         RedeemCouponRequest& request,
         ProcessApiCallback<RedeemCouponResult> callback,
         ErrorCallback errorCallback,
@@ -1814,7 +1819,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RedeemCoupon", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRedeemCouponResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemCouponResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RedeemCoupon", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRedeemCouponResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemCouponResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRedeemCouponResult(CallRequestContainer& request)
@@ -1831,7 +1836,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RedeemMatchmakerTicket(
+    PlayFabRequestHandle PlayFabServerAPI::RedeemMatchmakerTicket(
         RedeemMatchmakerTicketRequest& request,
         ProcessApiCallback<RedeemMatchmakerTicketResult> callback,
         ErrorCallback errorCallback,
@@ -1841,7 +1846,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RedeemMatchmakerTicket", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRedeemMatchmakerTicketResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemMatchmakerTicketResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RedeemMatchmakerTicket", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRedeemMatchmakerTicketResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemMatchmakerTicketResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRedeemMatchmakerTicketResult(CallRequestContainer& request)
@@ -1858,7 +1863,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RefreshGameServerInstanceHeartbeat(
+    PlayFabRequestHandle PlayFabServerAPI::RefreshGameServerInstanceHeartbeat(
         RefreshGameServerInstanceHeartbeatRequest& request,
         ProcessApiCallback<RefreshGameServerInstanceHeartbeatResult> callback,
         ErrorCallback errorCallback,
@@ -1868,7 +1873,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RefreshGameServerInstanceHeartbeat", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRefreshGameServerInstanceHeartbeatResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RefreshGameServerInstanceHeartbeatResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RefreshGameServerInstanceHeartbeat", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRefreshGameServerInstanceHeartbeatResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RefreshGameServerInstanceHeartbeatResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRefreshGameServerInstanceHeartbeatResult(CallRequestContainer& request)
@@ -1885,7 +1890,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RegisterGame(
+    PlayFabRequestHandle PlayFabServerAPI::RegisterGame(
         RegisterGameRequest& request,
         ProcessApiCallback<RegisterGameResponse> callback,
         ErrorCallback errorCallback,
@@ -1895,7 +1900,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RegisterGame", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRegisterGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterGameResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RegisterGame", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRegisterGameResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterGameResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRegisterGameResult(CallRequestContainer& request)
@@ -1912,7 +1917,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RemoveFriend(
+    PlayFabRequestHandle PlayFabServerAPI::RemoveFriend(
         RemoveFriendRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -1922,7 +1927,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RemoveFriend", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RemoveFriend", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveFriendResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRemoveFriendResult(CallRequestContainer& request)
@@ -1939,7 +1944,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RemovePlayerTag(
+    PlayFabRequestHandle PlayFabServerAPI::RemovePlayerTag(
         RemovePlayerTagRequest& request,
         ProcessApiCallback<RemovePlayerTagResult> callback,
         ErrorCallback errorCallback,
@@ -1949,7 +1954,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RemovePlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemovePlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RemovePlayerTag", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemovePlayerTagResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRemovePlayerTagResult(CallRequestContainer& request)
@@ -1966,7 +1971,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RemoveSharedGroupMembers(
+    PlayFabRequestHandle PlayFabServerAPI::RemoveSharedGroupMembers(
         RemoveSharedGroupMembersRequest& request,
         ProcessApiCallback<RemoveSharedGroupMembersResult> callback,
         ErrorCallback errorCallback,
@@ -1976,7 +1981,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RemoveSharedGroupMembers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveSharedGroupMembersResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RemoveSharedGroupMembers", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRemoveSharedGroupMembersResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveSharedGroupMembersResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRemoveSharedGroupMembersResult(CallRequestContainer& request)
@@ -1993,7 +1998,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::ReportPlayer(
+    PlayFabRequestHandle PlayFabServerAPI::ReportPlayer(
         ReportPlayerServerRequest& request,
         ProcessApiCallback<ReportPlayerServerResult> callback,
         ErrorCallback errorCallback,
@@ -2003,7 +2008,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/ReportPlayer", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnReportPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportPlayerServerResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/ReportPlayer", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnReportPlayerResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportPlayerServerResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnReportPlayerResult(CallRequestContainer& request)
@@ -2020,7 +2025,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RevokeAllBansForUser(
+    PlayFabRequestHandle PlayFabServerAPI::RevokeAllBansForUser(
         RevokeAllBansForUserRequest& request,
         ProcessApiCallback<RevokeAllBansForUserResult> callback,
         ErrorCallback errorCallback,
@@ -2030,7 +2035,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RevokeAllBansForUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeAllBansForUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RevokeAllBansForUser", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeAllBansForUserResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRevokeAllBansForUserResult(CallRequestContainer& request)
@@ -2047,7 +2052,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RevokeBans(
+    PlayFabRequestHandle PlayFabServerAPI::RevokeBans(
         RevokeBansRequest& request,
         ProcessApiCallback<RevokeBansResult> callback,
         ErrorCallback errorCallback,
@@ -2057,7 +2062,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RevokeBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RevokeBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRevokeBansResult(CallRequestContainer& request)
@@ -2074,7 +2079,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RevokeInventoryItem(
+    PlayFabRequestHandle PlayFabServerAPI::RevokeInventoryItem(
         RevokeInventoryItemRequest& request,
         ProcessApiCallback<RevokeInventoryResult> callback,
         ErrorCallback errorCallback,
@@ -2084,7 +2089,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RevokeInventoryItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RevokeInventoryItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRevokeInventoryItemResult(CallRequestContainer& request)
@@ -2101,7 +2106,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::RevokeInventoryItems(
+    PlayFabRequestHandle PlayFabServerAPI::RevokeInventoryItems(
         RevokeInventoryItemsRequest& request,
         ProcessApiCallback<RevokeInventoryItemsResult> callback,
         ErrorCallback errorCallback,
@@ -2111,7 +2116,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/RevokeInventoryItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/RevokeInventoryItems", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnRevokeInventoryItemsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnRevokeInventoryItemsResult(CallRequestContainer& request)
@@ -2128,7 +2133,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SendCustomAccountRecoveryEmail(
+    PlayFabRequestHandle PlayFabServerAPI::SendCustomAccountRecoveryEmail(
         SendCustomAccountRecoveryEmailRequest& request,
         ProcessApiCallback<SendCustomAccountRecoveryEmailResult> callback,
         ErrorCallback errorCallback,
@@ -2138,7 +2143,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SendCustomAccountRecoveryEmail", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendCustomAccountRecoveryEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendCustomAccountRecoveryEmailResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SendCustomAccountRecoveryEmail", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendCustomAccountRecoveryEmailResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendCustomAccountRecoveryEmailResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSendCustomAccountRecoveryEmailResult(CallRequestContainer& request)
@@ -2155,7 +2160,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SendEmailFromTemplate(
+    PlayFabRequestHandle PlayFabServerAPI::SendEmailFromTemplate(
         SendEmailFromTemplateRequest& request,
         ProcessApiCallback<SendEmailFromTemplateResult> callback,
         ErrorCallback errorCallback,
@@ -2165,7 +2170,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SendEmailFromTemplate", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendEmailFromTemplateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendEmailFromTemplateResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SendEmailFromTemplate", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendEmailFromTemplateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendEmailFromTemplateResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSendEmailFromTemplateResult(CallRequestContainer& request)
@@ -2182,7 +2187,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SendPushNotification(
+    PlayFabRequestHandle PlayFabServerAPI::SendPushNotification(
         SendPushNotificationRequest& request,
         ProcessApiCallback<SendPushNotificationResult> callback,
         ErrorCallback errorCallback,
@@ -2192,7 +2197,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SendPushNotification", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendPushNotificationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendPushNotificationResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SendPushNotification", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSendPushNotificationResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SendPushNotificationResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSendPushNotificationResult(CallRequestContainer& request)
@@ -2209,7 +2214,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SetFriendTags(
+    PlayFabRequestHandle PlayFabServerAPI::SetFriendTags(
         SetFriendTagsRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -2219,7 +2224,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetFriendTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetFriendTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SetFriendTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetFriendTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSetFriendTagsResult(CallRequestContainer& request)
@@ -2236,7 +2241,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SetGameServerInstanceData(
+    PlayFabRequestHandle PlayFabServerAPI::SetGameServerInstanceData(
         SetGameServerInstanceDataRequest& request,
         ProcessApiCallback<SetGameServerInstanceDataResult> callback,
         ErrorCallback errorCallback,
@@ -2246,7 +2251,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetGameServerInstanceData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetGameServerInstanceDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SetGameServerInstanceData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetGameServerInstanceDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSetGameServerInstanceDataResult(CallRequestContainer& request)
@@ -2263,7 +2268,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SetGameServerInstanceState(
+    PlayFabRequestHandle PlayFabServerAPI::SetGameServerInstanceState(
         SetGameServerInstanceStateRequest& request,
         ProcessApiCallback<SetGameServerInstanceStateResult> callback,
         ErrorCallback errorCallback,
@@ -2273,7 +2278,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetGameServerInstanceState", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetGameServerInstanceStateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceStateResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SetGameServerInstanceState", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetGameServerInstanceStateResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceStateResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSetGameServerInstanceStateResult(CallRequestContainer& request)
@@ -2290,7 +2295,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SetGameServerInstanceTags(
+    PlayFabRequestHandle PlayFabServerAPI::SetGameServerInstanceTags(
         SetGameServerInstanceTagsRequest& request,
         ProcessApiCallback<SetGameServerInstanceTagsResult> callback,
         ErrorCallback errorCallback,
@@ -2300,7 +2305,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetGameServerInstanceTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetGameServerInstanceTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceTagsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SetGameServerInstanceTags", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetGameServerInstanceTagsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetGameServerInstanceTagsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSetGameServerInstanceTagsResult(CallRequestContainer& request)
@@ -2317,7 +2322,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SetPlayerSecret(
+    PlayFabRequestHandle PlayFabServerAPI::SetPlayerSecret(
         SetPlayerSecretRequest& request,
         ProcessApiCallback<SetPlayerSecretResult> callback,
         ErrorCallback errorCallback,
@@ -2327,7 +2332,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetPlayerSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPlayerSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SetPlayerSecret", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPlayerSecretResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSetPlayerSecretResult(CallRequestContainer& request)
@@ -2344,7 +2349,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SetPublisherData(
+    PlayFabRequestHandle PlayFabServerAPI::SetPublisherData(
         SetPublisherDataRequest& request,
         ProcessApiCallback<SetPublisherDataResult> callback,
         ErrorCallback errorCallback,
@@ -2354,7 +2359,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SetPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSetPublisherDataResult(CallRequestContainer& request)
@@ -2371,7 +2376,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SetTitleData(
+    PlayFabRequestHandle PlayFabServerAPI::SetTitleData(
         SetTitleDataRequest& request,
         ProcessApiCallback<SetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -2381,7 +2386,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SetTitleData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSetTitleDataResult(CallRequestContainer& request)
@@ -2398,7 +2403,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SetTitleInternalData(
+    PlayFabRequestHandle PlayFabServerAPI::SetTitleInternalData(
         SetTitleDataRequest& request,
         ProcessApiCallback<SetTitleDataResult> callback,
         ErrorCallback errorCallback,
@@ -2408,7 +2413,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SetTitleInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSetTitleInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSetTitleInternalDataResult(CallRequestContainer& request)
@@ -2425,7 +2430,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SubtractCharacterVirtualCurrency(
+    PlayFabRequestHandle PlayFabServerAPI::SubtractCharacterVirtualCurrency(
         SubtractCharacterVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyCharacterVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -2435,7 +2440,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SubtractCharacterVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSubtractCharacterVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyCharacterVirtualCurrencyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SubtractCharacterVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSubtractCharacterVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyCharacterVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSubtractCharacterVirtualCurrencyResult(CallRequestContainer& request)
@@ -2452,7 +2457,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::SubtractUserVirtualCurrency(
+    PlayFabRequestHandle PlayFabServerAPI::SubtractUserVirtualCurrency(
         SubtractUserVirtualCurrencyRequest& request,
         ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
         ErrorCallback errorCallback,
@@ -2462,7 +2467,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/SubtractUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSubtractUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/SubtractUserVirtualCurrency", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnSubtractUserVirtualCurrencyResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnSubtractUserVirtualCurrencyResult(CallRequestContainer& request)
@@ -2479,7 +2484,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UnlockContainerInstance(
+    PlayFabRequestHandle PlayFabServerAPI::UnlockContainerInstance(
         UnlockContainerInstanceRequest& request,
         ProcessApiCallback<UnlockContainerItemResult> callback,
         ErrorCallback errorCallback,
@@ -2489,7 +2494,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UnlockContainerInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUnlockContainerInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UnlockContainerInstance", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUnlockContainerInstanceResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUnlockContainerInstanceResult(CallRequestContainer& request)
@@ -2506,7 +2511,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UnlockContainerItem(
+    PlayFabRequestHandle PlayFabServerAPI::UnlockContainerItem(
         UnlockContainerItemRequest& request,
         ProcessApiCallback<UnlockContainerItemResult> callback,
         ErrorCallback errorCallback,
@@ -2516,7 +2521,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UnlockContainerItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUnlockContainerItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UnlockContainerItem", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUnlockContainerItemResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUnlockContainerItemResult(CallRequestContainer& request)
@@ -2533,7 +2538,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateAvatarUrl(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateAvatarUrl(
         UpdateAvatarUrlRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -2543,7 +2548,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateAvatarUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateAvatarUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateAvatarUrl", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateAvatarUrlResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateAvatarUrlResult(CallRequestContainer& request)
@@ -2560,7 +2565,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateBans(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateBans(
         UpdateBansRequest& request,
         ProcessApiCallback<UpdateBansResult> callback,
         ErrorCallback errorCallback,
@@ -2570,7 +2575,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateBans", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateBansResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateBansResult(CallRequestContainer& request)
@@ -2587,7 +2592,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateCharacterData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateCharacterData(
         UpdateCharacterDataRequest& request,
         ProcessApiCallback<UpdateCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -2597,7 +2602,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateCharacterData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateCharacterData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateCharacterDataResult(CallRequestContainer& request)
@@ -2614,7 +2619,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateCharacterInternalData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateCharacterInternalData(
         UpdateCharacterDataRequest& request,
         ProcessApiCallback<UpdateCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -2624,7 +2629,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateCharacterInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateCharacterInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateCharacterInternalDataResult(CallRequestContainer& request)
@@ -2641,7 +2646,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateCharacterReadOnlyData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateCharacterReadOnlyData(
         UpdateCharacterDataRequest& request,
         ProcessApiCallback<UpdateCharacterDataResult> callback,
         ErrorCallback errorCallback,
@@ -2651,7 +2656,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateCharacterReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateCharacterReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateCharacterReadOnlyDataResult(CallRequestContainer& request)
@@ -2668,7 +2673,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateCharacterStatistics(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateCharacterStatistics(
         UpdateCharacterStatisticsRequest& request,
         ProcessApiCallback<UpdateCharacterStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -2678,7 +2683,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateCharacterStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateCharacterStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateCharacterStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateCharacterStatisticsResult(CallRequestContainer& request)
@@ -2695,7 +2700,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdatePlayerStatistics(
+    PlayFabRequestHandle PlayFabServerAPI::UpdatePlayerStatistics(
         UpdatePlayerStatisticsRequest& request,
         ProcessApiCallback<UpdatePlayerStatisticsResult> callback,
         ErrorCallback errorCallback,
@@ -2705,7 +2710,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdatePlayerStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticsResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdatePlayerStatistics", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdatePlayerStatisticsResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticsResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdatePlayerStatisticsResult(CallRequestContainer& request)
@@ -2722,7 +2727,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateSharedGroupData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateSharedGroupData(
         UpdateSharedGroupDataRequest& request,
         ProcessApiCallback<UpdateSharedGroupDataResult> callback,
         ErrorCallback errorCallback,
@@ -2732,7 +2737,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateSharedGroupData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSharedGroupDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateSharedGroupData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateSharedGroupDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSharedGroupDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateSharedGroupDataResult(CallRequestContainer& request)
@@ -2749,7 +2754,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateUserData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateUserData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2759,7 +2764,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateUserData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateUserDataResult(CallRequestContainer& request)
@@ -2776,7 +2781,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateUserInternalData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateUserInternalData(
         UpdateUserInternalDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2786,7 +2791,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateUserInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateUserInternalDataResult(CallRequestContainer& request)
@@ -2803,7 +2808,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateUserInventoryItemCustomData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateUserInventoryItemCustomData(
         UpdateUserInventoryItemDataRequest& request,
         ProcessApiCallback<EmptyResult> callback,
         ErrorCallback errorCallback,
@@ -2813,7 +2818,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserInventoryItemCustomData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserInventoryItemCustomDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateUserInventoryItemCustomData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserInventoryItemCustomDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateUserInventoryItemCustomDataResult(CallRequestContainer& request)
@@ -2830,7 +2835,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateUserPublisherData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateUserPublisherData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2840,7 +2845,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateUserPublisherData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateUserPublisherDataResult(CallRequestContainer& request)
@@ -2857,7 +2862,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateUserPublisherInternalData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateUserPublisherInternalData(
         UpdateUserInternalDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2867,7 +2872,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateUserPublisherInternalData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherInternalDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateUserPublisherInternalDataResult(CallRequestContainer& request)
@@ -2884,7 +2889,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateUserPublisherReadOnlyData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateUserPublisherReadOnlyData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2894,7 +2899,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateUserPublisherReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserPublisherReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateUserPublisherReadOnlyDataResult(CallRequestContainer& request)
@@ -2911,7 +2916,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::UpdateUserReadOnlyData(
+    PlayFabRequestHandle PlayFabServerAPI::UpdateUserReadOnlyData(
         UpdateUserDataRequest& request,
         ProcessApiCallback<UpdateUserDataResult> callback,
         ErrorCallback errorCallback,
@@ -2921,7 +2926,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/UpdateUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/UpdateUserReadOnlyData", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnUpdateUserReadOnlyDataResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnUpdateUserReadOnlyDataResult(CallRequestContainer& request)
@@ -2938,7 +2943,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::WriteCharacterEvent(
+    PlayFabRequestHandle PlayFabServerAPI::WriteCharacterEvent(
         WriteServerCharacterEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -2948,7 +2953,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/WriteCharacterEvent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnWriteCharacterEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/WriteCharacterEvent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnWriteCharacterEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnWriteCharacterEventResult(CallRequestContainer& request)
@@ -2965,7 +2970,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::WritePlayerEvent(
+    PlayFabRequestHandle PlayFabServerAPI::WritePlayerEvent(
         WriteServerPlayerEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -2975,7 +2980,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/WritePlayerEvent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnWritePlayerEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/WritePlayerEvent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnWritePlayerEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnWritePlayerEventResult(CallRequestContainer& request)
@@ -2992,7 +2997,7 @@ namespace PlayFab
         }
     }
 
-    void PlayFabServerAPI::WriteTitleEvent(
+    PlayFabRequestHandle PlayFabServerAPI::WriteTitleEvent(
         WriteTitleEventRequest& request,
         ProcessApiCallback<WriteEventResponse> callback,
         ErrorCallback errorCallback,
@@ -3002,7 +3007,7 @@ namespace PlayFab
 
         IPlayFabHttp& http = IPlayFabHttp::Get();
         const auto requestJson = request.ToJson();
-        http.AddRequest("/Server/WriteTitleEvent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnWriteTitleEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
+        return http.AddRequestWithHandle("/Server/WriteTitleEvent", "X-SecretKey", PlayFabSettings::developerSecretKey, requestJson, OnWriteTitleEventResult, SharedVoidPointer((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback)), errorCallback, customData);
     }
 
     void PlayFabServerAPI::OnWriteTitleEventResult(CallRequestContainer& request)
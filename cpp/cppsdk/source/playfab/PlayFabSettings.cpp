@@ -18,6 +18,49 @@ namespace PlayFab
     // Control whether all callbacks are threaded or whether the user manually controlls callback timing from their main-thread
     bool PlayFabSettings::threadedCallbacks = false;
 
+    // Number of threads sending requests, read when the PlayFabHttp instance is created
+    unsigned int PlayFabSettings::httpWorkerThreads = 1;
+    // Requests in flight at once across all workers, further requests wait in the queue
+    unsigned int PlayFabSettings::maxConcurrentRequests = 64;
+    // Request bodies of at least this many bytes are sent gzip compressed, 0 never compresses them
+    unsigned int PlayFabSettings::requestCompressionThreshold = 0;
+    // Send Accept-Encoding so the server may compress responses, which curl decompresses
+    bool PlayFabSettings::acceptCompressedResponses = true;
+
+    // Per attempt, in milliseconds
+    unsigned int PlayFabSettings::requestTimeoutMs = 10000;
+    // Failed requests are retried up to maxRetries times, when PlayFabRetryPolicy considers it safe, after a
+    // random delay of up to retryBaseDelayMs * 2^retry (capped at retryMaxDelayMs) or as long as the server asks
+    unsigned int PlayFabSettings::maxRetries = 3;
+    unsigned int PlayFabSettings::retryBaseDelayMs = 100;
+    unsigned int PlayFabSettings::retryMaxDelayMs = 5000;
+    // After this many failures in a row requests fail fast for circuitBreakerOpenMs, 0 never does
+    unsigned int PlayFabSettings::circuitBreakerThreshold = 20;
+    unsigned int PlayFabSettings::circuitBreakerOpenMs = 10000;
+
+    // PlayFabEventPipeline, read when it is created: events it holds (rounded up to a power of two, more are dropped),
+    // events per batch (at most 200), how often a partial batch is sent, and how many requests may be outstanding
+    // (a batch with Event/WriteEvents, otherwise one event each)
+    unsigned int PlayFabSettings::eventQueueCapacity = 8192;
+    unsigned int PlayFabSettings::eventBatchSize = 100;
+    unsigned int PlayFabSettings::eventFlushIntervalMs = 1000;
+    unsigned int PlayFabSettings::eventBatchesInFlight = 2;
+    // With entityToken set, PlayFabEventPipeline batches go to Event/WriteEvents in this namespace ("custom.<name>");
+    // empty sends each event with Server/WritePlayerEvent or WriteTitleEvent
+    std::string PlayFabSettings::eventNamespace;
+
+    // Answer repeated reads from PlayFabHttp's cache: responses of the APIs in readCacheTtlMs are kept for that
+    // many milliseconds, per API name, and identical calls made while one is in flight share its response.
+    // Both are read on the thread making each call, when it is made.
+    bool PlayFabSettings::readCacheEnabled = false;
+    std::map<std::string, unsigned int> PlayFabSettings::readCacheTtlMs = {
+        { "GetCatalogItems", 300000 },
+        { "GetPlayerProfile", 10000 },
+        { "GetPublisherData", 60000 },
+        { "GetTime", 1000 }, // the cached time is up to this stale
+        { "GetTitleData", 60000 },
+    };
+
     std::string PlayFabSettings::entityToken; // This is set by entity GetEntityToken method, and is required by all other Entity API methods
 #if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
     std::string PlayFabSettings::developerSecretKey; // You must set this value for PlayFabSdk to work properly (Found in the Game Manager for your title, at the PlayFab Website)
@@ -0,0 +1,211 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+// Turns binary GSDK logs (GSDK::setBinaryLogging) back into text or JSON lines.
+//
+//   GSDK_LogDecoder [--json] <GSDK_output_<time>.index | segment.bin>...
+//
+// Passing the .index file decodes every segment still on disk, oldest first.
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "gsdkLogRecord.h"
+
+using namespace Microsoft::Azure::Gaming;
+
+static void appendJsonString(std::string &out, const char *value, size_t length)
+{
+    out.push_back('"');
+    for (size_t i = 0; i < length; ++i)
+    {
+        unsigned char c = static_cast<unsigned char>(value[i]);
+        switch (c)
+        {
+            case '"': out.append("\\\""); break;
+            case '\\': out.append("\\\\"); break;
+            case '\n': out.append("\\n"); break;
+            case '\r': out.append("\\r"); break;
+            case '\t': out.append("\\t"); break;
+            default:
+                if (c < 0x20)
+                {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out.append(escaped);
+                }
+                else
+                {
+                    out.push_back(static_cast<char>(c));
+                }
+        }
+    }
+    out.push_back('"');
+}
+
+static void appendJsonString(std::string &out, const std::string &value)
+{
+    appendJsonString(out, value.data(), value.size());
+}
+
+static void appendJsonArgument(std::string &out, const GSDKLogRecord::Argument &argument)
+{
+    switch (argument.m_type)
+    {
+        case GSDKLogRecord::ArgType::Int:
+            out.append(std::to_string(argument.m_int));
+            break;
+        case GSDKLogRecord::ArgType::UInt:
+            out.append(std::to_string(argument.m_uint));
+            break;
+        case GSDKLogRecord::ArgType::Double:
+        {
+            char buffer[32];
+            snprintf(buffer, sizeof(buffer), "%.17g", argument.m_double);
+            out.append(buffer);
+            break;
+        }
+        case GSDKLogRecord::ArgType::String:
+            appendJsonString(out, argument.m_string, argument.m_stringLength);
+            break;
+    }
+}
+
+static const char *getLevelName(GSDKLogLevel level)
+{
+    size_t index = static_cast<size_t>(level);
+    return index < sizeof(GSDKLogLevelNames) / sizeof(GSDKLogLevelNames[0]) ? GSDKLogLevelNames[index] : "Unknown";
+}
+
+static bool decodeSegment(const std::string &path, bool json)
+{
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "Could not open " << path << std::endl;
+        return false;
+    }
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::vector<GSDKLogRecord::FormatEntry> formats;
+    size_t offset = GSDKLogRecord::readFileHeader(contents.data(), contents.size(), formats);
+    if (offset == 0)
+    {
+        std::cerr << path << " is not a binary GSDK log" << std::endl;
+        return false;
+    }
+
+    GSDKLogRecord::Record record;
+    std::string line;
+    while (offset < contents.size())
+    {
+        size_t length = GSDKLogRecord::decode(contents.data() + offset, contents.size() - offset, record);
+        if (length == 0)
+        {
+            // A segment cut short by a crash ends with a partial record, everything before it is still good
+            std::cerr << path << ": stopped at a truncated or corrupt record at offset " << offset << std::endl;
+            break;
+        }
+        offset += length;
+
+        std::string message;
+        bool knownFormat = record.m_formatId < formats.size();
+        GSDKLogRecord::format(knownFormat ? formats[record.m_formatId].m_format.c_str() : "", record, message);
+
+        line.clear();
+        if (json)
+        {
+            line.append("{\"timestamp\":");
+            appendJsonString(line, GSDKLogRecord::formatTimestamp(record.m_timestampNs));
+            line.append(",\"level\":");
+            appendJsonString(line, getLevelName(record.m_level));
+            line.append(",\"event\":");
+            appendJsonString(line, knownFormat ? formats[record.m_formatId].m_name : std::to_string(record.m_formatId));
+            line.append(",\"message\":");
+            appendJsonString(line, message);
+            line.append(",\"args\":[");
+            for (size_t i = 0; i < record.m_arguments.size(); ++i)
+            {
+                if (i > 0)
+                {
+                    line.push_back(',');
+                }
+                appendJsonArgument(line, record.m_arguments[i]);
+            }
+            line.append("]}");
+        }
+        else
+        {
+            line.append(GSDKLogRecord::formatTimestamp(record.m_timestampNs));
+            line.push_back(' ');
+            line.append(getLevelName(record.m_level));
+            line.push_back(' ');
+            line.append(message);
+        }
+        std::cout << line << '\n';
+    }
+    return true;
+}
+
+static bool endsWith(const std::string &value, const std::string &suffix)
+{
+    return value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static std::vector<std::string> getSegmentsFromIndex(const std::string &indexPath)
+{
+    std::vector<std::string> segments;
+    size_t separator = indexPath.find_last_of("/\\");
+    std::string folder = separator == std::string::npos ? "" : indexPath.substr(0, separator + 1);
+
+    std::ifstream index(indexPath);
+    std::string line;
+    while (std::getline(index, line))
+    {
+        std::string name = line.substr(0, line.find('\t'));
+        if (!name.empty())
+        {
+            segments.push_back(folder + name);
+        }
+    }
+    return segments;
+}
+
+int main(int argc, char *argv[])
+{
+    bool json = false;
+    std::vector<std::string> segments;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument = argv[i];
+        if (argument == "--json")
+        {
+            json = true;
+        }
+        else if (endsWith(argument, ".index"))
+        {
+            std::vector<std::string> indexed = getSegmentsFromIndex(argument);
+            segments.insert(segments.end(), indexed.begin(), indexed.end());
+        }
+        else
+        {
+            segments.push_back(argument);
+        }
+    }
+
+    if (segments.empty())
+    {
+        std::cerr << "Usage: " << argv[0] << " [--json] <GSDK_output_<time>.index | segment.bin>..." << std::endl;
+        return 2;
+    }
+
+    bool succeeded = true;
+    for (const std::string &segment : segments)
+    {
+        succeeded = decodeSegment(segment, json) && succeeded;
+    }
+    return succeeded ? 0 : 1;
+}
@@ -0,0 +1,129 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+// Measures PlayFab API calls with large responses through PlayFabHttp.
+//
+//   GSDK_PlayFabBenchmark <titleId> <secretKey> <segmentId> [calls] [concurrency] [environment] [compression]
+//
+// Queues the given number of Server/GetPlayersInSegment calls (8 by default) at once, up to concurrency
+// (4 by default) in flight, and reports their latency and how many player profiles were received per second,
+// followed by the PlayFabHttpStats byte and CPU counters.
+// environment replaces PlayFabSettings::productionEnvironmentURL, so "localhost" as the title and ":8443"
+// as the environment benchmark against a local stand-in serving canned multi-MB responses.
+// compression "none" turns off Accept-Encoding; a number sets PlayFabSettings::requestCompressionThreshold.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+#include <playfab/PlayFabServerApi.h>
+#include <playfab/PlayFabSettings.h>
+
+using namespace PlayFab;
+
+namespace
+{
+    struct Call
+    {
+        std::chrono::steady_clock::time_point m_start;
+        double m_ms;
+        size_t m_profiles;
+        bool m_done;
+        bool m_failed;
+    };
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 4)
+    {
+        fprintf(stderr, "usage: GSDK_PlayFabBenchmark <titleId> <secretKey> <segmentId> [calls] [concurrency] [environment]\n");
+        return 1;
+    }
+
+    PlayFabSettings::titleId = argv[1];
+    PlayFabSettings::developerSecretKey = argv[2];
+    const unsigned int callCount = argc > 4 ? static_cast<unsigned int>(atoi(argv[4])) : 8;
+    PlayFabSettings::maxConcurrentRequests = argc > 5 ? static_cast<unsigned int>(atoi(argv[5])) : 4;
+    if (argc > 6)
+    {
+        PlayFabSettings::productionEnvironmentURL = argv[6];
+    }
+    if (argc > 7)
+    {
+        if (std::string(argv[7]) == "none")
+        {
+            PlayFabSettings::acceptCompressedResponses = false;
+        }
+        else
+        {
+            PlayFabSettings::requestCompressionThreshold = static_cast<unsigned int>(atoi(argv[7]));
+        }
+    }
+
+    std::vector<Call> calls(callCount);
+    const auto start = std::chrono::steady_clock::now();
+    for (Call &call : calls)
+    {
+        call = {};
+        call.m_start = std::chrono::steady_clock::now();
+
+        ServerModels::GetPlayersInSegmentRequest request;
+        request.SegmentId = argv[3];
+        PlayFabServerAPI::GetPlayersInSegment(request,
+            [](const ServerModels::GetPlayersInSegmentResult &result, void *customData)
+            {
+                Call &call = *static_cast<Call *>(customData);
+                call.m_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - call.m_start).count();
+                call.m_profiles = result.PlayerProfiles.size();
+                call.m_done = true;
+            },
+            [](const PlayFabError &error, void *customData)
+            {
+                Call &call = *static_cast<Call *>(customData);
+                fprintf(stderr, "%s failed: %d %s %s\n", error.UrlPath.c_str(), error.HttpCode, error.ErrorName.c_str(), error.ErrorMessage.c_str());
+                call.m_failed = call.m_done = true;
+            },
+            &call);
+    }
+
+    // Results are delivered through Update, as a game's main loop would, with a 2 ms budget per frame
+    while (std::any_of(calls.begin(), calls.end(), [](const Call &call) { return !call.m_done; }))
+    {
+        IPlayFabHttp::Get().Update(calls.size(), std::chrono::milliseconds(2));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<double> latencies;
+    size_t profiles = 0;
+    for (const Call &call : calls)
+    {
+        if (!call.m_failed)
+        {
+            latencies.push_back(call.m_ms);
+            profiles += call.m_profiles;
+        }
+    }
+    if (latencies.empty())
+    {
+        return 1;
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("%8s %8s %12s %10s %10s %10s %14s\n", "calls", "failed", "profiles", "total ms", "p50 ms", "max ms", "profiles/s");
+    printf("%8u %8u %12zu %10.1f %10.1f %10.1f %14.0f\n", callCount, static_cast<unsigned int>(callCount - latencies.size()), profiles, totalMs,
+        latencies[latencies.size() / 2], latencies.back(), profiles / (totalMs / 1000.0));
+
+    const PlayFabHttpStats stats = PlayFabHttp::GetStats();
+    printf("\n%14s %14s %14s %14s %10s %10s %10s %10s\n", "request body", "request wire", "response body", "response wire",
+        "serialize", "compress", "parse", "worker cpu");
+    printf("%14llu %14llu %14llu %14llu %8.1fms %8.1fms %8.1fms %8.1fms\n",
+        static_cast<unsigned long long>(stats.requestBodyBytes), static_cast<unsigned long long>(stats.requestWireBytes),
+        static_cast<unsigned long long>(stats.responseBodyBytes), static_cast<unsigned long long>(stats.responseWireBytes),
+        stats.serializeMicroseconds / 1000.0, stats.compressMicroseconds / 1000.0, stats.parseMicroseconds / 1000.0, stats.workerCpuMicroseconds / 1000.0);
+    return 0;
+}
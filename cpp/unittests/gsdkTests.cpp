@@ -6,8 +6,19 @@
 
 #include "TestConfig.h"
 
+#include <playfab/PlayFabEventPipeline.h>
+#include <playfab/PlayFabHttp.h>
+#include <playfab/PlayFabReadCache.h>
+#include <playfab/PlayFabRetryPolicy.h>
+#include <playfab/PlayFabSettings.h>
+
 #include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <set>
 #include <thread>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -17,6 +28,117 @@ namespace Microsoft
     {
         namespace Gaming
         {
+            // Stands in for PlayFabHttp: keeps the requests it is given until the test completes them
+            class FakePlayFabHttp : public PlayFab::IPlayFabHttp
+            {
+            public:
+                struct Request
+                {
+                    std::string urlPath;
+                    Json::Value body;
+                    PlayFab::RequestCompleteCallback internalCallback;
+                    PlayFab::SharedVoidPointer successCallback;
+                    PlayFab::ErrorCallback errorCallback;
+                    std::shared_ptr<PlayFab::PlayFabRequestState> state;
+                };
+
+                // Replaces the IPlayFabHttp instance until Uninstall
+                static FakePlayFabHttp& Install()
+                {
+                    FakePlayFabHttp* fake = new FakePlayFabHttp();
+                    httpInstance.reset(fake);
+                    return *fake;
+                }
+
+                static void Uninstall()
+                {
+                    httpInstance.reset();
+                }
+
+                void AddRequest(const std::string& urlPath, const std::string& authKey, const std::string& authValue, const Json::Value& requestBody, PlayFab::RequestCompleteCallback internalCallback, PlayFab::SharedVoidPointer successCallback, PlayFab::ErrorCallback errorCallback, void* customData) override
+                {
+                    AddRequestWithHandle(urlPath, authKey, authValue, requestBody, internalCallback, successCallback, errorCallback, customData);
+                }
+
+                PlayFab::PlayFabRequestHandle AddRequestWithHandle(const std::string& urlPath, const std::string&, const std::string&, const Json::Value& requestBody, PlayFab::RequestCompleteCallback internalCallback, PlayFab::SharedVoidPointer successCallback, PlayFab::ErrorCallback errorCallback, void*) override
+                {
+                    Request request;
+                    request.urlPath = urlPath;
+                    request.body = requestBody;
+                    request.internalCallback = internalCallback;
+                    request.successCallback = successCallback;
+                    request.errorCallback = errorCallback;
+                    request.state = std::make_shared<PlayFab::PlayFabRequestState>();
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_requests.push_back(request);
+                    }
+                    m_requestAdded.notify_all();
+                    return PlayFab::PlayFabRequestHandle(request.state);
+                }
+
+                // Pretends count results are waiting for Update()
+                void SetResults(size_t count)
+                {
+                    m_results = count;
+                }
+
+                size_t UpdateCalls() const
+                {
+                    return m_updateCalls;
+                }
+
+                size_t Update() override
+                {
+                    const size_t waiting = m_results;
+                    if (waiting > 0)
+                    {
+                        --m_results;
+                        ++m_updateCalls;
+                    }
+                    return waiting;
+                }
+
+                bool WaitForRequests(size_t count, std::chrono::milliseconds timeout)
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    return m_requestAdded.wait_for(lock, timeout, [this, count]() { return m_requests.size() >= count; });
+                }
+
+                size_t RequestCount()
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    return m_requests.size();
+                }
+
+                Request GetRequest(size_t index)
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    return m_requests.at(index);
+                }
+
+                // Delivers the result on the calling thread, as PlayFabHttp does with threadedCallbacks
+                void Complete(size_t index, bool succeeded)
+                {
+                    Request request = GetRequest(index);
+                    PlayFab::CallRequestContainer container;
+                    container.successCallback = request.successCallback;
+                    container.errorCallback = request.errorCallback;
+                    if (succeeded)
+                        request.internalCallback(container);
+                    else
+                        request.errorCallback(container.errorWrapper, nullptr);
+                    request.state->MarkDone();
+                }
+
+            private:
+                std::mutex m_mutex;
+                std::condition_variable m_requestAdded;
+                std::vector<Request> m_requests;
+                size_t m_results = 0;
+                size_t m_updateCalls = 0;
+            };
+
             TEST_CLASS(GSDKTests)
             {
             public:
@@ -24,6 +146,7 @@ namespace Microsoft
                 {
                     // Cleaning up the test instance between tests
                     GSDKInternal::testConfiguration.reset();
+                    GSDKInternal::m_instancePtr = nullptr;
                     GSDKInternal::m_instance.reset();
                 }
 
@@ -172,6 +295,20 @@ namespace Microsoft
                     Assert::AreEqual(GSDKInternal::m_instance->m_nextHeartbeatIntervalMs, 30000, L"Verify heartbeat interval was captured from the heartbeat");
                 }
 
+                TEST_METHOD(GetStateReflectsAgentOperations)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+
+                    Assert::IsTrue(GSDK::getState() == GameState::Initializing, L"Verify initial state.");
+
+                    GSDKInternal::m_instance->setState(GameState::StandingBy);
+                    Assert::IsTrue(GSDK::getState() == GameState::StandingBy, L"Verify state after standing by.");
+
+                    GSDKInternal::m_instance->decodeHeartbeatResponse(R"({ "operation":"Active" })");
+                    Assert::IsTrue(GSDK::getState() == GameState::Active, L"Verify state after the agent allocated us.");
+                }
+
                 TEST_METHOD(GameState_MaintV2_CallbackInvoked)
                 {
                     GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
@@ -461,7 +598,884 @@ namespace Microsoft
                     Assert::IsTrue(shutdownCalled, L"Verify our shutdown callback was called.");
                 }
 
+                TEST_METHOD(LogWriterWritesQueuedMessagesOnFlush)
+                {
+                    const std::string logPath = "GSDK_LogWriterTest.txt";
+                    GSDKLogWriter writer;
+                    GSDKLogWriter::Options options;
+                    options.m_capacity = 16;
+                    options.m_policy = GSDKLogWriter::OverflowPolicy::Block;
+                    options.m_maxSegmentBytes = GSDKLogSegments::c_minSegmentBytes;
+                    options.m_maxSegmentCount = 1;
+                    Assert::IsTrue(writer.open("", "GSDK_LogWriterTest", options), L"Verify the log file opened.");
+
+                    for (int i = 0; i < 100; ++i)
+                    {
+                        Assert::IsTrue(writer.write("message " + std::to_string(i)), L"Verify nothing is dropped when blocking.");
+                    }
+                    writer.flush();
+
+                    std::ifstream logFile(logPath);
+                    std::string line;
+                    int lineCount = 0;
+                    while (std::getline(logFile, line))
+                    {
+                        Assert::AreEqual("message " + std::to_string(lineCount), line, L"Verify messages are written in order.");
+                        lineCount++;
+                    }
+                    Assert::AreEqual(100, lineCount, L"Verify every message reached the file after flush.");
+
+                    logFile.close();
+                    writer.close();
+                    std::remove(logPath.c_str());
+                    std::remove("GSDK_LogWriterTest.index");
+                }
+
+                TEST_METHOD(LogSegmentsRotateAndKeepOnlyTheNewest)
+                {
+                    GSDKLogSegments segments;
+                    Assert::IsTrue(segments.open("", "GSDK_LogSegmentsTest", ".txt", GSDKLogSegments::c_minSegmentBytes, 2), L"Verify the first segment opened.");
+
+                    // Each batch fills half a segment, so four batches need four segments and the first two get deleted
+                    std::string batch(static_cast<size_t>(GSDKLogSegments::c_minSegmentBytes / 2), 'x');
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        segments.append(batch.data(), batch.size());
+                        segments.append(batch.data(), batch.size());
+                    }
+                    segments.close();
+
+                    Assert::IsFalse(std::ifstream("GSDK_LogSegmentsTest.txt").good(), L"Verify the oldest segment was deleted.");
+                    Assert::IsFalse(std::ifstream("GSDK_LogSegmentsTest.1.txt").good(), L"Verify the second oldest segment was deleted.");
+                    Assert::IsTrue(std::ifstream("GSDK_LogSegmentsTest.2.txt").good(), L"Verify the second newest segment was kept.");
+                    Assert::IsTrue(std::ifstream("GSDK_LogSegmentsTest.3.txt").good(), L"Verify the newest segment was kept.");
+
+                    std::ifstream index("GSDK_LogSegmentsTest.index");
+                    std::string line;
+                    std::vector<std::string> indexLines;
+                    while (std::getline(index, line))
+                    {
+                        indexLines.push_back(line);
+                    }
+                    index.close();
+                    Assert::AreEqual((size_t)2, indexLines.size(), L"Verify the index lists the segments on disk.");
+                    Assert::AreEqual(std::string("GSDK_LogSegmentsTest.2.txt\t") + std::to_string(GSDKLogSegments::c_minSegmentBytes), indexLines[0], L"Verify the index is oldest first with sizes.");
+
+                    std::remove("GSDK_LogSegmentsTest.2.txt");
+                    std::remove("GSDK_LogSegmentsTest.3.txt");
+                    std::remove("GSDK_LogSegmentsTest.index");
+                }
+
+                TEST_METHOD(LogRecordsDecodeToTheSameTextAsTheirFormat)
+                {
+                    std::string encoded;
+                    GSDKLogRecord::encode(encoded, GSDKLogLevel::Error, GSDKLogFormat::AgentNonSuccess, 503L, std::string("Service Unavailable"));
+
+                    GSDKLogRecord::Record record;
+                    Assert::AreEqual(encoded.size(), GSDKLogRecord::decode(encoded.data(), encoded.size(), record), L"Verify the whole record was read.");
+                    Assert::IsTrue(record.m_level == GSDKLogLevel::Error, L"Verify the level round trips.");
+                    Assert::AreEqual((size_t)2, record.m_arguments.size(), L"Verify both arguments were recorded.");
+                    Assert::AreEqual((size_t)0, GSDKLogRecord::decode(encoded.data(), encoded.size() - 1, record), L"Verify a truncated record is rejected.");
+
+                    GSDKLogRecord::decode(encoded.data(), encoded.size(), record);
+                    std::string text;
+                    GSDKLogRecord::format(GSDKLogFormatStrings[record.m_formatId], record, text);
+                    Assert::AreEqual(std::string("Received non-success code from Agent.  Status Code: 503 Response Body: Service Unavailable"), text);
+                }
+
+                TEST_METHOD(TraceSpansAreWrittenAsChromeTraceJson)
+                {
+                    const std::string tracePath = "GSDK_TraceTest.json";
+                    const char *controlCharacters = "Span\twith\ncontrol \x01 characters";
+                    GSDKTrace::setEnabled(true);
+                    {
+                        GSDKTraceSpan span("TraceSpansAreWrittenAsChromeTraceJson", "test");
+                        GSDKTraceSpan escapedSpan(controlCharacters, "test");
+                    }
+                    GSDKTrace::setEnabled(false);
+                    Assert::IsTrue(GSDKTrace::writeChromeTrace(tracePath), L"Verify the trace was written.");
+
+                    std::ifstream traceFile(tracePath);
+                    std::string traceJson((std::istreambuf_iterator<char>(traceFile)), std::istreambuf_iterator<char>());
+                    traceFile.close();
+                    std::remove(tracePath.c_str());
+
+                    Assert::IsTrue(traceJson.find("\"Span\\twith\\ncontrol \\u0001 characters\"") != std::string::npos, L"Verify control characters are escaped.");
+
+                    bool foundSpan = false;
+                    bool foundEscapedSpan = false;
+                    Json::Value trace = parseJson(traceJson);
+                    for (const Json::Value &traceEvent : trace["traceEvents"])
+                    {
+                        if (traceEvent["name"].asString() == "TraceSpansAreWrittenAsChromeTraceJson")
+                        {
+                            foundSpan = true;
+                            Assert::AreEqual(std::string("X"), traceEvent["ph"].asString(), L"Verify spans are complete events.");
+                            Assert::IsTrue(traceEvent["dur"].asDouble() >= 0, L"Verify the span has a duration.");
+                        }
+                        foundEscapedSpan = foundEscapedSpan || traceEvent["name"].asString() == controlCharacters;
+                    }
+                    Assert::IsTrue(foundSpan, L"Verify the span is in the trace.");
+                    Assert::IsTrue(foundEscapedSpan, L"Verify names with control characters are escaped and read back unchanged.");
+                }
+
+                TEST_METHOD(LogThrottleCollapsesRepeatedMessages)
+                {
+                    const std::string logPath = "GSDK_LogThrottleTest.txt";
+                    GSDKLogWriter writer;
+                    GSDKLogWriter::Options options;
+                    options.m_policy = GSDKLogWriter::OverflowPolicy::Block;
+                    Assert::IsTrue(writer.open("", "GSDK_LogThrottleTest", options), L"Verify the log file opened.");
+
+                    GSDKLogThrottle throttle;
+                    for (int i = 0; i < 100; ++i)
+                    {
+                        throttle.log(writer, GSDKLogLevel::Error, GSDKLogFormat::AgentNonSuccess, 503L, std::string("Service Unavailable"));
+                    }
+                    GSDKLogThrottle::flushAll(writer);
+                    writer.close();
+
+                    std::ifstream logFile(logPath);
+                    std::vector<std::string> lines;
+                    std::string line;
+                    while (std::getline(logFile, line))
+                    {
+                        lines.push_back(line);
+                    }
+                    logFile.close();
+                    std::remove(logPath.c_str());
+                    std::remove("GSDK_LogThrottleTest.index");
+
+                    Assert::AreEqual((size_t)2, lines.size(), L"Verify the repeats collapsed into one summary line.");
+                    Assert::IsTrue(lines[1].find("repeated 99 more times") != std::string::npos, L"Verify the summary has the repeat count.");
+                }
+
+                TEST_METHOD(MetricsPageIsReadableFromTheFile)
+                {
+                    const std::string pagePath = "GSDK_MetricsPageTest.page";
+                    GSDKMetricsPage page;
+                    Assert::IsTrue(page.open(pagePath), L"Verify the page was mapped.");
+
+                    GSDKMetricsSnapshot snapshot = {};
+                    snapshot.m_gameState = static_cast<uint32_t>(GameState::Active);
+                    snapshot.m_connectedPlayers = 12;
+                    snapshot.m_heartbeatsSent = 42;
+                    page.publish(snapshot);
+
+                    // Read it back the way a sidecar would, through the file rather than our mapping
+                    std::vector<uint64_t> fileContents(c_metricsPageFileSize / sizeof(uint64_t));
+                    std::ifstream pageFile(pagePath, std::ifstream::in | std::ifstream::binary);
+                    pageFile.read(reinterpret_cast<char *>(fileContents.data()), c_metricsPageFileSize);
+                    pageFile.close();
+
+                    GSDKMetricsSnapshot readBack = {};
+                    Assert::IsTrue(GSDKMetricsPage::read(fileContents.data(), readBack), L"Verify the page is consistent.");
+                    Assert::AreEqual((uint32_t)GameState::Active, readBack.m_gameState);
+                    Assert::AreEqual((uint32_t)12, readBack.m_connectedPlayers);
+                    Assert::AreEqual((uint64_t)42, readBack.m_heartbeatsSent);
+
+                    page.close();
+                    std::remove(pagePath.c_str());
+                }
+
+                TEST_METHOD(CustomMetricsAreAggregatedAcrossThreads)
+                {
+                    std::thread otherThread([]()
+                    {
+                        GSDK::incrementCounter("unitTestBytes", 100);
+                        GSDK::recordHistogram("unitTestTickMs", 3);
+                    });
+                    otherThread.join();
+
+                    GSDK::incrementCounter("unitTestBytes", 20);
+                    GSDK::recordHistogram("unitTestTickMs", 0.75);
+                    GSDK::recordMetric("unitTestBytes", 7); // already a counter, ignored
+                    GSDK::recordMetric("unitTestPlayers", 3);
+                    GSDK::recordMetric("unitTestPlayers", 5);
+
+                    Json::Value batch = parseJson(GSDKCustomMetrics::collect(1000));
+                    Assert::AreEqual(1000u, batch["intervalMs"].asUInt());
+
+                    Json::Value counter = batch["metrics"][0];
+                    Assert::AreEqual(std::string("unitTestBytes"), counter["name"].asString());
+                    Assert::AreEqual(std::string("Counter"), counter["type"].asString());
+                    Assert::AreEqual(120.0, counter["value"].asDouble());
+
+                    Json::Value histogram = batch["metrics"][1];
+                    Assert::AreEqual(2u, histogram["count"].asUInt());
+                    Assert::AreEqual(3.75, histogram["sum"].asDouble());
+                    Assert::AreEqual(1.0, histogram["buckets"][0]["lessThan"].asDouble());
+                    Assert::AreEqual(4.0, histogram["buckets"][1]["lessThan"].asDouble());
+
+                    Json::Value gauge = batch["metrics"][2];
+                    Assert::AreEqual(std::string("Gauge"), gauge["type"].asString());
+                    Assert::AreEqual(5.0, gauge["value"].asDouble(), L"Verify a gauge reports the last value set.");
+
+                    // Only what was recorded since the previous batch is sent, gauges included
+                    Assert::IsTrue(GSDKCustomMetrics::collect(1000).empty(), L"Verify nothing is reported twice.");
+
+                    GSDK::recordMetric("unitTestPlayers", 4);
+                    batch = parseJson(GSDKCustomMetrics::collect(1000));
+                    Assert::AreEqual(1u, batch["metrics"].size(), L"Verify only the gauge that was set is sent.");
+                    Assert::AreEqual(4.0, batch["metrics"][0]["value"].asDouble());
+                }
+
+                TEST_METHOD(FrameTimeStatsReportPercentiles)
+                {
+                    Assert::AreEqual(5u, GSDKFrameMonitor::getBucketIndex(5));
+                    Assert::AreEqual((uint64_t)16384, GSDKFrameMonitor::getBucketUpperBoundUs(GSDKFrameMonitor::getBucketIndex(16000)));
+
+                    for (int i = 0; i < 98; ++i)
+                    {
+                        GSDK::recordFrame(2);
+                    }
+                    GSDK::recordFrame(40);
+                    GSDK::recordFrame(50);
+
+                    FrameTimeStats stats = GSDK::getFrameTimeStats(GSDKFrameMonitor::c_maxSeconds);
+                    Assert::AreEqual(100ull, stats.m_frameCount);
+                    Assert::AreEqual(2.86, stats.m_averageMs, 0.001);
+                    Assert::AreEqual(2.048, stats.m_p50Ms, 0.001);  // top of the 1.92-2.048 ms bucket
+                    Assert::AreEqual(40.96, stats.m_p99Ms, 0.001); // 40 ms rounds up to its bucket, 40.96 ms
+                    Assert::AreEqual(50.0, stats.m_maxMs, 0.001);
+                }
+
+                TEST_METHOD(ResourceSamplerReadsProcessUsage)
+                {
+                    GSDKResourceSampler sampler;
+                    sampler.open();
+
+                    ProcessResourceUsage usage;
+                    sampler.sample(usage);
+                    Assert::IsTrue(usage.m_sampleTimeUnixMs > 0, L"Verify the sample is timestamped.");
+                    Assert::IsTrue(usage.m_residentBytes > 0, L"Verify the process has resident memory.");
+                    Assert::IsTrue(usage.m_openFileDescriptors > 0, L"Verify open files or handles are counted.");
+                    Assert::AreEqual(0.0, usage.m_cpuPercent, L"Verify the first sample has nothing to compare CPU time against.");
+
+                    sampler.close();
+                }
+
+                TEST_METHOD(WatchdogReportsUnhealthyWhenNotPetted)
+                {
+                    GSDKInternal::testConfiguration = std::make_unique<TestConfig>("heartbeatEndpoint", "serverId", "logFolder", "sharedContentFolder");
+                    GSDK::start();
+                    GSDK::setWatchdogTimeout(50);
+
+                    GSDK::petWatchdog();
+                    Json::Value jsonHeartbeatRequest = parseJson(GSDKInternal::m_instance->encodeHeartbeatRequest());
+                    Assert::AreEqual("Healthy", jsonHeartbeatRequest["CurrentGameHealth"].asCString(), L"Verifying a petted watchdog is healthy.");
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                    jsonHeartbeatRequest = parseJson(GSDKInternal::m_instance->encodeHeartbeatRequest());
+                    Assert::AreEqual("Unhealthy", jsonHeartbeatRequest["CurrentGameHealth"].asCString(), L"Verifying a stalled game is unhealthy.");
+
+                    GSDK::petWatchdog();
+                    jsonHeartbeatRequest = parseJson(GSDKInternal::m_instance->encodeHeartbeatRequest());
+                    Assert::AreEqual("Healthy", jsonHeartbeatRequest["CurrentGameHealth"].asCString(), L"Verifying the game recovers once it pets the watchdog.");
+
+                    GSDK::setWatchdogTimeout(0);
+                }
+
+                TEST_METHOD(SharedContentIsMappedReadOnly)
+                {
+                    {
+                        std::ofstream file("sharedContentTest.bin", std::ios::binary);
+                        file << "shared asset";
+                    }
+
+                    GSDKSharedContent sharedContent;
+                    sharedContent.setRoot(".");
+
+                    SharedContentView view = sharedContent.map("sharedContentTest.bin");
+                    Assert::IsTrue(view.m_data != nullptr, L"Verify the file is mapped.");
+                    Assert::AreEqual(12ULL, view.m_size);
+                    Assert::AreEqual(std::string("shared asset"), std::string(reinterpret_cast<const char *>(view.m_data), static_cast<size_t>(view.m_size)));
+                    Assert::IsTrue(view.m_data == sharedContent.map("sharedContentTest.bin").m_data, L"Verify the mapping is reused.");
+                    Assert::IsTrue(sharedContent.prefetch("sharedContentTest.bin", 0, 0), L"Verify prefetching succeeds.");
+
+                    std::vector<std::string> files = sharedContent.getFiles();
+                    Assert::IsTrue(std::find(files.begin(), files.end(), "sharedContentTest.bin") != files.end(), L"Verify the file is indexed.");
+
+                    Assert::IsTrue(sharedContent.map("missing.bin").m_data == nullptr, L"Verify missing files aren't mapped.");
+                    Assert::IsTrue(sharedContent.map("../sharedContentTest.bin").m_data == nullptr, L"Verify paths can't leave the directory.");
+                }
+
+                TEST_METHOD(SharedContentWarmupReadsSelectedDirectories)
+                {
+                    CreateDirectoryA("warmupTest", nullptr);
+                    {
+                        std::ofstream file("warmupTest/asset.bin", std::ios::binary);
+                        file << std::string(GSDKContentWarmup::c_chunkBytes + 1000, 'x');
+                    }
+
+                    GSDKSharedContent sharedContent;
+                    sharedContent.setRoot(".");
+                    GSDKContentWarmup warmup;
+                    Assert::IsTrue(warmup.start(sharedContent, { "warmupTest" }, 2, 1.0), L"Verify the warmup starts.");
+                    Assert::IsFalse(warmup.start(sharedContent, { "warmupTest" }, 2, 1.0), L"Verify only the first call starts a warmup.");
+
+                    warmup.waitUntilReady();
+                    SharedContentWarmupProgress progress = warmup.getProgress();
+                    Assert::AreEqual(1U, progress.m_filesTotal);
+                    Assert::AreEqual(1U, progress.m_filesDone);
+                    Assert::AreEqual(static_cast<unsigned long long>(GSDKContentWarmup::c_chunkBytes + 1000), progress.m_bytesTotal);
+                    Assert::AreEqual(progress.m_bytesTotal, progress.m_bytesWarm);
+                }
+
+                TEST_METHOD(ContentManifestOnlyRehashesChangedFiles)
+                {
+                    Assert::AreEqual(0xef46db3751d8e999ULL, static_cast<unsigned long long>(GSDKContentManifest::hash("", 0)));
+                    Assert::AreEqual(0xfbcea83c8a378bf1ULL, static_cast<unsigned long long>(GSDKContentManifest::hash("Nobody inspects the spammish repetition", 39)));
+
+                    CreateDirectoryA("manifestTest", nullptr);
+                    remove("manifestTest/GSDK_content.manifest");
+                    {
+                        std::ofstream file("manifestTest/asset.bin", std::ios::binary);
+                        file << "asset contents";
+                    }
+
+                    GSDKSharedContent sharedContent;
+                    sharedContent.setRoot("manifestTest");
+                    SharedContentManifest manifest = GSDKContentManifest::build(sharedContent, 2);
+                    Assert::AreEqual(static_cast<size_t>(1), manifest.m_files.size());
+                    Assert::AreEqual(1U, manifest.m_filesHashed);
+                    Assert::AreEqual(std::string("asset.bin"), manifest.m_files[0].m_path);
+                    Assert::AreEqual(14ULL, manifest.m_files[0].m_size);
+
+                    GSDKSharedContent otherServer;
+                    otherServer.setRoot("manifestTest");
+                    SharedContentManifest revalidated = GSDKContentManifest::build(otherServer, 2);
+                    Assert::AreEqual(0U, revalidated.m_filesHashed, L"Verify unchanged files are taken from the saved manifest.");
+                    Assert::AreEqual(manifest.m_files[0].m_hash, revalidated.m_files[0].m_hash);
+                }
+
+                TEST_METHOD(PlayFabRetryPolicyRetriesOnlyWhatIsSafeToRetry)
+                {
+                    using PlayFab::PlayFabRetryPolicy;
+                    typedef PlayFabRetryPolicy::Outcome Outcome;
+                    PlayFab::PlayFabError error = PlayFab::PlayFabError();
+
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_COULDNT_CONNECT, 0, error) == Outcome::NotSent, L"Verify a failed connect was never sent.");
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_COULDNT_RESOLVE_HOST, 0, error) == Outcome::NotSent);
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OPERATION_TIMEDOUT, 0, error) == Outcome::NoResponse, L"Verify a timeout may have been processed.");
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_RECV_ERROR, 0, error) == Outcome::NoResponse);
+
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OK, 429, error) == Outcome::Throttled, L"Verify a proxy's 429 is throttling.");
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OK, 503, error) == Outcome::ServerError, L"Verify a proxy's 5xx is a server error.");
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OK, 400, error) == Outcome::Rejected, L"Verify other 4xx are rejected.");
+
+                    // With X-ReportErrorAsSuccess the HTTP status is 200 and the real one is in the body
+                    error.HttpCode = 200;
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OK, 200, error) == Outcome::Success);
+                    error.HttpCode = 429;
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OK, 200, error) == Outcome::Throttled);
+                    error.HttpCode = 500;
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OK, 200, error) == Outcome::ServerError);
+                    error.HttpCode = 400;
+                    error.ErrorCode = PlayFab::PlayFabErrorAPIClientRequestRateLimitExceeded;
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OK, 200, error) == Outcome::Throttled, L"Verify the rate limit error code is throttling.");
+                    error.ErrorCode = PlayFab::PlayFabErrorServiceUnavailable;
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OK, 200, error) == Outcome::ServerError, L"Verify ServiceUnavailable is a server error.");
+                    error.ErrorCode = PlayFab::PlayFabErrorInvalidParams;
+                    Assert::IsTrue(PlayFabRetryPolicy::Classify(CURLE_OK, 200, error) == Outcome::Rejected);
+
+                    const unsigned int savedMaxRetries = PlayFab::PlayFabSettings::maxRetries;
+                    PlayFab::PlayFabSettings::maxRetries = 3;
+                    const std::string read = "/Server/GetUserData";
+                    const std::string grant = "/Server/GrantItemsToUser";
+                    Assert::IsTrue(PlayFabRetryPolicy::ShouldRetry(Outcome::Throttled, grant, 0), L"Verify throttled calls are retried, they weren't processed.");
+                    Assert::IsTrue(PlayFabRetryPolicy::ShouldRetry(Outcome::NotSent, grant, 0), L"Verify calls that were never sent are retried.");
+                    Assert::IsFalse(PlayFabRetryPolicy::ShouldRetry(Outcome::ServerError, grant, 0), L"Verify a non-idempotent call isn't retried after a 5xx.");
+                    Assert::IsFalse(PlayFabRetryPolicy::ShouldRetry(Outcome::NoResponse, grant, 0), L"Verify a non-idempotent call isn't retried after a timeout.");
+                    Assert::IsTrue(PlayFabRetryPolicy::ShouldRetry(Outcome::ServerError, read, 0), L"Verify an idempotent call is retried after a 5xx.");
+                    Assert::IsTrue(PlayFabRetryPolicy::ShouldRetry(Outcome::NoResponse, read, 2));
+                    Assert::IsFalse(PlayFabRetryPolicy::ShouldRetry(Outcome::NoResponse, read, 3), L"Verify retries stop at maxRetries.");
+                    Assert::IsFalse(PlayFabRetryPolicy::ShouldRetry(Outcome::Rejected, read, 0), L"Verify rejected calls aren't retried.");
+                    Assert::IsFalse(PlayFabRetryPolicy::ShouldRetry(Outcome::Success, read, 0));
+                    PlayFab::PlayFabSettings::maxRetries = savedMaxRetries;
+                }
+
+                TEST_METHOD(PlayFabRetryPolicyKnowsIdempotentApis)
+                {
+                    using PlayFab::PlayFabRetryPolicy;
+                    Assert::IsTrue(PlayFabRetryPolicy::IsIdempotent("/Server/GetUserData"));
+                    Assert::IsTrue(PlayFabRetryPolicy::IsIdempotent("/Client/LoginWithCustomID"));
+                    Assert::IsTrue(PlayFabRetryPolicy::IsIdempotent("/Server/UpdateUserData"), L"Verify absolute writes are idempotent.");
+                    Assert::IsTrue(PlayFabRetryPolicy::IsIdempotent("/Server/DeleteUsers"));
+                    Assert::IsFalse(PlayFabRetryPolicy::IsIdempotent("/Server/UpdatePlayerStatistics"), L"Verify statistic updates, which aggregate, aren't.");
+                    Assert::IsFalse(PlayFabRetryPolicy::IsIdempotent("/Server/UpdateUserStatistics"));
+                    Assert::IsFalse(PlayFabRetryPolicy::IsIdempotent("/Server/AddUserVirtualCurrency"));
+                    Assert::IsFalse(PlayFabRetryPolicy::IsIdempotent("/Server/GrantItemsToUser"));
+                    Assert::IsFalse(PlayFabRetryPolicy::IsIdempotent("/Server/WritePlayerEvent"));
+                }
+
+                TEST_METHOD(PlayFabRetryDelayIsJitteredAndHonorsRetryHints)
+                {
+                    using PlayFab::PlayFabRetryPolicy;
+                    const unsigned int savedBaseDelayMs = PlayFab::PlayFabSettings::retryBaseDelayMs;
+                    const unsigned int savedMaxDelayMs = PlayFab::PlayFabSettings::retryMaxDelayMs;
+                    PlayFab::PlayFabSettings::retryBaseDelayMs = 100;
+                    PlayFab::PlayFabSettings::retryMaxDelayMs = 1000;
+
+                    PlayFabRetryPolicy policy;
+                    const std::chrono::milliseconds noHint(0);
+                    std::set<long long> delays;
+                    for (int i = 0; i < 200; ++i)
+                    {
+                        const long long firstDelay = policy.GetRetryDelay(0, noHint).count();
+                        Assert::IsTrue(firstDelay >= 0 && firstDelay <= 100, L"Verify the first retry waits up to the base delay.");
+                        const long long thirdDelay = policy.GetRetryDelay(2, noHint).count();
+                        Assert::IsTrue(thirdDelay >= 0 && thirdDelay <= 400, L"Verify the delay doubles with every retry.");
+                        const long long lateDelay = policy.GetRetryDelay(10, noHint).count();
+                        Assert::IsTrue(lateDelay >= 0 && lateDelay <= 1000, L"Verify the delay is capped at retryMaxDelayMs.");
+                        delays.insert(thirdDelay);
+                    }
+                    Assert::IsTrue(delays.size() > 10, L"Verify the delays are jittered.");
+                    Assert::AreEqual(5000LL, static_cast<long long>(policy.GetRetryDelay(0, std::chrono::milliseconds(5000)).count()), L"Verify the server's hint is waited for.");
+
+                    Json::Value response;
+                    Assert::AreEqual(3000LL, static_cast<long long>(PlayFabRetryPolicy::GetRetryHint(3, response).count()), L"Verify the Retry-After header is used.");
+                    response["retryAfterSeconds"] = 7;
+                    Assert::AreEqual(7000LL, static_cast<long long>(PlayFabRetryPolicy::GetRetryHint(0, response).count()), L"Verify retryAfterSeconds is used.");
+                    Assert::AreEqual(10000LL, static_cast<long long>(PlayFabRetryPolicy::GetRetryHint(10, response).count()), L"Verify the longer of the two is used.");
+
+                    PlayFab::PlayFabSettings::retryBaseDelayMs = savedBaseDelayMs;
+                    PlayFab::PlayFabSettings::retryMaxDelayMs = savedMaxDelayMs;
+                }
+
+                TEST_METHOD(PlayFabCircuitOpensFailsFastAndClosesAfterAProbe)
+                {
+                    using PlayFab::PlayFabRetryPolicy;
+                    typedef PlayFabRetryPolicy::Outcome Outcome;
+                    const unsigned int savedThreshold = PlayFab::PlayFabSettings::circuitBreakerThreshold;
+                    const unsigned int savedOpenMs = PlayFab::PlayFabSettings::circuitBreakerOpenMs;
+                    PlayFab::PlayFabSettings::circuitBreakerThreshold = 3;
+                    PlayFab::PlayFabSettings::circuitBreakerOpenMs = 1000;
+
+                    PlayFabRetryPolicy policy;
+                    auto now = std::chrono::steady_clock::now();
+                    uint64_t probe = 0;
+                    policy.RecordOutcome(Outcome::ServerError, now);
+                    policy.RecordOutcome(Outcome::NoResponse, now);
+                    policy.RecordOutcome(Outcome::Rejected, now); // PlayFab answered, so it is up
+                    policy.RecordOutcome(Outcome::Throttled, now);
+                    policy.RecordOutcome(Outcome::NotSent, now);
+                    Assert::IsTrue(policy.AllowRequest(now, probe), L"Verify only failures in a row open the circuit.");
+
+                    policy.RecordOutcome(Outcome::ServerError, now);
+                    Assert::IsFalse(policy.AllowRequest(now, probe), L"Verify the circuit opens at the threshold.");
+                    Assert::IsFalse(policy.AllowRequest(now + std::chrono::milliseconds(999), probe), L"Verify requests fail fast while it is open.");
+
+                    now += std::chrono::milliseconds(1000);
+                    Assert::IsTrue(policy.AllowRequest(now, probe), L"Verify a probe is let through once it has been open long enough.");
+                    Assert::IsTrue(probe != 0);
+                    uint64_t other = 0;
+                    Assert::IsFalse(policy.AllowRequest(now, other), L"Verify other requests still fail fast while the probe is in flight.");
+
+                    policy.RecordOutcome(Outcome::ServerError, now);
+                    Assert::IsFalse(policy.AllowRequest(now + std::chrono::milliseconds(999), other), L"Verify a failed probe opens the circuit again.");
+
+                    now += std::chrono::milliseconds(1000);
+                    Assert::IsTrue(policy.AllowRequest(now, probe), L"Verify the next probe is let through.");
+                    policy.RecordOutcome(Outcome::Success, now);
+                    Assert::IsTrue(policy.AllowRequest(now, other), L"Verify a successful probe closes the circuit.");
+                    Assert::IsTrue(policy.AllowRequest(now, other), L"Verify every request is let through again.");
+                    Assert::IsTrue(other == 0, L"Verify requests aren't probes while the circuit is closed.");
+
+                    PlayFab::PlayFabSettings::circuitBreakerThreshold = savedThreshold;
+                    PlayFab::PlayFabSettings::circuitBreakerOpenMs = savedOpenMs;
+                }
+
+                TEST_METHOD(PlayFabCircuitReopensWhenItsProbeIsCancelled)
+                {
+                    using PlayFab::PlayFabRetryPolicy;
+                    const unsigned int savedThreshold = PlayFab::PlayFabSettings::circuitBreakerThreshold;
+                    const unsigned int savedOpenMs = PlayFab::PlayFabSettings::circuitBreakerOpenMs;
+                    PlayFab::PlayFabSettings::circuitBreakerThreshold = 2;
+                    PlayFab::PlayFabSettings::circuitBreakerOpenMs = 1000;
+
+                    PlayFabRetryPolicy policy;
+                    auto now = std::chrono::steady_clock::now();
+                    uint64_t probe = 0;
+                    uint64_t other = 0;
+                    policy.RecordOutcome(PlayFabRetryPolicy::Outcome::ServerError, now);
+                    policy.RecordOutcome(PlayFabRetryPolicy::Outcome::ServerError, now);
+                    Assert::IsFalse(policy.AllowRequest(now, other), L"Verify the circuit opened.");
+
+                    now += std::chrono::milliseconds(1000);
+                    Assert::IsTrue(policy.AllowRequest(now, probe), L"Verify one request probes once the circuit has been open long enough.");
+                    Assert::IsTrue(probe != 0, L"Verify the probe got a token.");
+                    Assert::IsFalse(policy.AllowRequest(now, other), L"Verify only one request probes at a time.");
+
+                    // The probe is cancelled, so it never records an outcome
+                    policy.AbandonProbe(probe, now);
+                    uint64_t nextProbe = 0;
+                    Assert::IsTrue(policy.AllowRequest(now, nextProbe), L"Verify the next request probes instead.");
+                    Assert::IsTrue(nextProbe != 0 && nextProbe != probe, L"Verify the new probe got its own token.");
+
+                    policy.AbandonProbe(probe, now);
+                    Assert::IsFalse(policy.AllowRequest(now, other), L"Verify the old token doesn't let a second probe through.");
+
+                    policy.RecordOutcome(PlayFabRetryPolicy::Outcome::Success, now);
+                    Assert::IsTrue(policy.AllowRequest(now, other), L"Verify a successful probe closes the circuit.");
+                    Assert::IsTrue(other == 0, L"Verify requests aren't probes while the circuit is closed.");
+
+                    PlayFab::PlayFabSettings::circuitBreakerThreshold = savedThreshold;
+                    PlayFab::PlayFabSettings::circuitBreakerOpenMs = savedOpenMs;
+                }
+
+                TEST_METHOD(PlayFabEventPipelineSendsFullBatchesThenFlushesTheRest)
+                {
+                    PlayFabEventSettings settings(64, 10, 2000, 2, "custom.test");
+                    FakePlayFabHttp& http = FakePlayFabHttp::Install();
+                    const PlayFab::PlayFabEventPipelineStats before = PlayFab::PlayFabEventPipeline::GetStats();
+                    const auto created = std::chrono::steady_clock::now();
+                    std::unique_ptr<PlayFab::PlayFabEventPipeline> pipeline(new PlayFab::PlayFabEventPipeline());
+
+                    for (int i = 0; i < 25; ++i)
+                    {
+                        Assert::IsTrue(writePlayerEvent(*pipeline, i), L"Verify the event is queued.");
+                    }
+                    Assert::IsTrue(http.WaitForRequests(2, std::chrono::milliseconds(1000)), L"Verify full batches are sent without waiting for the flush interval.");
+                    for (size_t i = 0; i < 2; ++i)
+                    {
+                        const FakePlayFabHttp::Request request = http.GetRequest(i);
+                        Assert::AreEqual(std::string("/Event/WriteEvents"), request.urlPath);
+                        Assert::AreEqual(10U, request.body["Events"].size(), L"Verify a batch holds eventBatchSize events.");
+                        const Json::Value& event = request.body["Events"][0];
+                        Assert::AreEqual(std::string("custom.test"), event["EventNamespace"].asString());
+                        Assert::AreEqual(std::string("unit_test"), event["Name"].asString());
+                        Assert::AreEqual(std::string("master_player_account"), event["Entity"]["Type"].asString());
+                        Assert::AreEqual(static_cast<int>(i * 10), event["Payload"]["index"].asInt(), L"Verify events are sent in the order they were written.");
+                    }
+                    http.Complete(0, true);
+                    http.Complete(1, false);
+
+                    Assert::IsTrue(http.WaitForRequests(3, std::chrono::milliseconds(5000)), L"Verify the partial batch is sent.");
+                    Assert::IsTrue(std::chrono::steady_clock::now() - created >= std::chrono::milliseconds(2000), L"Verify the partial batch waited for the flush interval.");
+                    Assert::AreEqual(5U, http.GetRequest(2).body["Events"].size());
+                    http.Complete(2, true);
+
+                    Assert::AreEqual(static_cast<size_t>(0), pipeline->Shutdown(std::chrono::milliseconds(1000)), L"Verify every event was delivered.");
+                    pipeline.reset();
+                    FakePlayFabHttp::Uninstall();
+
+                    const PlayFab::PlayFabEventPipelineStats after = PlayFab::PlayFabEventPipeline::GetStats();
+                    Assert::AreEqual(25ULL, static_cast<unsigned long long>(after.eventsQueued - before.eventsQueued));
+                    Assert::AreEqual(25ULL, static_cast<unsigned long long>(after.eventsSent - before.eventsSent));
+                    Assert::AreEqual(15ULL, static_cast<unsigned long long>(after.eventsSucceeded - before.eventsSucceeded));
+                    Assert::AreEqual(10ULL, static_cast<unsigned long long>(after.eventsFailed - before.eventsFailed));
+                    Assert::AreEqual(3ULL, static_cast<unsigned long long>(after.batchesSent - before.batchesSent));
+                    Assert::AreEqual(0ULL, static_cast<unsigned long long>(after.eventsDropped - before.eventsDropped));
+                }
+
+                TEST_METHOD(PlayFabEventPipelineDropsWhenFullAndCountsUndeliveredEvents)
+                {
+                    PlayFabEventSettings settings(16, 4, 500, 1, "custom.test");
+                    FakePlayFabHttp& http = FakePlayFabHttp::Install();
+                    const PlayFab::PlayFabEventPipelineStats before = PlayFab::PlayFabEventPipeline::GetStats();
+                    std::unique_ptr<PlayFab::PlayFabEventPipeline> pipeline(new PlayFab::PlayFabEventPipeline());
+
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        Assert::IsTrue(writePlayerEvent(*pipeline, i));
+                    }
+                    Assert::IsTrue(http.WaitForRequests(1, std::chrono::milliseconds(5000)), L"Verify the full batch is sent.");
+
+                    // The first batch is outstanding, so nothing more is sent and the queue fills up
+                    int dropped = 0;
+                    for (int i = 4; i < 25; ++i)
+                    {
+                        if (!writePlayerEvent(*pipeline, i))
+                            ++dropped;
+                    }
+                    Assert::AreEqual(5, dropped, L"Verify events beyond the queue's capacity are dropped.");
+                    Assert::IsFalse(http.WaitForRequests(2, std::chrono::milliseconds(200)), L"Verify no more than eventBatchesInFlight requests are outstanding.");
+
+                    Assert::AreEqual(static_cast<size_t>(20), pipeline->Shutdown(std::chrono::milliseconds(200)), L"Verify the outstanding batch and the queued events are undelivered.");
+                    Assert::IsTrue(http.GetRequest(0).state->cancelled.load(), L"Verify the outstanding batch was cancelled.");
+                    PlayFab::ServerModels::WriteTitleEventRequest titleEvent;
+                    titleEvent.EventName = "unit_test";
+                    Assert::IsFalse(pipeline->WriteTitleEvent(titleEvent), L"Verify events are dropped after Shutdown.");
+                    pipeline.reset();
+                    FakePlayFabHttp::Uninstall();
+
+                    const PlayFab::PlayFabEventPipelineStats after = PlayFab::PlayFabEventPipeline::GetStats();
+                    Assert::AreEqual(20ULL, static_cast<unsigned long long>(after.eventsQueued - before.eventsQueued));
+                    Assert::AreEqual(22ULL, static_cast<unsigned long long>(after.eventsDropped - before.eventsDropped), L"Verify full, unsent and late events are counted as dropped.");
+                    Assert::AreEqual(4ULL, static_cast<unsigned long long>(after.eventsSent - before.eventsSent));
+                }
+
+                TEST_METHOD(PlayFabEventPipelineBoundsRequestsWhenSendingEventsOneByOne)
+                {
+                    PlayFabEventSettings settings(64, 10, 60000, 2, "");
+                    FakePlayFabHttp& http = FakePlayFabHttp::Install();
+                    std::unique_ptr<PlayFab::PlayFabEventPipeline> pipeline(new PlayFab::PlayFabEventPipeline());
+
+                    for (int i = 0; i < 10; ++i)
+                    {
+                        Assert::IsTrue(writePlayerEvent(*pipeline, i));
+                    }
+                    Assert::IsTrue(http.WaitForRequests(2, std::chrono::milliseconds(5000)));
+                    Assert::IsFalse(http.WaitForRequests(3, std::chrono::milliseconds(200)), L"Verify each event counts against eventBatchesInFlight.");
+                    const FakePlayFabHttp::Request first = http.GetRequest(0);
+                    Assert::AreEqual(std::string("/Server/WritePlayerEvent"), first.urlPath);
+                    Assert::AreEqual(std::string("unit_test"), first.body["EventName"].asString());
+                    Assert::AreEqual(0, first.body["Body"]["index"].asInt());
+
+                    // The rest of the batch goes out as requests complete, without waiting for the flush interval
+                    for (size_t completed = 0; completed < 8; ++completed)
+                    {
+                        http.Complete(completed, true);
+                        Assert::IsTrue(http.WaitForRequests(completed + 3, std::chrono::milliseconds(5000)), L"Verify a completed request makes room for the next event.");
+                        Assert::AreEqual(completed + 3, http.RequestCount());
+                    }
+                    http.Complete(8, true);
+                    http.Complete(9, true);
+
+                    Assert::AreEqual(static_cast<size_t>(0), pipeline->Shutdown(std::chrono::milliseconds(1000)));
+                    Assert::AreEqual(static_cast<size_t>(10), http.RequestCount());
+                    pipeline.reset();
+                    FakePlayFabHttp::Uninstall();
+                }
+
+                TEST_METHOD(PlayFabReadCacheSharesOneResponseBetweenIdenticalRequests)
+                {
+                    using PlayFab::PlayFabReadCache;
+                    typedef PlayFabReadCache::Lookup Lookup;
+                    PlayFabReadCache cache;
+                    const auto now = std::chrono::steady_clock::now();
+                    const std::chrono::milliseconds ttl(1000);
+                    const std::string key = PlayFabReadCache::MakeKey("/Server/GetTitleData", "unitTestSecret", parseJson("{\"Keys\": [\"motd\"]}"));
+
+                    PlayFab::CallRequestContainer leader;
+                    PlayFab::CallRequestContainer follower;
+                    Assert::IsTrue(cache.Find(key, leader, now) == Lookup::Miss, L"Verify the first request is sent.");
+                    Assert::IsTrue(cache.Find(key, follower, now) == Lookup::Joined, L"Verify an identical request waits for the one in flight.");
+
+                    PlayFab::PlayFabError result;
+                    result.HttpCode = 200;
+                    result.HttpStatus = "OK";
+                    result.Data["Data"]["motd"] = "hello";
+                    const std::vector<PlayFab::CallRequestContainer*> waiters = cache.Complete(key, result, ttl, now);
+                    Assert::AreEqual(static_cast<size_t>(1), waiters.size());
+                    Assert::IsTrue(waiters[0] == &follower, L"Verify the joined request gets the leader's result.");
+
+                    PlayFab::CallRequestContainer later;
+                    Assert::IsTrue(cache.Find(key, later, now + std::chrono::milliseconds(999)) == Lookup::Hit, L"Verify the response is cached for its TTL.");
+                    Assert::AreEqual(200, later.errorWrapper.HttpCode);
+                    Assert::AreEqual(std::string("hello"), later.errorWrapper.Data["Data"]["motd"].asString());
+
+                    PlayFab::CallRequestContainer expired;
+                    Assert::IsTrue(cache.Find(key, expired, now + ttl) == Lookup::Miss, L"Verify the response expires after its TTL.");
+                    PlayFab::PlayFabError failure;
+                    failure.HttpCode = 503;
+                    Assert::AreEqual(static_cast<size_t>(0), cache.Complete(key, failure, ttl, now + ttl).size());
+                    Assert::IsTrue(cache.Find(key, expired, now + ttl) == Lookup::Miss, L"Verify a failed response isn't cached.");
+                }
+
+                TEST_METHOD(PlayFabReadCacheKeepsAtMostMaxEntries)
+                {
+                    using PlayFab::PlayFabReadCache;
+                    typedef PlayFabReadCache::Lookup Lookup;
+                    PlayFabReadCache cache;
+                    const auto now = std::chrono::steady_clock::now();
+                    const std::chrono::milliseconds ttl(1000);
+                    PlayFab::PlayFabError result;
+                    result.HttpCode = 200;
+                    PlayFab::CallRequestContainer request;
+
+                    for (size_t i = 0; i <= PlayFabReadCache::c_maxEntries; ++i)
+                    {
+                        const std::string key = "/Server/GetUserData\nunitTestSecret\n" + std::to_string(i);
+                        Assert::IsTrue(cache.Find(key, request, now) == Lookup::Miss);
+                        cache.Complete(key, result, ttl, now);
+                    }
+                    Assert::IsTrue(cache.Find("/Server/GetUserData\nunitTestSecret\n0", request, now) == Lookup::Hit);
+                    Assert::IsTrue(cache.Find("/Server/GetUserData\nunitTestSecret\n" + std::to_string(PlayFabReadCache::c_maxEntries), request, now) == Lookup::Miss, L"Verify a full cache doesn't store more responses.");
+
+                    const std::string newer = "/Server/GetUserData\nunitTestSecret\nnewer";
+                    Assert::IsTrue(cache.Find(newer, request, now + ttl) == Lookup::Miss);
+                    cache.Complete(newer, result, ttl, now + ttl);
+                    Assert::IsTrue(cache.Find(newer, request, now + ttl) == Lookup::Hit, L"Verify expired entries make room for new ones.");
+                    Assert::IsTrue(cache.Find("/Server/GetUserData\nunitTestSecret\n1", request, now + ttl) == Lookup::Miss, L"Verify the expired entries were removed.");
+                }
+
+                TEST_METHOD(PlayFabReadCacheKeysIgnoreJsonFormattingButNotAuth)
+                {
+                    using PlayFab::PlayFabReadCache;
+                    const std::string path = "/Server/GetTitleData";
+                    const Json::Value request = parseJson("{\"Keys\": [\"motd\", \"news\"], \"OverrideLabel\": \"en\"}");
+                    const Json::Value reformatted = parseJson("{ \"OverrideLabel\":\"en\",\n  \"Keys\":[ \"motd\",\"news\" ] }");
+
+                    Assert::AreEqual(PlayFabReadCache::MakeKey(path, "unitTestSecret", request), PlayFabReadCache::MakeKey(path, "unitTestSecret", reformatted), L"Verify the member order and whitespace of the request don't matter.");
+                    Assert::AreNotEqual(PlayFabReadCache::MakeKey(path, "unitTestSecret", request), PlayFabReadCache::MakeKey(path, "otherSecret", request), L"Verify callers with different credentials don't share responses.");
+                    Assert::AreNotEqual(PlayFabReadCache::MakeKey(path, "unitTestSecret", request), PlayFabReadCache::MakeKey("/Server/GetTitleInternalData", "unitTestSecret", request));
+                    Assert::AreNotEqual(PlayFabReadCache::MakeKey(path, "unitTestSecret", request), PlayFabReadCache::MakeKey(path, "unitTestSecret", parseJson("{\"Keys\": [\"news\", \"motd\"], \"OverrideLabel\": \"en\"}")));
+
+                    Assert::AreEqual(10000LL, static_cast<long long>(PlayFabReadCache::GetTtl("/Server/GetPlayerProfile").count()), L"Verify the TTL is looked up by API name.");
+                    Assert::AreEqual(0LL, static_cast<long long>(PlayFabReadCache::GetTtl("/Server/UpdateUserData").count()), L"Verify APIs that aren't listed aren't cached.");
+                }
+
+                TEST_METHOD(PlayFabUpdateDeliversResultsInOrderWithinItsLimits)
+                {
+                    std::unique_ptr<PlayFab::PlayFabHttp> http(new PlayFab::PlayFabHttp());
+                    std::vector<std::pair<int, int>> delivered;
+                    for (int i = 0; i < 10; ++i)
+                    {
+                        http->PushResult(*makeResult(delivered, 0, i, recordResult));
+                    }
+
+                    Assert::AreEqual(static_cast<size_t>(7), http->Update(3, std::chrono::microseconds::max()), L"Verify the results that are still waiting are returned.");
+                    Assert::AreEqual(static_cast<size_t>(3), delivered.size(), L"Verify Update stops at maxResults.");
+                    Assert::AreEqual(static_cast<size_t>(6), http->Update(10, std::chrono::microseconds(0)), L"Verify one result is delivered even without a time budget.");
+                    Assert::AreEqual(static_cast<size_t>(6), http->Update(), L"Verify Update() returns how many were waiting, including the one it delivered.");
+                    Assert::AreEqual(static_cast<size_t>(5), delivered.size());
+                    Assert::AreEqual(static_cast<size_t>(0), http->Update(100, std::chrono::microseconds::max()));
+                    Assert::AreEqual(static_cast<size_t>(10), delivered.size());
+                    for (int i = 0; i < 10; ++i)
+                    {
+                        Assert::AreEqual(i, delivered[i].second, L"Verify results are delivered oldest first.");
+                    }
+                    Assert::AreEqual(static_cast<size_t>(0), http->Update(), L"Verify an empty queue stays empty.");
+
+                    // Each of these callbacks takes at least 20ms, so a 30ms budget is spent by the second
+                    for (int i = 0; i < 5; ++i)
+                    {
+                        http->PushResult(*makeResult(delivered, 0, i, recordResultSlowly));
+                    }
+                    const size_t remaining = http->Update(100, std::chrono::milliseconds(30));
+                    const size_t handled = delivered.size() - 10;
+                    Assert::IsTrue(handled >= 1 && handled <= 2, L"Verify Update stops once the time budget is spent.");
+                    Assert::AreEqual(5 - handled, remaining);
+                }
+
+                TEST_METHOD(PlayFabResultsQueueKeepsEachProducersOrder)
+                {
+                    std::unique_ptr<PlayFab::PlayFabHttp> http(new PlayFab::PlayFabHttp());
+                    std::vector<std::pair<int, int>> delivered;
+                    const int producerCount = 4;
+                    const int resultsPerProducer = 2000;
+                    std::vector<std::thread> producers;
+                    for (int producer = 0; producer < producerCount; ++producer)
+                    {
+                        producers.emplace_back([&http, &delivered, producer, resultsPerProducer]()
+                        {
+                            for (int i = 0; i < resultsPerProducer; ++i)
+                            {
+                                http->PushResult(*makeResult(delivered, producer, i, recordResult));
+                            }
+                        });
+                    }
+
+                    // Only this thread runs the callbacks, so delivered needs no lock
+                    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+                    while (delivered.size() < static_cast<size_t>(producerCount * resultsPerProducer) && std::chrono::steady_clock::now() < deadline)
+                    {
+                        http->Update(50, std::chrono::microseconds::max());
+                    }
+                    for (std::thread& producer : producers)
+                    {
+                        producer.join();
+                    }
+
+                    Assert::AreEqual(static_cast<size_t>(producerCount * resultsPerProducer), delivered.size(), L"Verify every result is delivered.");
+                    std::vector<int> next(producerCount, 0);
+                    for (const std::pair<int, int>& result : delivered)
+                    {
+                        Assert::AreEqual(next[result.first], result.second, L"Verify each producer's results are delivered in the order they were added.");
+                        ++next[result.first];
+                    }
+                    Assert::AreEqual(static_cast<size_t>(0), http->Update());
+                }
+
+                TEST_METHOD(PlayFabDefaultUpdateWithLimitsCallsUpdate)
+                {
+                    FakePlayFabHttp& http = FakePlayFabHttp::Install();
+                    PlayFab::IPlayFabHttp& instance = PlayFab::IPlayFabHttp::Get();
+
+                    http.SetResults(5);
+                    Assert::AreEqual(static_cast<size_t>(2), instance.Update(3, std::chrono::microseconds::max()), L"Verify it stops at maxResults and returns what is still waiting.");
+                    Assert::AreEqual(static_cast<size_t>(3), http.UpdateCalls());
+                    Assert::AreEqual(static_cast<size_t>(1), instance.Update(1, std::chrono::microseconds(0)), L"Verify one result is delivered even without a time budget.");
+                    Assert::AreEqual(static_cast<size_t>(0), instance.Update(10, std::chrono::microseconds::max()));
+                    Assert::AreEqual(static_cast<size_t>(5), http.UpdateCalls(), L"Verify it stops once nothing is waiting.");
+                    Assert::AreEqual(static_cast<size_t>(0), instance.Update(10, std::chrono::microseconds::max()));
+                    Assert::AreEqual(static_cast<size_t>(5), http.UpdateCalls());
+                    FakePlayFabHttp::Uninstall();
+                }
+
             private:
+                // A completed call for PlayFabHttp's results queue, which deletes it once it is delivered
+                static PlayFab::CallRequestContainer* makeResult(std::vector<std::pair<int, int>>& delivered, int producer, int index, PlayFab::RequestCompleteCallback callback)
+                {
+                    PlayFab::CallRequestContainer* result = new PlayFab::CallRequestContainer();
+                    result->errorWrapper.HttpCode = 200;
+                    result->errorWrapper.Data["producer"] = producer;
+                    result->errorWrapper.Data["index"] = index;
+                    result->internalCallback = callback;
+                    result->customData = &delivered;
+                    return result;
+                }
+
+                static void recordResult(PlayFab::CallRequestContainer& result)
+                {
+                    static_cast<std::vector<std::pair<int, int>>*>(result.customData)->emplace_back(result.errorWrapper.Data["producer"].asInt(), result.errorWrapper.Data["index"].asInt());
+                }
+
+                static void recordResultSlowly(PlayFab::CallRequestContainer& result)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    recordResult(result);
+                }
+
+                // Sets the PlayFabEventPipeline settings for a test and restores them afterwards, even when it fails.
+                // An empty eventNamespace sends each event on its own.
+                struct PlayFabEventSettings
+                {
+                    PlayFabEventSettings(unsigned int queueCapacity, unsigned int batchSize, unsigned int flushIntervalMs, unsigned int batchesInFlight, const std::string& eventNamespace) :
+                        m_queueCapacity(PlayFab::PlayFabSettings::eventQueueCapacity),
+                        m_batchSize(PlayFab::PlayFabSettings::eventBatchSize),
+                        m_flushIntervalMs(PlayFab::PlayFabSettings::eventFlushIntervalMs),
+                        m_batchesInFlight(PlayFab::PlayFabSettings::eventBatchesInFlight),
+                        m_eventNamespace(PlayFab::PlayFabSettings::eventNamespace),
+                        m_entityToken(PlayFab::PlayFabSettings::entityToken)
+                    {
+                        PlayFab::PlayFabSettings::eventQueueCapacity = queueCapacity;
+                        PlayFab::PlayFabSettings::eventBatchSize = batchSize;
+                        PlayFab::PlayFabSettings::eventFlushIntervalMs = flushIntervalMs;
+                        PlayFab::PlayFabSettings::eventBatchesInFlight = batchesInFlight;
+                        PlayFab::PlayFabSettings::eventNamespace = eventNamespace;
+                        PlayFab::PlayFabSettings::entityToken = "unitTestEntityToken";
+                    }
+
+                    ~PlayFabEventSettings()
+                    {
+                        PlayFab::PlayFabSettings::eventQueueCapacity = m_queueCapacity;
+                        PlayFab::PlayFabSettings::eventBatchSize = m_batchSize;
+                        PlayFab::PlayFabSettings::eventFlushIntervalMs = m_flushIntervalMs;
+                        PlayFab::PlayFabSettings::eventBatchesInFlight = m_batchesInFlight;
+                        PlayFab::PlayFabSettings::eventNamespace = m_eventNamespace;
+                        PlayFab::PlayFabSettings::entityToken = m_entityToken;
+                    }
+
+                    unsigned int m_queueCapacity;
+                    unsigned int m_batchSize;
+                    unsigned int m_flushIntervalMs;
+                    unsigned int m_batchesInFlight;
+                    std::string m_eventNamespace;
+                    std::string m_entityToken;
+                };
+
+                bool writePlayerEvent(PlayFab::PlayFabEventPipeline& pipeline, int index)
+                {
+                    PlayFab::ServerModels::WriteServerPlayerEventRequest request;
+                    request.EventName = "unit_test";
+                    request.PlayFabId = "0123456789ABCDEF";
+                    request.Body["index"] = index;
+                    return pipeline.WritePlayerEvent(request);
+                }
+
                 Json::Value parseJson(std::string jsonStr)
                 {
                     Json::CharReaderBuilder jsonReaderFactory;